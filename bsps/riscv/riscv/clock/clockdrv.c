@@ -102,6 +102,46 @@ static void riscv_clock_at_tick(riscv_timecounter *tc)
   riscv_clock_write_mtimecmp(mtimecmp, value);
 }
 
+static void riscv_clock_skip_ticks(riscv_timecounter *tc, uint32_t ticks)
+{
+  Per_CPU_Control *cpu_self;
+  volatile RISCV_CLINT_timer_reg *mtimecmp;
+  uint64_t value;
+
+  cpu_self = _Per_CPU_Get();
+  mtimecmp = cpu_self->cpu_per_cpu.clint_mtimecmp;
+  value = mtimecmp->val_64;
+  value += (uint64_t) (ticks - 1) * tc->interval;
+
+  riscv_clock_write_mtimecmp(mtimecmp, value);
+}
+
+static uint32_t riscv_clock_resume_ticks(riscv_timecounter *tc, uint32_t ticks)
+{
+  Per_CPU_Control *cpu_self;
+  volatile RISCV_CLINT_timer_reg *mtimecmp;
+  uint64_t value;
+  uint64_t now;
+  uint32_t elapsed;
+
+  cpu_self = _Per_CPU_Get();
+  mtimecmp = cpu_self->cpu_per_cpu.clint_mtimecmp;
+  value = mtimecmp->val_64;
+  value -= (uint64_t) (ticks - 1) * tc->interval;
+  now = riscv_clock_read_mtime(&tc->clint->mtime);
+
+  if (now < value) {
+    elapsed = 0;
+  } else {
+    elapsed = (uint32_t) ((now - value) / tc->interval) + 1;
+  }
+
+  value += (uint64_t) elapsed * tc->interval;
+  riscv_clock_write_mtimecmp(mtimecmp, value);
+
+  return elapsed;
+}
+
 static void riscv_clock_handler_install(rtems_interrupt_handler handler)
 {
   rtems_status_code sc;
@@ -243,6 +283,14 @@ RTEMS_SYSINIT_ITEM(
 
 #define Clock_driver_support_initialize_hardware() riscv_clock_initialize()
 
+#define Clock_driver_support_skip_ticks(ticks) \
+  riscv_clock_skip_ticks(&riscv_clock_tc, ticks)
+
+#define Clock_driver_support_resume_ticks(ticks) \
+  riscv_clock_resume_ticks(&riscv_clock_tc, ticks)
+
+#define Clock_driver_support_wait_for_interrupt() __asm__ volatile ("wfi")
+
 #define Clock_driver_support_install_isr(isr) \
   riscv_clock_handler_install(isr)
 
@@ -46,6 +46,7 @@
 #include <rtems/score/smpimpl.h>
 #include <rtems/score/timecounter.h>
 #include <rtems/score/thread.h>
+#include <rtems/score/threaddispatch.h>
 #include <rtems/score/watchdogimpl.h>
 
 /**
@@ -64,6 +65,29 @@
 #error "Fast Idle PLUS n ISRs per tick is not supported"
 #endif
 
+/*
+ * A driver supports the dynamic tick mode, see _Clock_Dynamic_tick_idle_body(),
+ * if it defines the following with interrupts disabled on the current
+ * processor:
+ *
+ * Clock_driver_support_skip_ticks(ticks) shall program the clock interrupt to
+ * occur at the ticks-th tick from the last tick performed.
+ *
+ * Clock_driver_support_wait_for_interrupt() shall wait until an interrupt is
+ * pending.
+ *
+ * Clock_driver_support_resume_ticks(ticks) shall program the clock interrupt
+ * to occur at the next tick in the future and return the count of ticks
+ * elapsed since the last tick performed.  The ticks value is the one of the
+ * previous Clock_driver_support_skip_ticks().
+ */
+#if defined(Clock_driver_support_skip_ticks) && \
+  (CLOCK_DRIVER_USE_FAST_IDLE || CLOCK_DRIVER_ISRS_PER_TICK || \
+  defined(CLOCK_DRIVER_USE_DUMMY_TIMECOUNTER) || \
+  defined(Clock_driver_timecounter_tick))
+#error "The dynamic tick mode needs a one ISR per tick timecounter driver"
+#endif
+
 #if defined(BSP_FEATURE_IRQ_EXTENSION) || \
     (CPU_SIMPLE_VECTORED_INTERRUPTS != TRUE)
 typedef void * Clock_isr_argument;
@@ -154,7 +178,7 @@ static bool _Clock_Has_watchdogs(const Per_CPU_Control *cpu)
   size_t i;
 
   for (i = 0; i < RTEMS_ARRAY_SIZE(cpu->Watchdog.Header); ++i) {
-    if (_Watchdog_Header_first(&cpu->Watchdog.Header[i]) != NULL) {
+    if (!_Watchdog_Header_is_empty(&cpu->Watchdog.Header[i])) {
       return true;
     }
   }
@@ -163,6 +187,98 @@ static bool _Clock_Has_watchdogs(const Per_CPU_Control *cpu)
 }
 #endif
 
+#if defined(Clock_driver_support_skip_ticks)
+static uint32_t _Clock_Get_maximum_skipped_ticks(void)
+{
+  struct timecounter *tc;
+  uint64_t            us_per_tick;
+  uint64_t            interval;
+  uint64_t            maximum;
+
+  /*
+   * The time between two timecounter ticks shall be less than the half of the
+   * timecounter period.
+   */
+  tc = _Timecounter;
+  us_per_tick = rtems_configuration_get_microseconds_per_tick();
+  interval = (tc->tc_frequency * us_per_tick) / 1000000;
+
+  if (interval == 0) {
+    return 1;
+  }
+
+  maximum = (tc->tc_counter_mask / 2) / interval;
+
+  if (maximum == 0) {
+    return 1;
+  }
+
+  if (maximum > UINT32_MAX) {
+    return UINT32_MAX;
+  }
+
+  return (uint32_t) maximum;
+}
+
+void *_Clock_Dynamic_tick_idle_body(uintptr_t ignored)
+{
+  uint32_t maximum;
+
+  (void) ignored;
+  maximum = _Clock_Get_maximum_skipped_ticks();
+
+  while (true) {
+    Per_CPU_Control *cpu_self;
+    ISR_Level        level;
+    uint32_t         ticks;
+
+    /*
+     * Interrupt service routines may only see the watchdog ticks after the
+     * skipped ticks were performed.  The threads made ready by the watchdog
+     * routines are dispatched with the thread dispatch enable below.  The
+     * watchdog routines of the skipped ticks are called by this thread and
+     * not in interrupt context.
+     */
+    cpu_self = _Thread_Dispatch_disable();
+    _ISR_Local_disable(level);
+
+    if (!cpu_self->dispatch_necessary) {
+#if defined(RTEMS_SMP) && defined(CLOCK_DRIVER_USE_ONLY_BOOT_PROCESSOR)
+      /*
+       * The boot processor performs the ticks of all processors, so ticks are
+       * skipped only in uniprocessor configurations.
+       */
+      if (_SMP_Get_processor_maximum() == 1) {
+        ticks = _Watchdog_Skip_ticks_begin(cpu_self, maximum);
+      } else {
+        ticks = 1;
+      }
+#else
+      ticks = _Watchdog_Skip_ticks_begin(cpu_self, maximum);
+#endif
+
+      if (ticks > 1) {
+        Clock_driver_support_skip_ticks(ticks);
+        Clock_driver_support_wait_for_interrupt();
+        ticks = Clock_driver_support_resume_ticks(ticks);
+        _Watchdog_Skip_ticks_end(cpu_self);
+
+        if (ticks > 0) {
+          _Timecounter_Tick_multiple(ticks);
+        }
+      } else {
+        Clock_driver_support_wait_for_interrupt();
+      }
+    }
+
+    _ISR_Local_enable(level);
+    _Thread_Dispatch_enable(cpu_self);
+  }
+
+  return NULL;
+}
+#endif
+
 /**
  *  @brief Clock_isr
  *
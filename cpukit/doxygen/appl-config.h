@@ -2037,6 +2037,8 @@
  *
  * * @ref CONFIGURE_FILESYSTEM_IMFS,
  *
+ * * @ref CONFIGURE_FILESYSTEM_IMFS_CHUNKFILE,
+ *
  * * @ref CONFIGURE_FILESYSTEM_JFFS2,
  *
  * * @ref CONFIGURE_FILESYSTEM_NFS,
@@ -2112,6 +2114,29 @@
  */
 #define CONFIGURE_FILESYSTEM_IMFS
 
+/* Generated from spec:/acfg/if/filesystem-imfs-chunkfile */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * @anchor CONFIGURE_FILESYSTEM_IMFS_CHUNKFILE
+ *
+ * In case this configuration option is defined, then the In-Memory Filesystem
+ * (IMFS) with chunk files is registered, so that instances of this filesystem
+ * can be mounted by the application with the
+ * RTEMS_FILESYSTEM_TYPE_IMFS_CHUNKFILE filesystem type.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * The regular files of these instances store their data in chunks found
+ * through a flat table instead of the memfile block tables.  This is intended
+ * for large files.
+ */
+#define CONFIGURE_FILESYSTEM_IMFS_CHUNKFILE
+
 /* Generated from spec:/acfg/if/filesystem-jffs2 */
 
 /**
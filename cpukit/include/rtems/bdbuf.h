@@ -47,7 +47,7 @@ extern "C" {
  *
  * The Block Device Buffer Management implements a cache between the disk
  * devices and file systems.  The code provides read-ahead and write queuing to
- * the drivers and fast cache look-up using an AVL tree.
+ * the drivers and fast cache look-up using a hash table for each disk device.
  *
  * The block size used by a file system can be set at runtime and must be a
  * multiple of the disk device block size.  The disk device's physical block
@@ -132,17 +132,18 @@ extern "C" {
  * Empty or cached buffers are added to the LRU list and removed from this
  * queue when a caller requests a buffer.  This is referred to as getting a
  * buffer in the code and the event get in the state diagram.  The buffer is
- * assigned to a block and inserted to the AVL based on the block/device key.
- * If the block is to be read by the user and not in the cache it is transfered
- * from the disk into memory.  If no buffers are on the LRU list the modified
- * list is checked.  If buffers are on the modified the swap out task will be
- * woken.  The request blocks until a buffer is available for recycle.
+ * assigned to a block and inserted to the hash table of the disk device based
+ * on the block key.  If the block is to be read by the user and not in the
+ * cache it is transfered from the disk into memory.  If no buffers are on the
+ * LRU list the modified lists are checked.  If buffers are on a modified list
+ * the swap out task will be woken.  The request blocks until a buffer is available
+ * for recycle.
  *
  * A block being accessed is given to the file system layer and not accessible
  * to another requester until released back to the cache.  The same goes to a
  * buffer in the transfer state.  The transfer state means being read or
  * written.  If the file system has modified the block and releases it as
- * modified it placed on the cache's modified list and a hold timer
+ * modified it placed on the modified list of its disk and a hold timer
  * initialised.  The buffer is held for the hold time before being written to
  * disk.  Buffers are held for a configurable period of time on the modified
  * list as a write sets the state to transfer and this locks the buffer out
@@ -157,14 +158,28 @@ extern "C" {
  * is a speculative operation so excessive use can remove valuable and needed
  * blocks from the cache.  The read-ahead is triggered after two misses of
  * ascending consecutive blocks or a read hit of a block read by the
- * most-resent read-ahead transfer.  The read-ahead works per disk, but all
- * transfers are issued by the read-ahead task.
+ * most-resent read-ahead transfer of a sequential read stream.  The
+ * read-ahead works per disk, but all transfers are issued by the read-ahead
+ * task.  Each disk tracks up to @ref RTEMS_DISK_READ_AHEAD_STREAM_COUNT
+ * concurrent sequential read streams.  The read-ahead window of a stream
+ * starts small and doubles with each read-ahead transfer up to the maximum
+ * read-ahead blocks.  It shrinks if blocks read ahead are recycled before
+ * they are read.  A read miss which continues no stream starts a new stream
+ * with the initial window.
  *
  * The cache has the following lists of buffers:
  *  - LRU: Accessed or transfered buffers released in least recently used
  *  order.  Empty buffers will be placed to the front.
- *  - Modified: Buffers waiting to be written to disk.
- *  - Sync: Buffers to be synchronized with the disk.
+ *  - Modified: Buffers waiting to be written to disk.  There is one list per
+ *  disk.
+ *  - Sync: Buffers to be synchronized with the disk.  There is one list per
+ *  disk.
+ *
+ * The swap out task writes the modified buffers of one disk at a time.  It
+ * hands the transfers over to the swap out worker tasks if available, so that
+ * the disks are written in parallel.  A disk has at most one write transfer in
+ * progress.  Configure at least as many swap out workers as disks are
+ * concurrently written to give each disk its own worker.
  *
  * A cache look-up will be performed to find a suitable buffer.  A suitable
  * buffer is one that matches the same allocation size as the device the buffer
@@ -181,11 +196,11 @@ extern "C" {
  * @brief State of a buffer of the cache.
  *
  * The state has several implications.  Depending on the state a buffer can be
- * in the AVL tree, in a list, in use by an entity and a group user or not.
+ * in the hash table, in a list, in use by an entity and a group user or not.
  *
  * <table>
  *   <tr>
- *     <th>State</th><th>Valid Data</th><th>AVL Tree</th>
+ *     <th>State</th><th>Valid Data</th><th>Hash Table</th>
  *     <th>LRU List</th><th>Modified List</th><th>Synchronization List</th>
  *     <th>Group User</th><th>External User</th>
  *   </tr>
@@ -302,20 +317,15 @@ typedef struct rtems_bdbuf_group rtems_bdbuf_group;
 /**
  * To manage buffers we using buffer descriptors (BD). A BD holds a buffer plus
  * a range of other information related to managing the buffer in the cache. To
- * speed-up buffer lookup descriptors are organized in AVL-Tree. The fields
- * 'dd' and 'block' are search keys.
+ * speed-up buffer lookup descriptors are organized in a hash table of their
+ * disk device. The field 'block' is the search key.
  */
 typedef struct rtems_bdbuf_buffer
 {
   rtems_chain_node link;       /**< Link the BD onto a number of lists. */
 
-  struct rtems_bdbuf_avl_node
-  {
-    struct rtems_bdbuf_buffer* left;   /**< Left Child */
-    struct rtems_bdbuf_buffer* right;  /**< Right Child */
-    signed char                cache;  /**< Cache */
-    signed char                bal;    /**< The balance of the sub-tree */
-  } avl;
+  struct rtems_bdbuf_buffer* hash_next; /**< Next BD in the hash table bucket
+                                         * of the disk device. */
 
   rtems_disk_device *dd;        /**< disk device */
 
@@ -331,6 +341,8 @@ typedef struct rtems_bdbuf_buffer
                                   * part of. */
   uint32_t hold_timer;           /**< Timer to indicate how long a buffer
                                   * has been held in the cache modified. */
+  bool read_ahead;               /**< The buffer was read by a read-ahead
+                                  * transfer and not accessed since. */
 
   int   references;              /**< Allow reference counting by owner. */
   void* user;                    /**< User data. */
@@ -359,8 +371,8 @@ struct rtems_bdbuf_group
  * structure.
  */
 typedef struct rtems_bdbuf_config {
-  uint32_t            max_read_ahead_blocks;   /**< Number of blocks to read
-                                                * ahead. */
+  uint32_t            max_read_ahead_blocks;   /**< Maximum number of blocks
+                                                * to read ahead. */
   uint32_t            max_write_blocks;        /**< Number of blocks to write
                                                 * at once. */
   rtems_task_priority swapout_priority;        /**< Priority of the swap out
@@ -539,13 +551,51 @@ rtems_bdbuf_read (
   rtems_bdbuf_buffer** bd
 );
 
+/**
+ * @brief Read consecutive blocks into a buffer provided by the caller.
+ *
+ * Blocks which are in the cache are copied from the cache. Runs of blocks
+ * which are not in the cache are read from the disk with one transfer request
+ * directly into the caller buffer. If the driver has the
+ * @ref RTEMS_BLKDEV_CAP_MULTIBLOCK_BUFFER capability a run is a single
+ * scatter/gather buffer, otherwise it has one scatter/gather buffer per
+ * block. The blocks read from the disk do not enter the cache. Blocks which
+ * enter the cache while a transfer is in progress are copied from the cache
+ * after the transfer. The call blocks until all transfers are complete.
+ *
+ * The caller must not hold a buffer of the block range obtained via
+ * rtems_bdbuf_get() or rtems_bdbuf_read(), otherwise the call will block
+ * forever.
+ *
+ * Before you can use this function, the rtems_bdbuf_init() routine must be
+ * called at least once to initialize the cache, otherwise a fatal error will
+ * occur.
+ *
+ * @param dd [in] The disk device.
+ * @param block [in] Linear media block number of the first block.
+ * @param block_count [in] Number of blocks to read.
+ * @param buffer [out] Buffer of @a block_count times the block size bytes.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid block range.
+ * @retval RTEMS_IO_ERROR IO error.
+ */
+rtems_status_code
+rtems_bdbuf_read_blocks (
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum block,
+  uint32_t block_count,
+  void *buffer
+);
+
 /**
  * @brief Give a hint which blocks should be cached next.
  *
  * Provide a hint to the read ahead mechanism which blocks should be cached
- * next. This overwrites the default linear pattern. You should use it in (for
- * example) a file system to tell bdbuf where the next part of a fragmented file
- * is. If you know the length of the file, you can provide that too.
+ * next. This resets the read streams of the disk device and overwrites the
+ * default linear pattern. You should use it in (for example) a file system to
+ * tell bdbuf where the next part of a fragmented file is. If you know the
+ * length of the file, you can provide that too.
  *
  * Before you can use this function, the rtems_bdbuf_init() routine must be
  * called at least once to initialize everything. Otherwise you might get
@@ -633,12 +683,13 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer* bd);
 
 /**
  * Synchronize all modified buffers for this device with the disk and wait
- * until the transfers have completed. The sync mutex for the cache is locked
- * stopping the addition of any further modified buffers. It is only the
- * currently modified buffers that are written.
+ * until the transfers have completed. The sync mutex of the device is locked
+ * stopping the addition of any further modified buffers to this device. It is
+ * only the currently modified buffers that are written.
  *
- * @note Nesting calls to sync multiple devices will be handled sequentially. A
+ * @note Nesting calls to sync the same device will be handled sequentially. A
  * nested call will be blocked until the first sync request has complete.
+ * Syncs of different devices may run in parallel.
  *
  * Before you can use this function, the rtems_bdbuf_init() routine must be
  * called at least once to initialize the cache, otherwise a fatal error will
@@ -665,6 +716,25 @@ rtems_bdbuf_syncdev (rtems_disk_device *dd);
 void
 rtems_bdbuf_purge_dev (rtems_disk_device *dd);
 
+/**
+ * @brief Purges all buffers corresponding to the disk device @a dd and frees
+ * the buffer lookup table of the disk device.
+ *
+ * Call this function before the storage of the disk device is released.  No
+ * buffer of the disk device may be in use.  The function waits until transfers
+ * of buffers of the disk device in progress are done, for example transfers
+ * of the read-ahead or swapout task.  The disk device may be used again only
+ * after a call to rtems_bdbuf_set_block_size().
+ *
+ * Before you can use this function, the rtems_bdbuf_init() routine must be
+ * called at least once to initialize the cache, otherwise a fatal error will
+ * occur.
+ *
+ * @param dd [in] The disk device.
+ */
+void
+rtems_bdbuf_destroy_dev (rtems_disk_device *dd);
+
 /**
  * @brief Sets the block size of a disk device.
  *
@@ -675,7 +745,9 @@ rtems_bdbuf_purge_dev (rtems_disk_device *dd);
  * loss of data.  After the synchronization the disk device is purged to ensure
  * a consistent cache state and the block size change occurs.  This also resets
  * the read-ahead state of this disk device.  Due to the purge operation this
- * may result in loss of data.
+ * may result in loss of data.  The first call for a disk device allocates the
+ * buffer lookup table of the disk device.  If the block count of the disk
+ * device changes, then the lookup table may be replaced.
  *
  * Before you can use this function, the rtems_bdbuf_init() routine must be
  * called at least once to initialize the cache, otherwise a fatal error will
@@ -688,6 +760,8 @@ rtems_bdbuf_purge_dev (rtems_disk_device *dd);
  *
  * @retval RTEMS_SUCCESSFUL Successful operation. 
  * @retval RTEMS_INVALID_NUMBER Invalid block size.
+ * @retval RTEMS_NO_MEMORY Not enough memory to allocate the buffer lookup
+ * table of the disk device.
  */
 rtems_status_code
 rtems_bdbuf_set_block_size (rtems_disk_device *dd,
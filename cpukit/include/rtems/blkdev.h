@@ -270,6 +270,16 @@ static inline int rtems_disk_fd_reset_device_stats(int fd)
  */
 #define RTEMS_BLKDEV_CAP_SYNC (1 << 1)
 
+/**
+ * @brief The driver accepts scatter/gather buffers which span multiple
+ * consecutive blocks.
+ *
+ * With this capability the cache may issue a read request with a single
+ * buffer of a multiple of the block size.  Otherwise the buffer length is
+ * always the block size.
+ */
+#define RTEMS_BLKDEV_CAP_MULTIBLOCK_BUFFER (1 << 2)
+
 /** @} */
 
 /**
@@ -65,6 +65,32 @@ extern volatile uint32_t Clock_driver_ticks;
  */
 void _Clock_Initialize( void );
 
+/**
+ * @brief Idle thread body of the dynamic tick mode.
+ *
+ * While the processor is idle, the clock tick interrupts up to the next
+ * possible watchdog expiration are skipped.  The elapsed ticks are
+ * reconstructed from the timecounter once the processor leaves the idle state.
+ * This function is provided only by clock drivers which support the dynamic
+ * tick mode.
+ *
+ * The watchdog routines of the elapsed ticks are called by the idle thread and
+ * not in interrupt context.  For example, rtems_interrupt_is_in_progress()
+ * returns false in the service routines of Classic API timers fired by these
+ * ticks.
+ *
+ * In SMP configurations, the boot processor does not skip ticks if more than
+ * one processor is present, see _Watchdog_Skip_ticks_begin().  The secondary
+ * processors skip their ticks individually.  A watchdog inserted by another
+ * processor which expires before the next clock tick interrupt of the idle
+ * processor wakes it up by an inter-processor interrupt.
+ *
+ * @param ignored is not used.
+ *
+ * @return This function does not return.
+ */
+void *_Clock_Dynamic_tick_idle_body( uintptr_t ignored );
+
 /** @} */
 
 #ifdef __cplusplus
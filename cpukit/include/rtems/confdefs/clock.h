@@ -62,6 +62,18 @@
   #include <rtems/sysinit.h>
 #endif
 
+#ifdef CONFIGURE_CLOCK_DRIVER_DYNAMIC_TICK
+  #ifndef CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+    #error "CONFIGURE_CLOCK_DRIVER_DYNAMIC_TICK requires CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER"
+  #endif
+
+  #ifdef CONFIGURE_IDLE_TASK_BODY
+    #error "CONFIGURE_CLOCK_DRIVER_DYNAMIC_TICK and CONFIGURE_IDLE_TASK_BODY are mutually exclusive"
+  #endif
+
+  #define CONFIGURE_IDLE_TASK_BODY _Clock_Dynamic_tick_idle_body
+#endif
+
 #ifndef CONFIGURE_MICROSECONDS_PER_TICK
   #define CONFIGURE_MICROSECONDS_PER_TICK 10000
 #endif
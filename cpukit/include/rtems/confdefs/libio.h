@@ -50,6 +50,7 @@
   #define CONFIGURE_FILESYSTEM_DOSFS
   #define CONFIGURE_FILESYSTEM_FTPFS
   #define CONFIGURE_FILESYSTEM_IMFS
+  #define CONFIGURE_FILESYSTEM_IMFS_CHUNKFILE
   #define CONFIGURE_FILESYSTEM_JFFS2
   /* #define CONFIGURE_FILESYSTEM_NFS         See #5118 */
   #define CONFIGURE_FILESYSTEM_RFS
@@ -116,6 +117,10 @@
     #error "CONFIGURE_APPLICATION_DISABLE_FILESYSTEM cannot be used together with CONFIGURE_FILESYSTEM_IMFS"
   #endif
 
+  #ifdef CONFIGURE_FILESYSTEM_IMFS_CHUNKFILE
+    #error "CONFIGURE_APPLICATION_DISABLE_FILESYSTEM cannot be used together with CONFIGURE_FILESYSTEM_IMFS_CHUNKFILE"
+  #endif
+
   #ifdef CONFIGURE_FILESYSTEM_JFFS2
     #error "CONFIGURE_APPLICATION_DISABLE_FILESYSTEM cannot be used together with CONFIGURE_FILESYSTEM_JFFS2"
   #endif
@@ -303,6 +308,9 @@ const rtems_filesystem_table_t rtems_filesystem_table[] = {
   #ifdef CONFIGURE_FILESYSTEM_IMFS
     { RTEMS_FILESYSTEM_TYPE_IMFS, IMFS_initialize },
   #endif
+  #ifdef CONFIGURE_FILESYSTEM_IMFS_CHUNKFILE
+    { RTEMS_FILESYSTEM_TYPE_IMFS_CHUNKFILE, IMFS_chunkfile_initialize },
+  #endif
   #ifdef CONFIGURE_FILESYSTEM_JFFS2
     { RTEMS_FILESYSTEM_TYPE_JFFS2, rtems_jffs2_initialize },
   #endif
@@ -50,10 +50,25 @@
 #define _CONFIGURE_HEAP_EXTEND_VIA_SBRK
 #endif
 
-#if defined(_CONFIGURE_HEAP_EXTEND_VIA_SBRK) || defined(CONFIGURE_MALLOC_DIRTY)
+#if defined(_CONFIGURE_HEAP_EXTEND_VIA_SBRK) || defined(CONFIGURE_MALLOC_DIRTY) \
+  || defined(CONFIGURE_MALLOC_FREE_INDEX) \
+  || defined(CONFIGURE_MALLOC_PER_CPU_CACHE)
 #include <rtems/malloc.h>
 #endif
 
+#if defined(CONFIGURE_MALLOC_FREE_INDEX) \
+  || defined(CONFIGURE_MALLOC_PER_CPU_CACHE)
+#include <rtems/sysinit.h>
+#endif
+
+#ifdef CONFIGURE_MALLOC_PER_CPU_CACHE
+#include <rtems/confdefs/percpu.h>
+
+#if CONFIGURE_MALLOC_PER_CPU_CACHE < 1
+  #error "CONFIGURE_MALLOC_PER_CPU_CACHE shall be greater than zero"
+#endif
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -68,6 +83,34 @@ rtems_malloc_dirtier_t rtems_malloc_dirty_helper =
   rtems_malloc_dirty_memory;
 #endif
 
+#ifdef CONFIGURE_MALLOC_FREE_INDEX
+Heap_Free_index _Malloc_Free_index;
+
+RTEMS_SYSINIT_ITEM(
+  _Malloc_Enable_free_index,
+  RTEMS_SYSINIT_MALLOC,
+  RTEMS_SYSINIT_ORDER_LAST_BUT_1
+);
+#endif
+
+#ifdef CONFIGURE_MALLOC_PER_CPU_CACHE
+const uint32_t _Malloc_Per_CPU_cache_capacity =
+  CONFIGURE_MALLOC_PER_CPU_CACHE;
+
+Malloc_Per_CPU_cache _Malloc_Per_CPU_caches[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+void *_Malloc_Per_CPU_cache_blocks[
+  _CONFIGURE_MAXIMUM_PROCESSORS * MALLOC_PER_CPU_CACHE_CLASS_COUNT
+    * CONFIGURE_MALLOC_PER_CPU_CACHE
+] RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
+
+RTEMS_SYSINIT_ITEM(
+  _Malloc_Initialize_per_CPU_caches,
+  RTEMS_SYSINIT_MALLOC,
+  RTEMS_SYSINIT_ORDER_LAST_BUT_1
+);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -55,6 +55,8 @@
 #include <rtems/score/context.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/smp.h>
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/sysinit.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -75,6 +77,16 @@ extern "C" {
     _Per_CPU_Information[ _CONFIGURE_MAXIMUM_PROCESSORS ];
 #endif
 
+#ifdef CONFIGURE_WATCHDOG_TIMER_WHEEL
+  Watchdog_Wheel _Watchdog_Wheels[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+  RTEMS_SYSINIT_ITEM(
+    _Watchdog_Wheel_initialize_per_CPU,
+    RTEMS_SYSINIT_DATA_STRUCTURES,
+    RTEMS_SYSINIT_ORDER_FIRST
+  );
+#endif
+
 /* Interrupt stack configuration */
 
 #ifndef CONFIGURE_INTERRUPT_STACK_SIZE
@@ -54,6 +54,7 @@
   && !defined(CONFIGURE_SCHEDULER_SIMPLE) \
   && !defined(CONFIGURE_SCHEDULER_SIMPLE_SMP) \
   && !defined(CONFIGURE_SCHEDULER_STRONG_APA) \
+  && !defined(CONFIGURE_SCHEDULER_WORK_STEALING_SMP) \
   && !defined(CONFIGURE_SCHEDULER_USER)
   #if defined(RTEMS_SMP) && _CONFIGURE_MAXIMUM_PROCESSORS > 1
     #define CONFIGURE_SCHEDULER_EDF_SMP
@@ -157,6 +158,35 @@ extern "C" {
   #endif
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_WORK_STEALING_SMP
+  #ifndef CONFIGURE_SCHEDULER_NAME
+    #define CONFIGURE_SCHEDULER_NAME rtems_build_name( 'M', 'W', 'S', ' ' )
+  #endif
+
+  #ifndef CONFIGURE_SCHEDULER_WORK_STEALING_SMP_MIGRATION_COST
+    #define CONFIGURE_SCHEDULER_WORK_STEALING_SMP_MIGRATION_COST 2
+  #endif
+
+  #ifndef CONFIGURE_SCHEDULER_WORK_STEALING_SMP_STEAL_PERIOD
+    #define CONFIGURE_SCHEDULER_WORK_STEALING_SMP_STEAL_PERIOD 8
+  #endif
+
+  #ifndef CONFIGURE_SCHEDULER_TABLE_ENTRIES
+    #define CONFIGURE_SCHEDULER \
+      RTEMS_SCHEDULER_WORK_STEALING_SMP( \
+        dflt, \
+        CONFIGURE_SCHEDULER_WORK_STEALING_SMP_MIGRATION_COST, \
+        CONFIGURE_SCHEDULER_WORK_STEALING_SMP_STEAL_PERIOD \
+      )
+
+    #define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+      RTEMS_SCHEDULER_TABLE_WORK_STEALING_SMP( \
+        dflt, \
+        CONFIGURE_SCHEDULER_NAME \
+      )
+  #endif
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_SIMPLE
   #ifndef CONFIGURE_SCHEDULER_NAME
     #define CONFIGURE_SCHEDULER_NAME rtems_build_name( 'U', 'P', 'S', ' ' )
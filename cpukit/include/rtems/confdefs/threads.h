@@ -127,6 +127,9 @@ typedef union {
   #ifdef CONFIGURE_SCHEDULER_STRONG_APA
     Scheduler_strong_APA_Node Strong_APA;
   #endif
+  #ifdef CONFIGURE_SCHEDULER_WORK_STEALING_SMP
+    Scheduler_work_stealing_SMP_Node Work_stealing_SMP;
+  #endif
   #ifdef CONFIGURE_SCHEDULER_USER_PER_THREAD
     CONFIGURE_SCHEDULER_USER_PER_THREAD User;
   #endif
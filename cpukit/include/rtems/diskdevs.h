@@ -17,6 +17,7 @@
 #include <rtems.h>
 #include <rtems/libio.h>
 #include <rtems/chain.h>
+#include <rtems/thread.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -64,20 +65,20 @@ typedef int (*rtems_block_device_ioctl)(
 #define RTEMS_DISK_READ_AHEAD_SIZE_AUTO (0)
 
 /**
- * @brief Block device read-ahead control.
+ * @brief Count of sequential read streams tracked per disk for the read-ahead.
  */
-typedef struct {
-  /**
-   * @brief Chain node for the read-ahead request queue of the read-ahead task.
-   */
-  rtems_chain_node node;
+#define RTEMS_DISK_READ_AHEAD_STREAM_COUNT 4
 
+/**
+ * @brief Sequential read stream of a disk.
+ */
+typedef struct {
   /**
    * @brief Block value to trigger the read-ahead request.
    *
    * A value of @ref RTEMS_DISK_READ_AHEAD_NO_TRIGGER will disable further
-   * read-ahead requests (except the ones triggered by @a rtems_bdbuf_peek)
-   * since no valid block can have this value.
+   * read-ahead requests of this stream since no valid block can have this
+   * value.
    */
   rtems_blkdev_bnum trigger;
 
@@ -93,11 +94,101 @@ typedef struct {
    * @brief Size of the next read-ahead request in blocks.
    *
    * A value of @ref RTEMS_DISK_READ_AHEAD_SIZE_AUTO will try to read the rest
-   * of the disk but at most the configured max_read_ahead_blocks.
+   * of the disk but at most the read-ahead window of this stream.
    */
   uint32_t nr_blocks;
+
+  /**
+   * @brief Read-ahead window of this stream in blocks.
+   *
+   * This is the size of the next automatic read-ahead request.  The window
+   * doubles with each read-ahead request up to the configured
+   * max_read_ahead_blocks.  It shrinks in case blocks of this stream are
+   * recycled before they are read.  A value of zero selects the initial
+   * window.
+   */
+  uint32_t window;
+
+  /**
+   * @brief Indicates that a read-ahead request of this stream is pending.
+   */
+  bool pending;
+} rtems_blkdev_read_ahead_stream;
+
+/**
+ * @brief Block device read-ahead control.
+ */
+typedef struct {
+  /**
+   * @brief Chain node for the read-ahead request queue of the read-ahead task.
+   *
+   * The disk is on the queue while a read-ahead request of a stream is
+   * pending.
+   */
+  rtems_chain_node node;
+
+  /**
+   * @brief Sequential read streams of this disk.
+   *
+   * The streams are ordered from the most to the least recently used one.  A
+   * read miss which does not continue a stream replaces the least recently
+   * used stream.
+   */
+  rtems_blkdev_read_ahead_stream streams[RTEMS_DISK_READ_AHEAD_STREAM_COUNT];
 } rtems_blkdev_read_ahead;
 
+/**
+ * @brief Block device swapout control.
+ *
+ * The block device buffer keeps the modified buffers of each disk in lists of
+ * the disk.  This allows the swapout task to write the buffers of different
+ * disks in parallel by means of the swapout workers and a sync of one disk
+ * does not block the writes to other disks.
+ */
+typedef struct {
+  /**
+   * @brief Chain node for the device chain of the swapout task.
+   *
+   * The disk is on this chain while it has modified buffers or a sync is
+   * active.
+   */
+  rtems_chain_node node;
+
+  /**
+   * @brief Modified buffers of this disk.
+   */
+  rtems_chain_control modified;
+
+  /**
+   * @brief Buffers of this disk to sync.
+   */
+  rtems_chain_control sync;
+
+  /**
+   * @brief Sync lock of this disk.
+   *
+   * A sync of this disk blocks further writes to this disk.
+   */
+  rtems_mutex sync_lock;
+
+  /**
+   * @brief The task to wake up when the sync is done.
+   */
+  rtems_id sync_requester;
+
+  /**
+   * @brief Indicates that a sync of this disk is active.
+   */
+  bool sync_active;
+
+  /**
+   * @brief Indicates that a write transfer of this disk is in progress.
+   *
+   * There is at most one write transfer of a disk at a time.
+   */
+  bool transfer_active;
+} rtems_blkdev_swapout;
+
 /**
  * @brief Block device statistics.
  *
@@ -164,6 +255,23 @@ typedef struct {
    * Error count of transfers issued by write requests.
    */
   uint32_t write_errors;
+
+  /**
+   * @brief Read-ahead hit count.
+   *
+   * A read-ahead hit occurs in the rtems_bdbuf_read() function in case the
+   * block was read by a read-ahead transfer and is accessed for the first
+   * time.
+   */
+  uint32_t read_ahead_hits;
+
+  /**
+   * @brief Read-ahead miss count.
+   *
+   * A read-ahead miss occurs in case a block read by a read-ahead transfer is
+   * recycled or discarded before it was accessed.
+   */
+  uint32_t read_ahead_misses;
 } rtems_blkdev_stats;
 
 /**
@@ -290,6 +398,29 @@ struct rtems_disk_device {
    * @brief Read-ahead control for this disk.
    */
   rtems_blkdev_read_ahead read_ahead;
+
+  /**
+   * @brief Swapout control for this disk.
+   */
+  rtems_blkdev_swapout swapout;
+
+  /**
+   * @brief Hash table of the buffers of this disk in the block device buffer
+   * cache.
+   *
+   * The buffers are hashed by their media block number.
+   *
+   * @see rtems_bdbuf_set_block_size() and rtems_bdbuf_destroy_dev().
+   */
+  struct rtems_bdbuf_buffer **bd_hash;
+
+  /**
+   * @brief Shift to get the hash table bucket index from the hash value of a
+   * media block number.
+   *
+   * The hash table has 2 to the power of 32 minus this shift buckets.
+   */
+  uint32_t bd_hash_shift;
 };
 
 /**
@@ -226,6 +226,27 @@ struct rtems_dosfs_convert_control {
  */
 #define RTEMS_DOSFS_SEMAPHORES_PER_INSTANCE 1
 
+/**
+ * @brief The current version of the FAT filesystem mount options.
+ *
+ * @see rtems_dosfs_mount_options::version.
+ */
+#define RTEMS_DOSFS_MOUNT_OPTIONS_VERSION 0x46415401U
+
+/**
+ * @brief Use an in-memory map of the free clusters.
+ *
+ * In case this mount flag is set, then a bitmap of the free clusters is
+ * allocated at mount time.  It is built from the file allocation table in
+ * small steps by the first cluster allocations and file system statistics
+ * requests.  The file allocation table is scanned for free clusters until the
+ * map is complete.  Afterwards, free clusters are found without a scan of
+ * the file allocation table and the free cluster count is always known.  The
+ * map needs one bit per data cluster.  In case the map cannot be allocated,
+ * then the file allocation table is scanned as usual.
+ */
+#define RTEMS_DOSFS_FREE_CLUSTER_MAP 0x1U
+
 /**
  * @brief FAT filesystem mount options.
  */
@@ -313,6 +334,20 @@ typedef struct {
    * rtems_dosfs_create_utf8_converter().
    */
   rtems_dosfs_convert_control *converter;
+
+  /**
+   * @brief The version of the mount options.
+   *
+   * The members following this member are only used if this member is
+   * #RTEMS_DOSFS_MOUNT_OPTIONS_VERSION.  Mount options which are not cleared
+   * before the converter is set keep working.
+   */
+  uint32_t version;
+
+  /**
+   * @brief The mount flags, for example #RTEMS_DOSFS_FREE_CLUSTER_MAP.
+   */
+  uint32_t flags;
 } rtems_dosfs_mount_options;
 
 /**
@@ -63,6 +63,8 @@ typedef struct _rtems_filesystem_file_handlers_r
     rtems_filesystem_file_handlers_r;
 typedef struct _rtems_filesystem_operations_table
     rtems_filesystem_operations_table;
+typedef struct rtems_filesystem_lookup_cache
+    rtems_filesystem_lookup_cache;
 
 /**
  * @brief File system location.
@@ -112,6 +112,27 @@ typedef block_p *block_ptr;
 #define IMFS_MEMFILE_MAXIMUM_SIZE \
   (LAST_TRIPLY_INDIRECT * IMFS_MEMFILE_BYTES_PER_BLOCK)
 
+/**
+ *  IMFS "chunkfile" information
+ *
+ *  The chunk files are an alternative to the memfiles for large files.  The
+ *  file data is stored in chunks of IMFS_CHUNKFILE_CHUNK_SIZE bytes and the
+ *  chunk of a file offset is found in a flat chunk table indexed by the offset
+ *  shifted by IMFS_CHUNKFILE_CHUNK_SHIFT.  Chunks which were never written are
+ *  not allocated and read as zeros.  Bytes of an allocated chunk past the end
+ *  of the file are always zero so a file is extended by setting its size.
+ *
+ *  The chunks are allocated from the heap aligned on their size.  Released
+ *  chunks are kept in a pool of at most IMFS_CHUNKFILE_POOL_MAXIMUM chunks
+ *  shared by all chunk files to be reused before new chunks are allocated
+ *  from the heap.
+ */
+#define IMFS_CHUNKFILE_CHUNK_SHIFT 12
+
+#define IMFS_CHUNKFILE_CHUNK_SIZE (1U << IMFS_CHUNKFILE_CHUNK_SHIFT)
+
+#define IMFS_CHUNKFILE_POOL_MAXIMUM 16
+
 /** @} */
 
 /**
@@ -307,6 +328,7 @@ typedef struct {
 typedef struct {
   IMFS_jnode_t Node;
   size_t       size;             /* size of file in bytes */
+  unsigned int mapping_count;    /* shared mappings of a linear file */
 } IMFS_filebase_t;
 
 typedef struct {
@@ -316,6 +338,12 @@ typedef struct {
   block_ptr       triply_indirect;  /* 128 doubly indirect blocks */
 } IMFS_memfile_t;
 
+typedef struct {
+  IMFS_filebase_t File;
+  block_p        *chunks;           /* chunk table, NULL entries are holes */
+  size_t          chunk_count;      /* number of chunk table entries */
+} IMFS_chunkfile_t;
+
 typedef struct {
   IMFS_filebase_t File;
   block_p         direct;           /* pointer to file image */
@@ -326,6 +354,7 @@ typedef union {
   IMFS_jnode_t      Node;
   IMFS_filebase_t   File;
   IMFS_memfile_t    Memfile;
+  IMFS_chunkfile_t  Chunkfile;
   IMFS_linearfile_t Linearfile;
 } IMFS_file_t;
 
@@ -397,6 +426,7 @@ extern const IMFS_mknod_control IMFS_mknod_control_dir_default;
 extern const IMFS_mknod_control IMFS_mknod_control_dir_minimal;
 extern const IMFS_mknod_control IMFS_mknod_control_device;
 extern const IMFS_mknod_control IMFS_mknod_control_memfile;
+extern const IMFS_mknod_control IMFS_mknod_control_chunkfile;
 extern const IMFS_node_control IMFS_node_control_linfile;
 extern const IMFS_mknod_control IMFS_mknod_control_fifo;
 extern const IMFS_mknod_control IMFS_mknod_control_enosys;
@@ -885,6 +915,37 @@ extern ssize_t IMFS_memfile_write(
 
 /** @} */
 
+/**
+ * @name IMFS Chunk File Handlers
+ *
+ * This section contains the set of handlers used to process operations on
+ * IMFS chunk file nodes.  The chunk files are selected for an IMFS instance
+ * through the file mknod control of the mount data or with the
+ * RTEMS_FILESYSTEM_TYPE_IMFS_CHUNKFILE file system type.
+ */
+/**@{*/
+
+/**
+ * @brief IMFS initialization with chunk files.
+ *
+ * This is the mount handler of the RTEMS_FILESYSTEM_TYPE_IMFS_CHUNKFILE file
+ * system type.  It mounts an IMFS instance which creates regular files as
+ * chunk files.  The mount data is ignored.
+ */
+extern int IMFS_chunkfile_initialize(
+  rtems_filesystem_mount_table_entry_t *mt_entry,
+  const void                           *data
+);
+
+extern ssize_t IMFS_chunkfile_write(
+  IMFS_chunkfile_t    *chunkfile,
+  off_t                start,
+  const unsigned char *source,
+  size_t               length
+);
+
+/** @} */
+
 /**
  * @name IMFS Device Node Handlers
  *
@@ -581,6 +581,47 @@ int rtems_jffs2_compressor_zlib_decompress(
   uint32_t datalen
 );
 
+/**
+ * @brief Count of FastLZ compressor hash table entries.
+ */
+#define RTEMS_JFFS2_COMPRESSOR_FASTLZ_HASH_SIZE 4096
+
+/**
+ * @brief FastLZ compressor control structure.
+ *
+ * The FastLZ compressor uses the FastLZ level 1 format.  It is considerably
+ * faster than the ZLIB compressor at the expense of the compression ratio.
+ * File systems using this compressor are not supported by other JFFS2
+ * implementations.
+ */
+typedef struct {
+  rtems_jffs2_compressor_control super;
+  uint16_t hash_table[RTEMS_JFFS2_COMPRESSOR_FASTLZ_HASH_SIZE];
+} rtems_jffs2_compressor_fastlz_control;
+
+/**
+ * @brief FastLZ compressor compress operation.
+ */
+uint16_t rtems_jffs2_compressor_fastlz_compress(
+  rtems_jffs2_compressor_control *self,
+  unsigned char *data_in,
+  unsigned char *cdata_out,
+  uint32_t *datalen,
+  uint32_t *cdatalen
+);
+
+/**
+ * @brief FastLZ compressor decompress operation.
+ */
+int rtems_jffs2_compressor_fastlz_decompress(
+  rtems_jffs2_compressor_control *self,
+  uint16_t comprtype,
+  unsigned char *cdata_in,
+  unsigned char *data_out,
+  uint32_t cdatalen,
+  uint32_t datalen
+);
+
 /**
  * @brief JFFS2 mount options.
  *
@@ -598,6 +639,50 @@ typedef struct {
    * The compressor is optional and this pointer may be @c NULL.
    */
   rtems_jffs2_compressor_control *compressor_control;
+
+  /**
+   * @brief Enables the erase block summary.
+   *
+   * If enabled, then a summary node is written at the end of each erase
+   * block when it is closed.  The mount scan uses the summary of a block
+   * instead of reading all its nodes.  This may considerably reduce the mount
+   * time on large flash devices.  File systems with and without summary nodes
+   * are compatible.
+   */
+  bool enable_summary;
+
+  /**
+   * @brief Priority of the garbage collection task.
+   *
+   * If this value is not zero, then a garbage collection task with this
+   * priority is created for a writeable file system instance.  The task
+   * performs garbage collection passes and erases dirty blocks ahead of
+   * demand, so that writers rarely have to do this inline.  An additional
+   * task must be configured by the application for each such instance.  In
+   * this case, rtems_jffs2_flash_control::trigger_garbage_collection is not
+   * used after the mount.
+   */
+  rtems_task_priority gc_task_priority;
+
+  /**
+   * @brief Low watermark of free blocks for the garbage collection task.
+   *
+   * The garbage collection task starts to work if the count of free blocks
+   * drops below this value.  If this value is zero, then the task starts to
+   * work one block above the threshold which triggers an inline garbage
+   * collection in writers.  In any case, the task works if the JFFS2 garbage
+   * collection trigger conditions are met.
+   */
+  uint32_t gc_free_blocks_low_watermark;
+
+  /**
+   * @brief High watermark of free blocks for the garbage collection task.
+   *
+   * Once started, the garbage collection task works until the count of free
+   * blocks reaches this value or there is not enough dirty space left.  A
+   * value less than the low watermark is replaced by the low watermark.
+   */
+  uint32_t gc_free_blocks_high_watermark;
 } rtems_jffs2_mount_data;
 
 /**
@@ -734,6 +819,54 @@ typedef struct {
  */
 #define RTEMS_JFFS2_FORCE_GARBAGE_COLLECTION _IO('F', 3)
 
+/**
+ * @brief JFFS2 garbage collection statistics.
+ *
+ * @see RTEMS_JFFS2_GET_GC_STATS.
+ */
+typedef struct {
+  /**
+   * @brief Count of garbage collection passes carried out by the garbage
+   * collection task.
+   *
+   * @see rtems_jffs2_mount_data::gc_task_priority.
+   */
+  uint32_t background_passes;
+
+  /**
+   * @brief Time in nanoseconds spent by the garbage collection task in
+   * garbage collection passes.
+   */
+  uint64_t background_time;
+
+  /**
+   * @brief Count of garbage collection passes carried out inline by writers
+   * which ran out of free blocks.
+   *
+   * Each of these passes stalled a write operation.
+   */
+  uint32_t write_stalls;
+
+  /**
+   * @brief Time in nanoseconds spent by writers in inline garbage collection
+   * passes.
+   */
+  uint64_t write_stall_time;
+
+  /**
+   * @brief Maximum time in nanoseconds of an inline garbage collection pass.
+   */
+  uint64_t write_stall_time_max;
+} rtems_jffs2_gc_stats;
+
+/**
+ * @brief IO control to get the garbage collection statistics of a JFFS2
+ * filesystem instance.
+ *
+ * @see rtems_jffs2_gc_stats.
+ */
+#define RTEMS_JFFS2_GET_GC_STATS _IOR('F', 4, rtems_jffs2_gc_stats)
+
 /**
  * Default delayed-write servicing task priority.
  */
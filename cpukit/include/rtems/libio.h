@@ -483,6 +483,23 @@ typedef int (*rtems_filesystem_statvfs_t)(
   struct statvfs *buf
 );
 
+/**
+ * @brief Gets the lookup cache key of a node.
+ *
+ * The key identifies the node within the file system instance as long as the
+ * node exists.  File systems which create a lookup cache for an instance must
+ * provide this handler, see rtems_filesystem_lookup_cache_create().  It is
+ * used to invalidate the cache entries in case of name space changes.  Other
+ * file systems may set it to NULL.
+ *
+ * @param[in] loc The location of a node.
+ *
+ * @return The lookup cache key of the node.
+ */
+typedef uintptr_t (*rtems_filesystem_lookup_cache_key_t)(
+  const rtems_filesystem_location_info_t *loc
+);
+
 /**
  * @brief File system operations table.
  */
@@ -506,6 +523,7 @@ struct _rtems_filesystem_operations_table {
   rtems_filesystem_readlink_t readlink_h;
   rtems_filesystem_rename_t rename_h;
   rtems_filesystem_statvfs_t statvfs_h;
+  rtems_filesystem_lookup_cache_key_t lookup_cache_key_h;
 };
 
 /**
@@ -845,6 +863,57 @@ typedef ssize_t (*rtems_filesystem_writev_t)(
   ssize_t             total
 );
 
+/**
+ * @brief Borrowed file data.
+ *
+ * @see RTEMS_FILIO_BORROW and RTEMS_FILIO_RELEASE.
+ */
+typedef struct {
+  /**
+   * @brief The borrowed file data.
+   */
+  const void *data;
+
+  /**
+   * @brief On input the maximum size, on output the size of the borrowed file
+   * data in bytes.
+   *
+   * An input value of zero requests the data up to the end of the file system
+   * block.  An output value of zero indicates the end of file.
+   */
+  size_t size;
+
+  /**
+   * @brief The file system specific handle to release the borrowed data.
+   */
+  void *handle;
+} rtems_filio_borrow;
+
+/**
+ * @brief IO control to borrow file data directly from the file system block
+ * buffer.
+ *
+ * The file data at the file offset up to the end of the file system block is
+ * provided without a copy.  The file offset is advanced by the size of the
+ * borrowed data.  The block buffer is pinned until the data is released by
+ * RTEMS_FILIO_RELEASE or the file is closed.  Writes and truncations of the
+ * file may change the borrowed data.  File systems which do not support this
+ * IO control return an error status and set the errno to ENOTTY.  If the file
+ * descriptor is not open for reading, an error status is returned and the
+ * errno is set to EBADF.
+ *
+ * The argument is a pointer to a rtems_filio_borrow object.
+ */
+#define RTEMS_FILIO_BORROW _IOWR('b', 1, rtems_filio_borrow)
+
+/**
+ * @brief IO control to release file data borrowed by RTEMS_FILIO_BORROW.
+ *
+ * The argument is a pointer to the rtems_filio_borrow object used to borrow
+ * the data.
+ */
+#define RTEMS_FILIO_RELEASE _IOW('b', 2, rtems_filio_borrow)
+
 /**
  * @brief IO control of a node.
  *
@@ -1015,6 +1084,27 @@ typedef int (*rtems_filesystem_mmap_t)(
   off_t off
 );
 
+/**
+ * @brief MUNMAP support.
+ *
+ * The mmap() keeps a clone of the file location for each shared mapping
+ * established by the MMAP handler.  This handler is called by munmap() before
+ * the location is freed.  It is called with the file system instance lock
+ * held.  The handler is optional, munmap() skips a NULL handler, so handler
+ * tables which predate it keep working.
+ *
+ * @param[in] loc The location of the mapped file.
+ * @param[in] addr The starting address of the mapped memory.
+ * @param[in] len The number of bytes mapped.
+ *
+ * @see rtems_filesystem_default_munmap().
+ */
+typedef void (*rtems_filesystem_munmap_t)(
+  const rtems_filesystem_location_info_t *loc,
+  void *addr,
+  size_t len
+);
+
 /**
  * @brief File system node operations table.
  */
@@ -1035,6 +1125,7 @@ struct _rtems_filesystem_file_handlers_r {
   rtems_filesystem_readv_t readv_h;
   rtems_filesystem_writev_t writev_h;
   rtems_filesystem_mmap_t mmap_h;
+  rtems_filesystem_munmap_t munmap_h;
 };
 
 /**
@@ -1271,6 +1362,19 @@ int rtems_filesystem_default_mmap(
   off_t off
 );
 
+/**
+ * @brief Default MUNMAP handler.
+ *
+ * This handler does nothing.
+ *
+ * @see rtems_filesystem_munmap_t.
+ */
+void rtems_filesystem_default_munmap(
+  const rtems_filesystem_location_info_t *loc,
+  void *addr,
+  size_t len
+);
+
 /** @} */
 
 /**
@@ -1607,6 +1711,7 @@ extern int rtems_mkdir(const char *path, mode_t mode);
 /**@{**/
 
 #define RTEMS_FILESYSTEM_TYPE_IMFS "imfs"
+#define RTEMS_FILESYSTEM_TYPE_IMFS_CHUNKFILE "imfschunkfile"
 #define RTEMS_FILESYSTEM_TYPE_FTPFS "ftpfs"
 #define RTEMS_FILESYSTEM_TYPE_TFTPFS "tftpfs"
 #define RTEMS_FILESYSTEM_TYPE_NFS "nfs"
@@ -1658,6 +1763,13 @@ struct rtems_filesystem_mount_table_entry_tt {
    * @see ClassicEventTransient.
    */
   rtems_id                               unmount_task;
+
+  /**
+   * The optional path lookup cache of the file system instance.
+   *
+   * @see rtems_filesystem_lookup_cache_create().
+   */
+  rtems_filesystem_lookup_cache         *lookup_cache;
 };
 
 /**
@@ -1743,6 +1855,7 @@ int unmount(
  * - RTEMS_FILESYSTEM_TYPE_DOSFS,
  * - RTEMS_FILESYSTEM_TYPE_FTPFS,
  * - RTEMS_FILESYSTEM_TYPE_IMFS,
+ * - RTEMS_FILESYSTEM_TYPE_IMFS_CHUNKFILE,
  * - RTEMS_FILESYSTEM_TYPE_JFFS2,
  * - RTEMS_FILESYSTEM_TYPE_NFS,
  * - RTEMS_FILESYSTEM_TYPE_RFS, or
@@ -1754,6 +1867,7 @@ int unmount(
  * - CONFIGURE_FILESYSTEM_DOSFS,
  * - CONFIGURE_FILESYSTEM_FTPFS,
  * - CONFIGURE_FILESYSTEM_IMFS,
+ * - CONFIGURE_FILESYSTEM_IMFS_CHUNKFILE,
  * - CONFIGURE_FILESYSTEM_JFFS2,
  * - CONFIGURE_FILESYSTEM_NFS,
  * - CONFIGURE_FILESYSTEM_RFS, and
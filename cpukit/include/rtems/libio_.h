@@ -962,6 +962,172 @@ int rtems_filesystem_location_exists_in_same_instance_as(
   const rtems_filesystem_location_info_t *b
 );
 
+/**
+ * @brief Maximum length of a name stored in the path lookup cache.
+ *
+ * Longer names are not cached.
+ */
+#define RTEMS_FILESYSTEM_LOOKUP_CACHE_NAME_MAX 31
+
+/**
+ * @brief Path lookup cache find status.
+ */
+typedef enum {
+  RTEMS_FILESYSTEM_LOOKUP_CACHE_MISS,
+  RTEMS_FILESYSTEM_LOOKUP_CACHE_POSITIVE,
+  RTEMS_FILESYSTEM_LOOKUP_CACHE_NEGATIVE
+} rtems_filesystem_lookup_cache_status;
+
+/**
+ * @brief Path lookup cache statistics.
+ */
+typedef struct {
+  uint32_t hits;
+  uint32_t negative_hits;
+  uint32_t misses;
+  uint32_t invalidations;
+} rtems_filesystem_lookup_cache_stats;
+
+/**
+ * @brief Creates the path lookup cache of a file system instance.
+ *
+ * The path lookup cache maps a directory key and a name to either a node or
+ * the information that the name does not exist in the directory.  The file
+ * system evaluate token handler uses rtems_filesystem_lookup_cache_find() and
+ * rtems_filesystem_lookup_cache_enter() to avoid directory lookups.  The
+ * rename(), unlink(), rmdir(), link(), symlink() and mknod() implementations
+ * invalidate the affected entries through the lookup cache key handler of the
+ * file system operations table, which must not be NULL.  The cache is
+ * destroyed by the unmount of the file system instance.  All cache operations
+ * must be performed with the file system instance lock held.
+ *
+ * @param[in] mt_entry The file system instance.
+ * @param[in] entry_count The count of cache entries.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred.  The errno is set to indicate the error.
+ */
+int rtems_filesystem_lookup_cache_create(
+  rtems_filesystem_mount_table_entry_t *mt_entry,
+  size_t entry_count
+);
+
+/**
+ * @brief Destroys the path lookup cache of a file system instance.
+ *
+ * @param[in] mt_entry The file system instance.
+ */
+void rtems_filesystem_lookup_cache_destroy(
+  rtems_filesystem_mount_table_entry_t *mt_entry
+);
+
+/**
+ * @brief Looks up a name in the path lookup cache.
+ *
+ * @param[in] mt_entry The file system instance.
+ * @param[in] dir_key The lookup cache key of the directory.
+ * @param[in] name The name.
+ * @param[in] namelen The length of the name in characters.
+ * @param[out] node The first node value of a positive entry.
+ * @param[out] node_2 The second node value of a positive entry.
+ *
+ * @retval RTEMS_FILESYSTEM_LOOKUP_CACHE_MISS The cache has no entry for the
+ *   name or the file system instance has no cache.
+ * @retval RTEMS_FILESYSTEM_LOOKUP_CACHE_POSITIVE The name exists.
+ * @retval RTEMS_FILESYSTEM_LOOKUP_CACHE_NEGATIVE The name does not exist.
+ */
+rtems_filesystem_lookup_cache_status rtems_filesystem_lookup_cache_find(
+  rtems_filesystem_mount_table_entry_t *mt_entry,
+  uintptr_t dir_key,
+  const char *name,
+  size_t namelen,
+  uintptr_t *node,
+  uintptr_t *node_2
+);
+
+/**
+ * @brief Enters the result of a directory lookup into the path lookup cache.
+ *
+ * The least recently used entry is replaced if necessary.  Nothing is done if
+ * the file system instance has no cache or the name is too long.
+ *
+ * @param[in] mt_entry The file system instance.
+ * @param[in] dir_key The lookup cache key of the directory.
+ * @param[in] name The name.
+ * @param[in] namelen The length of the name in characters.
+ * @param[in] positive Indicates if the name exists.
+ * @param[in] node The first node value of a positive entry.  It must be the
+ *   lookup cache key of the node.
+ * @param[in] node_2 The second node value of a positive entry.
+ */
+void rtems_filesystem_lookup_cache_enter(
+  rtems_filesystem_mount_table_entry_t *mt_entry,
+  uintptr_t dir_key,
+  const char *name,
+  size_t namelen,
+  bool positive,
+  uintptr_t node,
+  uintptr_t node_2
+);
+
+/**
+ * @brief Invalidates the path lookup cache entry of a name in a directory.
+ *
+ * Used before a new name is created in the directory.
+ *
+ * @param[in] parentloc The location of the directory.
+ * @param[in] name The name.
+ * @param[in] namelen The length of the name in characters.
+ */
+void rtems_filesystem_lookup_cache_invalidate_name(
+  const rtems_filesystem_location_info_t *parentloc,
+  const char *name,
+  size_t namelen
+);
+
+/**
+ * @brief Invalidates the path lookup cache entries of a node.
+ *
+ * Invalidates all entries of the directory referring to the node and all
+ * entries of the node itself.  Used before the node is removed from the
+ * directory.
+ *
+ * @param[in] parentloc The location of the directory.
+ * @param[in] loc The location of the node.
+ */
+void rtems_filesystem_lookup_cache_invalidate_node(
+  const rtems_filesystem_location_info_t *parentloc,
+  const rtems_filesystem_location_info_t *loc
+);
+
+/**
+ * @brief Invalidates the positive path lookup cache entries of a directory.
+ *
+ * Used by file systems which store the position of an entry in the directory
+ * as the second node value after an entry was removed from the directory,
+ * since this may move the other entries of the directory.
+ *
+ * @param[in] parentloc The location of the directory.
+ */
+void rtems_filesystem_lookup_cache_invalidate_dir(
+  const rtems_filesystem_location_info_t *parentloc
+);
+
+/**
+ * @brief Gets the path lookup cache statistics of a file system instance.
+ *
+ * @param[in] mt_entry The file system instance.
+ * @param[out] stats The statistics.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 The file system instance has no cache.  The errno is set to
+ *   ENOTSUP.
+ */
+int rtems_filesystem_lookup_cache_get_stats(
+  const rtems_filesystem_mount_table_entry_t *mt_entry,
+  rtems_filesystem_lookup_cache_stats *stats
+);
+
 /**
  * @brief Checks if access to an object is allowed for the current user.
  *
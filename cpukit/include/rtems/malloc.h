@@ -70,6 +70,120 @@ extern Heap_Control *RTEMS_Malloc_Heap;
 
 void _Malloc_Initialize( void );
 
+/**
+ * @brief The segregated free list index storage of the C program heap.
+ *
+ * This object is defined by the application configuration option
+ * #CONFIGURE_MALLOC_FREE_INDEX via <rtems/confdefs.h>.
+ */
+extern Heap_Free_index _Malloc_Free_index;
+
+/**
+ * @brief Enables the segregated free list index for the C program heap.
+ *
+ * @see _Heap_Free_index_enable().
+ */
+void _Malloc_Enable_free_index( void );
+
+/**
+ * @brief The count of size classes of the per-processor caches of the C
+ *   program heap.
+ */
+#define MALLOC_PER_CPU_CACHE_CLASS_COUNT 8
+
+/**
+ * @brief The size class granularity of the per-processor caches of the C
+ *   program heap in bytes.
+ *
+ * Size class i caches blocks with an allocatable size of at least
+ * ( i + 1 ) * MALLOC_PER_CPU_CACHE_CLASS_SIZE bytes.
+ */
+#define MALLOC_PER_CPU_CACHE_CLASS_SIZE 32
+
+/**
+ * @brief This structure contains the small object cache of the C program heap
+ *   for one processor.
+ *
+ * The cached blocks are allocated from the C program heap.  They are handed
+ * out by malloc() and taken back by free() without obtaining the allocator
+ * mutex.  Blocks are moved between the cache and the heap in batches.  The
+ * structure is cache line aligned to prevent false sharing between
+ * processors.
+ *
+ * The cached blocks are allocated from the view of the heap.  The heap
+ * statistics, malloc_info(), and _Heap_Walk() count them as used blocks.
+ */
+typedef struct Malloc_Per_CPU_cache {
+  /**
+   * @brief The count of cached blocks for each size class.
+   */
+  uint32_t count[ MALLOC_PER_CPU_CACHE_CLASS_COUNT ];
+
+  /**
+   * @brief The cached blocks.
+   *
+   * The blocks of size class i start at index
+   * i * _Malloc_Per_CPU_cache_capacity.
+   */
+  void **blocks;
+} RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) Malloc_Per_CPU_cache;
+
+/**
+ * @brief The per-processor caches of the C program heap.
+ *
+ * This object is defined by the application configuration option
+ * #CONFIGURE_MALLOC_PER_CPU_CACHE via <rtems/confdefs.h>.
+ */
+extern Malloc_Per_CPU_cache _Malloc_Per_CPU_caches[];
+
+/**
+ * @brief The block storage of the per-processor caches of the C program heap.
+ *
+ * This object is defined by the application configuration option
+ * #CONFIGURE_MALLOC_PER_CPU_CACHE via <rtems/confdefs.h>.
+ */
+extern void *_Malloc_Per_CPU_cache_blocks[];
+
+/**
+ * @brief The maximum count of cached blocks for each size class and
+ *   processor.
+ *
+ * This object is defined by the application configuration option
+ * #CONFIGURE_MALLOC_PER_CPU_CACHE via <rtems/confdefs.h>.
+ */
+extern const uint32_t _Malloc_Per_CPU_cache_capacity;
+
+/**
+ * @brief Attaches the per-processor caches of the C program heap to the
+ *   configured processors.
+ */
+void _Malloc_Initialize_per_CPU_caches( void );
+
+/**
+ * @brief Tries to allocate a block from the cache of the current processor.
+ *
+ * @param size The size in bytes to allocate.
+ *
+ * @retval NULL The size is not cacheable or the cache could not be refilled.
+ *
+ * @return Returns the begin of the allocated memory area.
+ */
+void *_Malloc_Per_CPU_cache_allocate( size_t size );
+
+/**
+ * @brief Tries to give a block back to the cache of the current processor.
+ *
+ * A block which is already in the cache of a processor results in a fatal
+ * error with the RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE source.
+ *
+ * @param ptr The begin of the memory area to free.
+ *
+ * @retval true The block was taken by the cache.
+ *
+ * @retval false The block is not cacheable and shall be freed to the heap.
+ */
+bool _Malloc_Per_CPU_cache_free( void *ptr );
+
 typedef void *(*rtems_heap_extend_handler)(
   Heap_Control *heap,
   size_t alloc_size
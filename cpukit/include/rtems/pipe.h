@@ -53,6 +53,43 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Maximum size of a pipe buffer in bytes.
+ */
+#define PIPE_BUFFER_SIZE_MAX (1024U * 1024U)
+
+/**
+ * @brief IO control to set the buffer size of a pipe.
+ *
+ * The argument is a pointer to an unsigned int with the requested size in
+ * bytes.  It is rounded up to a power of two which is at least PIPE_BUF.  The
+ * pipe must be empty and must not use the single-producer/single-consumer
+ * mode.
+ */
+#define PIPE_SET_BUFFER_SIZE _IOW('P', 1, unsigned int)
+
+/**
+ * @brief IO control to get the buffer size of a pipe.
+ *
+ * The argument is a pointer to an unsigned int which receives the size in
+ * bytes.
+ */
+#define PIPE_GET_BUFFER_SIZE _IOR('P', 2, unsigned int)
+
+/**
+ * @brief IO control to enable the single-producer/single-consumer mode of a
+ * pipe.
+ *
+ * In this mode, data is transferred through the pipe buffer without taking the
+ * pipe mutex.  The mutex is only used to block the reader on an empty and the
+ * writer on a full pipe.  The pipe must have at most one reader and at most
+ * one writer, further opens for reading or writing fail with EBUSY.  The mode
+ * stays enabled until the pipe is released.  The application must ensure that
+ * at most one task reads from and at most one task writes to the pipe at a
+ * time.
+ */
+#define PIPE_ENABLE_SPSC _IO('P', 3)
+
 /* Control block to manage each pipe */
 typedef struct pipe_control {
   char *Buffer;
@@ -68,6 +105,11 @@ typedef struct pipe_control {
   rtems_mutex Mutex;
   rtems_condition_variable readBarrier;   /* wait queues */
   rtems_condition_variable writeBarrier;
+  Atomic_Uint Spsc;       /* lock-free single-producer/single-consumer mode */
+  Atomic_Uint Head;       /* free-running write index in SPSC mode */
+  Atomic_Uint Tail;       /* free-running read index in SPSC mode */
+  Atomic_Uint spscWaitingReader;
+  Atomic_Uint spscWaitingWriter;
 #if 0
   boolean Anonymous;      /* anonymous pipe or FIFO */
 #endif
@@ -54,6 +54,15 @@ typedef struct mmap_mappings_s {
   size_t             len;   /**< The length of memory mapped */
   int                flags; /**< The mapping flags */
   POSIX_Shm_Control *shm;   /**< The shared memory object or NULL */
+
+  /**
+   * @brief The file location of a shared mapping established by the MMAP
+   *   handler.
+   *
+   * This clone of the file location keeps the file node until munmap().  For
+   * other mappings the mount table entry is NULL.
+   */
+  rtems_filesystem_location_info_t location;
 } mmap_mapping;
 
 extern rtems_chain_control mmap_mappings;
@@ -304,6 +304,31 @@ int rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
                                 bool*                     allocate,
                                 rtems_rfs_bitmap_bit*     bit);
 
+/**
+ * Find and allocate a run of up to count consecutive free bits. The search
+ * moves up from the seed to the end of the map then from the start of the map
+ * to the seed. A run starting at the seed is preferred so bits allocated in
+ * succession are grouped together, then a run of count bits close to the
+ * first free bit found. If no run of count bits is found the first run is
+ * allocated. Elements are searched a word at a time and the search map is
+ * used to skip elements with no free bits.
+ *
+ * @param[in] control is the map control.
+ * @param[in] seed is the bit to search up from.
+ * @param[in] count is the number of bits wanted.
+ * @param[out] bit will contain the first bit allocated.
+ * @param[out] allocated will contain the number of bits allocated. It is 0 if
+ *             there are no free bits.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_bitmap_map_alloc_extent (rtems_rfs_bitmap_control* control,
+                                       rtems_rfs_bitmap_bit      seed,
+                                       size_t                    count,
+                                       rtems_rfs_bitmap_bit*     bit,
+                                       size_t*                   allocated);
+
 /**
  * Create a search bit map from the actual bit map.
  *
@@ -64,6 +64,7 @@ typedef rtems_blkdev_bnum  rtems_rfs_buffer_block;
 typedef rtems_bdbuf_buffer rtems_rfs_buffer;
 #define rtems_rfs_buffer_io_request rtems_rfs_buffer_bdbuf_request
 #define rtems_rfs_buffer_io_release rtems_rfs_buffer_bdbuf_release
+#define rtems_rfs_buffer_io_read_blocks rtems_rfs_buffer_bdbuf_read_blocks
 
 /**
  * Request a buffer from the RTEMS libblock BD buffer cache.
@@ -77,6 +78,14 @@ int rtems_rfs_buffer_bdbuf_request (rtems_rfs_file_system* fs,
  */
 int rtems_rfs_buffer_bdbuf_release (rtems_rfs_buffer* handle,
                                     bool              modified);
+/**
+ * Read consecutive blocks from the RTEMS libblock BD buffer cache into a
+ * buffer.
+ */
+int rtems_rfs_buffer_bdbuf_read_blocks (rtems_rfs_file_system* fs,
+                                        rtems_rfs_buffer_block block,
+                                        size_t                 count,
+                                        void*                  data);
 #else /* Device I/O */
 typedef uint32_t rtems_rfs_buffer_block;
 typedef struct _rtems_rfs_buffer
@@ -104,6 +113,40 @@ int rtems_rfs_buffer_deviceio_release (rtems_rfs_buffer* handle,
                                        bool              modified);
 #endif
 
+/**
+ * The minimum number of entries in the index of held buffers.
+ */
+#define RTEMS_RFS_BUFFER_INDEX_MIN_SIZE (16)
+
+/**
+ * An entry in the index of the buffers held by the file system. The index
+ * holds the buffers attached to handles and the buffers in the local cache of
+ * released buffers.
+ */
+typedef struct _rtems_rfs_buffer_index_entry
+{
+  /**
+   * The buffer or NULL if the entry is not used.
+   */
+  rtems_rfs_buffer* buffer;
+
+  /**
+   * The block number of the buffer.
+   */
+  rtems_rfs_buffer_block block;
+
+  /**
+   * The release sequence number of a buffer in the local cache. The oldest
+   * released buffer is the least recently used.
+   */
+  uint32_t released;
+
+  /**
+   * Is the buffer on the release modified list ?
+   */
+  bool modified;
+} rtems_rfs_buffer_index_entry;
+
 /**
  * RFS Buffer handle.
  */
@@ -208,6 +251,25 @@ int rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
 int rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
                                      rtems_rfs_buffer_handle* handle);
 
+/**
+ * Read consecutive blocks into a buffer. Blocks held by a handle or in the
+ * local cache of released buffers are copied from the held buffer. The other
+ * blocks are read with as few I/O layer requests as possible and are not
+ * attached to any handle.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] block is the first block number.
+ * @param[in] count is the number of blocks to read.
+ * @param[out] data is the buffer of count times the block size bytes.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_buffer_read_blocks (rtems_rfs_file_system* fs,
+                                  rtems_rfs_buffer_block block,
+                                  size_t                 count,
+                                  void*                  data);
+
 /**
  * Open a handle.
  *
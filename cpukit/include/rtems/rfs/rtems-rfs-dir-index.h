@@ -0,0 +1,274 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @brief RTEMS File Systems Directory Index
+ *
+ * @ingroup rtems_rfs
+ *
+ * RTEMS File Systems Directory Index provides an in-memory hash table of the
+ * entries of large directories. The index maps the hash of an entry's name to
+ * the directory block holding the entry so a look up only reads the blocks
+ * that can hold the name. The index also records the free space of each
+ * directory block so adding an entry does not need to read the blocks that
+ * are full. The index is built on demand and is not stored on disk.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#if !defined (_RTEMS_RFS_DIR_INDEX_H_)
+#define _RTEMS_RFS_DIR_INDEX_H_
+
+#include <rtems/chain.h>
+
+#include <rtems/rfs/rtems-rfs-block.h>
+#include <rtems/rfs/rtems-rfs-file-system.h>
+#include <rtems/rfs/rtems-rfs-inode.h>
+
+/**
+ * The minimum number of blocks a directory needs before it is indexed. Small
+ * directories are searched faster than an index is built.
+ */
+#define RTEMS_RFS_DIR_INDEX_MIN_BLOCKS (4)
+
+/**
+ * The maximum number of directories indexed at any one time. The least
+ * recently used index is dropped when another directory is indexed.
+ */
+#define RTEMS_RFS_DIR_INDEX_MAX (8)
+
+/**
+ * The initial number of hash buckets in an index. The number is a power of 2
+ * and is doubled as entries are added.
+ */
+#define RTEMS_RFS_DIR_INDEX_BUCKETS (64)
+
+/**
+ * The end of a hash bucket chain.
+ */
+#define RTEMS_RFS_DIR_INDEX_NONE (UINT32_MAX)
+
+/**
+ * An entry in a directory index.
+ */
+typedef struct _rtems_rfs_dir_index_entry
+{
+  /**
+   * The hash of the name of the directory entry.
+   */
+  uint32_t hash;
+
+  /**
+   * The ino of the directory entry.
+   */
+  rtems_rfs_ino ino;
+
+  /**
+   * The block in the directory holding the directory entry.
+   */
+  rtems_rfs_block_no bno;
+
+  /**
+   * The next entry in the hash bucket or the free list.
+   */
+  uint32_t next;
+} rtems_rfs_dir_index_entry;
+
+/**
+ * The index of a directory.
+ */
+typedef struct _rtems_rfs_dir_index
+{
+  /**
+   * The index is held on the file system's list of indexes.
+   */
+  rtems_chain_node link;
+
+  /**
+   * The ino of the directory.
+   */
+  rtems_rfs_ino ino;
+
+  /**
+   * The number of hash buckets. Always a power of 2.
+   */
+  uint32_t bucket_count;
+
+  /**
+   * The first entry of each hash bucket.
+   */
+  uint32_t* buckets;
+
+  /**
+   * The entry table.
+   */
+  rtems_rfs_dir_index_entry* entries;
+
+  /**
+   * The number of entries the table can hold.
+   */
+  uint32_t entry_size;
+
+  /**
+   * The number of entries in use.
+   */
+  uint32_t entry_count;
+
+  /**
+   * The first entry of the list of free entries.
+   */
+  uint32_t entry_free;
+
+  /**
+   * The free space in bytes at the end of each directory block.
+   */
+  uint32_t* block_free;
+
+  /**
+   * The number of blocks in the directory.
+   */
+  uint32_t block_count;
+
+  /**
+   * The number of blocks the free space table can hold.
+   */
+  uint32_t block_size;
+} rtems_rfs_dir_index;
+
+/**
+ * Get the index of a directory. If the directory is not indexed and is large
+ * enough the index is built. If the directory is not indexed the index is
+ * NULL.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] map is a pointer to the open block map of the directory.
+ * @param[out] index will point to the index of the directory or NULL.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_dir_index_get (rtems_rfs_file_system* fs,
+                             rtems_rfs_block_map*   map,
+                             rtems_rfs_dir_index**  index);
+
+/**
+ * Find the index of a directory. The index is not built.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] ino is the ino of the directory.
+ *
+ * @retval index The index of the directory.
+ * @retval NULL The directory is not indexed.
+ */
+rtems_rfs_dir_index* rtems_rfs_dir_index_find (rtems_rfs_file_system* fs,
+                                               rtems_rfs_ino          ino);
+
+/**
+ * Return the next block of the directory that can hold an entry with the
+ * hash. Start with a slot of RTEMS_RFS_DIR_INDEX_NONE.
+ *
+ * @param[in] index is a pointer to the index.
+ * @param[in] hash is the hash of the name.
+ * @param[in,out] slot is the position of the search in the index.
+ * @param[out] bno will contain the block in the directory.
+ *
+ * @retval true A block was found.
+ * @retval false There are no more blocks.
+ */
+bool rtems_rfs_dir_index_next (rtems_rfs_dir_index* index,
+                               uint32_t             hash,
+                               uint32_t*            slot,
+                               rtems_rfs_block_no*  bno);
+
+/**
+ * Return the first block in the directory with more free space than the
+ * length. If no block has enough space the number of blocks is returned.
+ *
+ * @param[in] index is a pointer to the index.
+ * @param[in] length is the length of the entry.
+ *
+ * @retval bno The block in the directory.
+ */
+rtems_rfs_block_no rtems_rfs_dir_index_space (rtems_rfs_dir_index* index,
+                                              size_t               length);
+
+/**
+ * Add an entry to the index. If the block is the block after the last block
+ * the directory has grown by a block.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] index is a pointer to the index.
+ * @param[in] hash is the hash of the name.
+ * @param[in] ino is the ino of the entry.
+ * @param[in] bno is the block in the directory holding the entry.
+ * @param[in] length is the length of the entry.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_dir_index_add (rtems_rfs_file_system* fs,
+                             rtems_rfs_dir_index*   index,
+                             uint32_t               hash,
+                             rtems_rfs_ino          ino,
+                             rtems_rfs_block_no     bno,
+                             size_t                 length);
+
+/**
+ * Delete an entry from the index.
+ *
+ * @param[in] index is a pointer to the index.
+ * @param[in] hash is the hash of the name.
+ * @param[in] ino is the ino of the entry.
+ * @param[in] bno is the block in the directory holding the entry.
+ * @param[in] length is the length of the entry.
+ * @param[in] shrunk is true if the block was the last block and has been
+ *                   removed from the directory.
+ */
+void rtems_rfs_dir_index_del (rtems_rfs_dir_index* index,
+                              uint32_t             hash,
+                              rtems_rfs_ino        ino,
+                              rtems_rfs_block_no   bno,
+                              size_t               length,
+                              bool                 shrunk);
+
+/**
+ * Drop the index of a directory if the directory is indexed.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] ino is the ino of the directory.
+ */
+void rtems_rfs_dir_index_drop (rtems_rfs_file_system* fs,
+                               rtems_rfs_ino          ino);
+
+/**
+ * Drop all the indexes of the file system.
+ *
+ * @param[in] fs is the file system data.
+ */
+void rtems_rfs_dir_index_drop_all (rtems_rfs_file_system* fs);
+
+#endif
@@ -128,6 +128,10 @@ typedef int64_t rtems_rfs_pos_rel;
 #define RTEMS_RFS_FS_READ_ONLY         (1 << 3) /**< Make the mount
                                                  * read-only. Currently not
                                                  * supported. */
+#define RTEMS_RFS_FS_DIR_INDEX         (1 << 4) /**< Index large directories
+                                                 * in memory. Default is off
+                                                 * so directories are searched
+                                                 * block by block. */
 /**
  * RFS File System data.
  */
@@ -266,12 +270,46 @@ struct _rtems_rfs_file_system
    */
   uint32_t release_modified_count;
 
+  /**
+   * Index of the buffers on the buffers, release and release modified lists
+   * by block number. The index is a hash table with linear probing. It is
+   * allocated when the first buffer is requested.
+   */
+  rtems_rfs_buffer_index_entry* buffer_index;
+
+  /**
+   * Number of entries in the buffer index. Always a power of 2.
+   */
+  uint32_t buffer_index_size;
+
+  /**
+   * Number of used entries in the buffer index.
+   */
+  uint32_t buffer_index_count;
+
+  /**
+   * The release sequence number of the last buffer released to the local
+   * cache.
+   */
+  uint32_t buffer_release_seq;
+
   /**
    * List of open shared file node data. The shared node data such as the inode
    * and block map allows a single file to be open more than once.
    */
   rtems_chain_control file_shares;
 
+  /**
+   * List of the in-memory directory indexes. The most recently used index is
+   * at the head of the list.
+   */
+  rtems_chain_control dir_indexes;
+
+  /**
+   * Number of indexes on the directory indexes list.
+   */
+  uint32_t dir_index_count;
+
   /**
    * Pointer to user data supplied when opening.
    */
@@ -298,6 +336,13 @@ struct _rtems_rfs_file_system
  */
 #define rtems_rfs_fs_no_local_cache(_f) ((_f)->flags & RTEMS_RFS_FS_NO_LOCAL_CACHE)
 
+/**
+ * Are large directories indexed in memory ?
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_fs_dir_index(_f) ((_f)->flags & RTEMS_RFS_FS_DIR_INDEX)
+
 /**
  * The disk device number.
  *
@@ -198,6 +198,25 @@ rtems_rfs_file_shared_get_size (rtems_rfs_file_system* fs,
                                                   * field in the inode if
                                                   * set. */
 
+/**
+ * File data borrowed from a block buffer. The buffer handle holds a reference
+ * to the block buffer so the buffer stays in memory until the borrowed data is
+ * released.
+ */
+typedef struct _rtems_rfs_file_borrow
+{
+  /**
+   * The node of the borrowed data list of the file handle.
+   */
+  rtems_chain_node link;
+
+  /**
+   * The buffer holding the borrowed data.
+   */
+  rtems_rfs_buffer_handle buffer;
+
+} rtems_rfs_file_borrow;
+
 /**
  * File data used to managed an open file.
  */
@@ -223,6 +242,11 @@ typedef struct _rtems_rfs_file_handle
    */
   rtems_rfs_file_shared* shared;
 
+  /**
+   * The list of data borrowed through this handle.
+   */
+  rtems_chain_control borrows;
+
 } rtems_rfs_file_handle;
 
 /**
@@ -379,6 +403,62 @@ int rtems_rfs_file_io_end (rtems_rfs_file_handle* handle,
                            size_t                 size,
                            bool                   read);
 
+/**
+ * Read whole blocks of a file directly into a buffer. The read starts at the
+ * file position which must be on a block boundary and covers the blocks which
+ * are consecutive on the media so the I/O layer can read them with a single
+ * request. Nothing is read if the handle holds a buffer, the position is not
+ * on a block boundary or less than two whole blocks are available. The file
+ * position is updated by the amount read.
+ *
+ * @param[in] handle is the file handle.
+ * @param[out] data is the buffer to read into.
+ * @param[in] count is the size of the buffer.
+ * @param[out] read is the amount of data read.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_file_io_read_blocks (rtems_rfs_file_handle* handle,
+                                   void*                  data,
+                                   size_t                 count,
+                                   size_t*                read);
+
+/**
+ * Borrow the data at the file position up to the end of the block. The block
+ * buffer is referenced by the borrow so the data stays in memory until it is
+ * released with rtems_rfs_file_io_release_borrow(). The file position is
+ * updated by the amount borrowed. A borrow of zero bytes indicates the end of
+ * the file.
+ *
+ * @param[in] handle is the file handle.
+ * @param[in,out] size is the maximum amount to borrow, zero for no limit, and
+ *                returns the amount borrowed.
+ * @param[out] data is the pointer to the borrowed data.
+ * @param[out] borrow is the borrow to release the data. It is NULL at the end
+ *                    of the file.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_file_io_borrow (rtems_rfs_file_handle*  handle,
+                              size_t*                 size,
+                              const void**            data,
+                              rtems_rfs_file_borrow** borrow);
+
+/**
+ * Release data borrowed with rtems_rfs_file_io_borrow().
+ *
+ * @param[in] handle is the file handle used to borrow the data.
+ * @param[in] borrow is the borrow to release.
+ *
+ * @retval 0 Successful operation.
+ * @retval EINVAL The borrow does not belong to the file handle.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_file_io_release_borrow (rtems_rfs_file_handle* handle,
+                                      rtems_rfs_file_borrow* borrow);
+
 /**
  * Release the I/O resources without any changes. If data has changed in the
  * buffer and the buffer was not already released as modified the data will be
@@ -158,6 +158,27 @@ int rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
                                   bool                   inode,
                                   rtems_rfs_bitmap_bit*  result);
 
+/**
+ * @brief Allocate a run of consecutive blocks.
+ *
+ * The group of the goal is searched for up to count consecutive free blocks
+ * following the goal. If the group has no free blocks a single block is
+ * allocated from the other groups. A count of 1 allocates the block the same
+ * way as rtems_rfs_group_bitmap_alloc().
+ *
+ * @param fs The file system data.
+ * @param goal The last block allocated. The search starts after it.
+ * @param count The number of blocks wanted.
+ * @param result The first block allocated.
+ * @param allocated The number of blocks allocated.
+ * @retval int The error number (errno). No error if 0.
+ */
+int rtems_rfs_group_bitmap_alloc_extent (rtems_rfs_file_system* fs,
+                                         rtems_rfs_bitmap_bit   goal,
+                                         size_t                 count,
+                                         rtems_rfs_bitmap_bit*  result,
+                                         size_t*                allocated);
+
 /**
  * @brief Free the group allocated bit.
  *
@@ -580,6 +580,76 @@ rtems_status_code rtems_message_queue_send(
   size_t      size
 );
 
+/* Generated from spec:/rtems/message/if/send-multiple */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Puts multiple messages at the rear of the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of the messages to send.  The ``count``
+ *   messages of ``size`` bytes each shall be consecutive in memory.
+ *
+ * @param size is the size in bytes of each message to send.
+ *
+ * @param count is the count of messages to send.
+ *
+ * @param[out] sent is the pointer to an uint32_t object.  When the directive
+ *   call is successful or the ::RTEMS_TOO_MANY status is returned, the count
+ *   of messages sent will be stored in this object.
+ *
+ * This directive sends the ``count`` messages beginning at ``buffer`` to the
+ * queue specified by ``id`` in order.  The messages are copied to the waiting
+ * tasks first.  A task waiting in rtems_message_queue_receive_multiple()
+ * receives up to the count of messages it waits for, other waiting tasks
+ * receive one message.  The remaining messages are put at the rear of the
+ * queue while the queue is acquired only once.  Tasks unblocked by the
+ * messages are dispatched after all messages were sent.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``sent`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The ``count`` parameter was zero.
+ *
+ * @retval ::RTEMS_INVALID_SIZE The size of the messages exceeded the maximum
+ *   message size of the queue as defined by rtems_message_queue_create() or
+ *   rtems_message_queue_construct().
+ *
+ * @retval ::RTEMS_TOO_MANY The maximum number of pending messages supported by
+ *   the queue as defined by rtems_message_queue_create() or
+ *   rtems_message_queue_construct() has been reached before all messages were
+ *   sent.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive may unblock tasks.  This may cause the calling task to be
+ *   preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_send_multiple(
+  rtems_id    id,
+  const void *buffer,
+  size_t      size,
+  uint32_t    count,
+  uint32_t   *sent
+);
+
 /* Generated from spec:/rtems/message/if/urgent */
 
 /**
@@ -810,6 +880,97 @@ rtems_status_code rtems_message_queue_receive(
   rtems_interval timeout
 );
 
+/* Generated from spec:/rtems/message/if/receive-multiple */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Receives multiple messages from the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of the buffer to receive the messages.
+ *   The buffer shall be large enough to receive ``count`` messages of the
+ *   maximum length of the queue as defined by rtems_message_queue_create() or
+ *   rtems_message_queue_construct().  The message with index i is stored at
+ *   the offset of i times the maximum message size.
+ *
+ * @param[out] sizes is the begin address of an array of ``count`` size_t
+ *   objects.  When the directive call is successful, the size in bytes of
+ *   each received message will be stored in the corresponding object.
+ *
+ * @param count is the maximum count of messages to receive.
+ *
+ * @param[out] received is the pointer to an uint32_t object.  When the
+ *   directive call is successful, the count of received messages will be
+ *   stored in this object.
+ *
+ * @param option_set is the option set.
+ *
+ * @param timeout is the timeout in clock ticks if the #RTEMS_WAIT option is
+ *   set.  Use #RTEMS_NO_TIMEOUT to wait potentially forever.
+ *
+ * This directive receives up to ``count`` messages from the queue specified by
+ * ``id``.  The options and the timeout have the same meaning as for
+ * rtems_message_queue_receive().
+ *
+ * If there is at least one message in the queue, then the pending messages up
+ * to ``count`` are copied to the buffer and the directive returns immediately
+ * with the ::RTEMS_SUCCESSFUL status code.  If the queue is empty and the
+ * calling task chooses to wait, then the task blocks until a message arrives.
+ * If the task is unblocked by rtems_message_queue_send_multiple(), then it
+ * receives up to ``count`` messages of this call, otherwise it receives one
+ * message.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``sizes`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``received`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The ``count`` parameter was zero.
+ *
+ * @retval ::RTEMS_UNSATISFIED The queue was empty.
+ *
+ * @retval ::RTEMS_TIMEOUT The timeout happened while the calling task was
+ *   waiting to receive a message
+ *
+ * @retval ::RTEMS_OBJECT_WAS_DELETED The queue was deleted while the calling
+ *   task was waiting to receive a message.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * When the #RTEMS_NO_WAIT option is set, the directive may be called from
+ *   within interrupt context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * When the request cannot be immediately satisfied and the #RTEMS_WAIT
+ *   option is set, the calling task blocks at some point during the directive
+ *   call.
+ *
+ * * The timeout functionality of the directive requires a clock tick.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_receive_multiple(
+  rtems_id        id,
+  void           *buffer,
+  size_t         *sizes,
+  uint32_t        count,
+  uint32_t       *received,
+  rtems_option    option_set,
+  rtems_interval  timeout
+);
+
 /* Generated from spec:/rtems/message/if/get-number-pending */
 
 /**
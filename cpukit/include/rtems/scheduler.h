@@ -665,4 +665,74 @@
     RTEMS_SCHEDULER_TABLE_SIMPLE_SMP( name, obj_name )
 #endif
 
+/**
+ * @brief Defines a Work Stealing SMP Scheduler context name based on the
+ *   instantiation name.
+ *
+ * @param name is the scheduler instantiation name.
+ */
+#define SCHEDULER_WORK_STEALING_SMP_CONTEXT_NAME( name ) \
+  SCHEDULER_CONTEXT_NAME( work_stealing_SMP_ ## name )
+
+/**
+ * @ingroup RTEMSApplConfigGeneralSchedulerConfiguration
+ *
+ * @brief Defines a Work Stealing SMP Scheduler instantiation.
+ *
+ * @param name is the scheduler instantiation name.
+ *
+ * @param cost is the migration cost.  It is the count of priority levels a
+ *   thread of another processor shall exceed the local thread so that it is
+ *   moved to the processor.
+ *
+ * @param period is the steal period.  It is the count of thread selections
+ *   of a processor after which it checks the ready queues of the other
+ *   processors for a better thread.  Use zero to steal threads only if the
+ *   ready queue of the processor is empty.
+ */
+#define RTEMS_SCHEDULER_WORK_STEALING_SMP( name, cost, period ) \
+  static struct { \
+    Scheduler_work_stealing_SMP_Context Base; \
+    Scheduler_work_stealing_SMP_Ready_queue \
+      Ready[ CONFIGURE_MAXIMUM_PROCESSORS ]; \
+  } SCHEDULER_WORK_STEALING_SMP_CONTEXT_NAME( name ) = { \
+    .Base = { \
+      .migration_cost = ( cost ), \
+      .steal_period = ( period ) \
+    } \
+  }
+
+/**
+ * @ingroup RTEMSApplConfigGeneralSchedulerConfiguration
+ *
+ * @brief Defines a Work Stealing SMP Scheduler entry for the scheduler table.
+ *
+ * Use this macro to define an entry for the
+ * @ref CONFIGURE_SCHEDULER_TABLE_ENTRIES application configuration option.
+ *
+ * @param name is the scheduler instantiation name.
+ *
+ * @param name is the scheduler object name.
+ */
+#define RTEMS_SCHEDULER_TABLE_WORK_STEALING_SMP( name, obj_name ) \
+  { \
+    &SCHEDULER_WORK_STEALING_SMP_CONTEXT_NAME( name ).Base.Base.Base, \
+    SCHEDULER_WORK_STEALING_SMP_ENTRY_POINTS, \
+    SCHEDULER_WORK_STEALING_SMP_MAXIMUM_PRIORITY, \
+    ( obj_name ) \
+    SCHEDULER_CONTROL_IS_NON_PREEMPT_MODE_SUPPORTED( false ) \
+  }
+
+#ifdef CONFIGURE_SCHEDULER_WORK_STEALING_SMP
+  #ifndef RTEMS_SMP
+    #error "CONFIGURE_SCHEDULER_WORK_STEALING_SMP cannot be used if RTEMS_SMP is disabled"
+  #endif
+
+  #ifndef CONFIGURE_MAXIMUM_PROCESSORS
+    #error "CONFIGURE_MAXIMUM_PROCESSORS must be defined to configure the Work Stealing SMP Scheduler"
+  #endif
+
+  #include <rtems/score/schedulerworkstealingsmp.h>
+#endif
+
 #endif /* _RTEMS_SAPI_SCHEDULER_H */
@@ -334,6 +334,99 @@ Status_Control _CORE_message_queue_Seize(
   Thread_queue_Context       *queue_context
 );
 
+/**
+ * @brief Submits multiple messages to the message queue.
+ *
+ * The messages are handed over to the threads waiting to receive a message
+ * first.  Each waiting thread gets as many messages as it offered slots, see
+ * _CORE_message_queue_Seize_multiple().  The remaining messages are appended
+ * to the pending messages while message buffers are available.  The thread
+ * dispatch is deferred until all messages are submitted.
+ *
+ * The caller does not block and no notification handler is called.  This
+ * function shall be used only for message queues without blocking senders.
+ *
+ * @param[in, out] the_message_queue is the message queue to operate upon.
+ *
+ * @param buffer is the begin address of the messages to send.  The messages
+ *   are consecutive in memory.
+ *
+ * @param size is the size in bytes of each message.
+ *
+ * @param count is the count of messages to send.
+ *
+ * @param[out] sent is the count of messages which were submitted.
+ *
+ * @param queue_context is the thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL All messages were submitted.
+ *
+ * @retval STATUS_MESSAGE_INVALID_SIZE The message size was too big.
+ *
+ * @retval STATUS_TOO_MANY No message buffers were available for some of the
+ *   messages.
+ */
+Status_Control _CORE_message_queue_Submit_multiple(
+  CORE_message_queue_Control *the_message_queue,
+  const void                 *buffer,
+  size_t                      size,
+  uint32_t                    count,
+  uint32_t                   *sent,
+  Thread_queue_Context       *queue_context
+);
+
+/**
+ * @brief Seizes multiple messages from the message queue.
+ *
+ * If no message is pending and the caller is willing to wait, then the
+ * executing thread blocks.  It offers the count of slots to the senders.  A
+ * sender copies the messages to the slots before it unblocks the thread, so
+ * the message queue is not accessed after the thread was unblocked.
+ *
+ * This function shall be used only for message queues without blocking
+ * senders.
+ *
+ * @param[in, out] the_message_queue is the message queue to seize the messages
+ *   from.
+ *
+ * @param executing is the executing thread.
+ *
+ * @param[out] buffer is the begin address of the buffer to store the
+ *   messages.  The message with index i is stored at the offset of i times
+ *   the maximum message size of the message queue.
+ *
+ * @param[out] sizes is the array to store the size of each received message.
+ *
+ * @param count is the maximum count of messages to receive.  It shall be
+ *   greater than zero.
+ *
+ * @param[out] received is the count of received messages.
+ *
+ * @param wait indicates whether the calling thread is willing to block if the
+ *   message queue is empty.
+ *
+ * @param queue_context is the thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL At least one message was received.
+ *
+ * @retval STATUS_UNSATISFIED Wait was set to false and there is currently no
+ *   pending message.
+ *
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _CORE_message_queue_Seize_multiple(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                       *buffer,
+  size_t                     *sizes,
+  uint32_t                    count,
+  uint32_t                   *received,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+);
+
 /**
  * @brief Inserts a message into the message queue.
  *
@@ -667,6 +760,7 @@ static inline Thread_Control *_CORE_message_queue_Dequeue_receiver(
   );
 
    *(size_t *) the_thread->Wait.return_argument = size;
+   the_thread->Wait.option = 1;
    the_thread->Wait.count = (uint32_t) submit_type;
 
   _CORE_message_queue_Copy_buffer(
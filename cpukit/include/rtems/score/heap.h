@@ -58,7 +58,9 @@ extern "C" {
  * @brief This group contains the Heap Handler implementation.
  *
  * A heap is a doubly linked list of variable size blocks which are allocated
- * using the first fit method.  Garbage collection is performed each time a
+ * using the first fit method.  Optionally, a segregated free list index may be
+ * used to allocate blocks using a good fit method in constant time, see
+ * _Heap_Free_index_enable().  Garbage collection is performed each time a
  * block is returned to the heap by coalescing neighbor blocks.  Control
  * information for both allocated and free blocks is contained in the heap
  * area.  A heap control structure contains control information for the heap.
@@ -333,11 +335,67 @@ struct Heap_Block {
   Heap_Block *prev;
 };
 
+/**
+ * @brief The second level bit count of the segregated free list index.
+ *
+ * Each power of two size range is subdivided into
+ * @ref HEAP_FREE_INDEX_SECOND_LEVEL_COUNT linear size classes.
+ */
+#define HEAP_FREE_INDEX_SECOND_LEVEL_BITS 3
+
+/**
+ * @brief The second level size class count of the segregated free list index.
+ */
+#define HEAP_FREE_INDEX_SECOND_LEVEL_COUNT \
+  ( 1U << HEAP_FREE_INDEX_SECOND_LEVEL_BITS )
+
+/**
+ * @brief The first level size class count of the segregated free list index.
+ *
+ * There is one first level size class for each bit of a block size.
+ */
+#define HEAP_FREE_INDEX_FIRST_LEVEL_COUNT ( 8 * sizeof( uintptr_t ) )
+
+/**
+ * @brief Segregated free list index of a heap.
+ *
+ * The index maps a two-level (power of two and linear subdivision) size class
+ * to the first free block of this size class.  If a heap uses an index, then
+ * the free list is kept sorted by size class, so that the free blocks of a
+ * size class form a contiguous segment of the free list which begins at the
+ * block referenced by the index.  The bitmaps indicate the non-empty size
+ * classes.  This enables a good fit allocation and a free block insertion in
+ * constant time.
+ *
+ * @see _Heap_Free_index_enable().
+ */
+typedef struct {
+  /**
+   * @brief Bit @a fl is set if one of the second level size classes of first
+   * level size class @a fl is non-empty.
+   */
+  uintptr_t first_level_map;
+
+  /**
+   * @brief Bit @a sl of entry @a fl is set if size class ( @a fl, @a sl ) is
+   * non-empty.
+   */
+  uint32_t second_level_map[ HEAP_FREE_INDEX_FIRST_LEVEL_COUNT ];
+
+  /**
+   * @brief The first free block of each size class or NULL if the size class
+   * is empty.
+   */
+  Heap_Block *first[ HEAP_FREE_INDEX_FIRST_LEVEL_COUNT ]
+    [ HEAP_FREE_INDEX_SECOND_LEVEL_COUNT ];
+} Heap_Free_index;
+
 /**
  * @brief Control block used to manage a heap.
  */
 struct Heap_Control {
   Heap_Block free_list;
+  Heap_Free_index *free_index;
   uintptr_t page_size;
   uintptr_t min_block_size;
   uintptr_t area_begin;
@@ -118,6 +118,74 @@ uintptr_t _Heap_Initialize(
   uintptr_t page_size
 );
 
+/**
+ * @brief Enables the segregated free list index for the heap.
+ *
+ * Afterwards, the heap uses a good fit allocation method with a constant
+ * time free block search for allocations without alignment and boundary
+ * constraints.  The free blocks of the heap are sorted into the index.  The
+ * index is cleared before use.  The index cannot be disabled.  If the heap
+ * uses already an index, then nothing is done.
+ *
+ * The heap shall be initialized.  The caller is responsible for the mutual
+ * exclusion of heap operations.  Each heap shall use a dedicated index.  A
+ * later _Heap_Initialize() disables the index.
+ *
+ * @param[in, out] heap The heap which shall use the index.
+ * @param[out] index The index storage for the heap.
+ */
+void _Heap_Free_index_enable( Heap_Control *heap, Heap_Free_index *index );
+
+/**
+ * @brief Inserts the free block into the segregated free list index.
+ *
+ * The index of the heap shall be enabled.
+ *
+ * @param[in, out] heap The heap of the block.
+ * @param[in, out] block The free block to insert.
+ * @param block_size The size of the free block.  The size field of the block
+ *   is not used and may be set after the insertion.
+ */
+void _Heap_Free_index_insert(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t block_size
+);
+
+/**
+ * @brief Removes the free block from the segregated free list index.
+ *
+ * The index of the heap shall be enabled.
+ *
+ * @param[in, out] heap The heap of the block.
+ * @param[in, out] block The free block to remove.  The size field of the
+ *   block shall be equal to the size used to insert the block.
+ */
+void _Heap_Free_index_remove( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Gets the free list segments which may contain a free block of at
+ *   least the specified size.
+ *
+ * The index of the heap shall be enabled.
+ *
+ * @param heap The heap to search.
+ * @param block_size The requested block size.
+ * @param[out] good_fit The first block of the smallest non-empty size class
+ *   greater than the size class of @a block_size is stored in this object.
+ *   All blocks from this block up to the free list tail are big enough.  If
+ *   no such size class exists, then the free list tail is stored.
+ *
+ * @return Returns the first block of the size class of @a block_size.  The
+ *   blocks of this size class may be too small.  If this size class is empty,
+ *   then the block stored in @a good_fit is returned.
+ */
+Heap_Block *_Heap_Free_index_search(
+  Heap_Control *heap,
+  uintptr_t block_size,
+  Heap_Block **good_fit
+);
+
 /**
  * @brief Allocates an aligned memory area with boundary constraint.
  *
@@ -824,6 +892,121 @@ static inline uintptr_t _Heap_Min( uintptr_t a, uintptr_t b )
   return a < b ? a : b;
 }
 
+/**
+ * @brief Gets the size class of the block size for the segregated free list
+ *   index.
+ *
+ * @param block_size The block size.  It shall be greater than or equal to
+ *   @ref HEAP_FREE_INDEX_SECOND_LEVEL_COUNT.
+ * @param[out] fl The first level size class is stored in this object.
+ * @param[out] sl The second level size class is stored in this object.
+ */
+static inline void _Heap_Free_index_mapping(
+  uintptr_t block_size,
+  uint32_t *fl,
+  uint32_t *sl
+)
+{
+  uint32_t msb;
+
+  msb = (uint32_t) ( 8 * sizeof( unsigned long ) - 1 )
+    - (uint32_t) __builtin_clzl( (unsigned long) block_size );
+  *fl = msb;
+  *sl = (uint32_t) ( block_size >> ( msb - HEAP_FREE_INDEX_SECOND_LEVEL_BITS ) )
+    & ( HEAP_FREE_INDEX_SECOND_LEVEL_COUNT - 1 );
+}
+
+/**
+ * @brief Inserts the free block into the free list of the heap.
+ *
+ * If the heap uses no segregated free list index, then the block is inserted
+ * after the anchor block, otherwise the index determines the position.
+ *
+ * @param[in, out] heap The heap of the block.
+ * @param[in, out] anchor The block after which the block shall be inserted if
+ *   no index is used.
+ * @param[in, out] block The free block to insert.
+ * @param block_size The size of the free block.
+ */
+static inline void _Heap_Free_block_insert(
+  Heap_Control *heap,
+  Heap_Block *anchor,
+  Heap_Block *block,
+  uintptr_t block_size
+)
+{
+  if ( heap->free_index == NULL ) {
+    _Heap_Free_list_insert_after( anchor, block );
+  } else {
+    _Heap_Free_index_insert( heap, block, block_size );
+  }
+}
+
+/**
+ * @brief Removes the free block from the free list of the heap.
+ *
+ * @param[in, out] heap The heap of the block.
+ * @param[in, out] block The free block to remove.
+ */
+static inline void _Heap_Free_block_remove(
+  Heap_Control *heap,
+  Heap_Block *block
+)
+{
+  if ( heap->free_index == NULL ) {
+    _Heap_Free_list_remove( block );
+  } else {
+    _Heap_Free_index_remove( heap, block );
+  }
+}
+
+/**
+ * @brief Replaces the free block in the free list of the heap by another.
+ *
+ * @param[in, out] heap The heap of the blocks.
+ * @param[in, out] old_block The free block to replace.  Its size field shall
+ *   be still valid.
+ * @param[in, out] new_block The block which replaces @a old_block.
+ * @param new_block_size The size of the new block.
+ */
+static inline void _Heap_Free_block_replace(
+  Heap_Control *heap,
+  Heap_Block *old_block,
+  Heap_Block *new_block,
+  uintptr_t new_block_size
+)
+{
+  if ( heap->free_index == NULL ) {
+    _Heap_Free_list_replace( old_block, new_block );
+  } else {
+    _Heap_Free_index_remove( heap, old_block );
+    _Heap_Free_index_insert( heap, new_block, new_block_size );
+  }
+}
+
+/**
+ * @brief Updates the position of the free block in the free list of the heap
+ *   for a new block size.
+ *
+ * This function shall be called before the size field of the block is
+ * changed.
+ *
+ * @param[in, out] heap The heap of the block.
+ * @param[in, out] block The free block.
+ * @param new_block_size The new size of the free block.
+ */
+static inline void _Heap_Free_block_resize(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t new_block_size
+)
+{
+  if ( heap->free_index != NULL ) {
+    _Heap_Free_index_remove( heap, block );
+    _Heap_Free_index_insert( heap, block, new_block_size );
+  }
+}
+
 #ifdef RTEMS_DEBUG
   #define RTEMS_HEAP_DEBUG
 #endif
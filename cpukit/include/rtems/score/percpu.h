@@ -71,12 +71,12 @@ extern "C" {
   #endif
 
   #if CPU_SIZEOF_POINTER > 4
-    #define PER_CPU_CONTROL_SIZE_BIG_POINTER 76
+    #define PER_CPU_CONTROL_SIZE_BIG_POINTER 80
   #else
     #define PER_CPU_CONTROL_SIZE_BIG_POINTER 0
   #endif
 
-  #define PER_CPU_CONTROL_SIZE_BASE 180
+  #define PER_CPU_CONTROL_SIZE_BASE 184
   #define PER_CPU_CONTROL_SIZE_APPROX \
     ( PER_CPU_CONTROL_SIZE_BASE + CPU_PER_CPU_CONTROL_SIZE + \
     CPU_INTERRUPT_FRAME_SIZE + PER_CPU_CONTROL_SIZE_PROFILING + \
@@ -105,6 +105,8 @@ extern "C" {
 
 #if !defined( ASM )
 
+struct Malloc_Per_CPU_cache;
+
 struct Record_Control;
 
 struct _Thread_Control;
@@ -505,6 +507,32 @@ typedef struct Per_CPU_Control {
      */
     uint64_t ticks;
 
+#if defined(RTEMS_SMP)
+    /**
+     * @brief While the clock tick interrupts of this processor are skipped,
+     *   this member is the tick at which the processor receives its next
+     *   clock tick interrupt, otherwise it is zero.
+     *
+     * @see _Watchdog_Skip_ticks_begin().
+     */
+    uint64_t skip_until;
+
+    /**
+     * @brief This member contains the ticks value of this processor at the
+     *   begin of skipped clock ticks.
+     */
+    uint64_t skip_base;
+
+    /**
+     * @brief This member contains the ticks since boot value at the last
+     *   clock tick of this processor.
+     *
+     * While the clock ticks of this processor are skipped, the boot processor
+     * uses it to advance the ticks of this processor.
+     */
+    uint32_t boot_ticks;
+#endif
+
     /**
      * @brief Header for watchdogs.
      *
@@ -637,6 +665,17 @@ typedef struct Per_CPU_Control {
 
   struct Record_Control *record;
 
+  /**
+   * @brief The small object cache of the C Program Heap for this processor.
+   *
+   * This member is NULL in case CONFIGURE_MALLOC_PER_CPU_CACHE is not
+   * defined.  The cache is only accessed by the owning processor with
+   * interrupts disabled.
+   *
+   * @see _Malloc_Initialize_per_CPU_caches().
+   */
+  struct Malloc_Per_CPU_cache *malloc_cache;
+
   Per_CPU_Stats Stats;
 } Per_CPU_Control;
 
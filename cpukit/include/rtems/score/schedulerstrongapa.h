@@ -38,6 +38,7 @@
 #ifndef _RTEMS_SCORE_SCHEDULERSTRONGAPA_H
 #define _RTEMS_SCORE_SCHEDULERSTRONGAPA_H
 
+#include <rtems/score/prioritybitmap.h>
 #include <rtems/score/scheduler.h>
 #include <rtems/score/schedulersmp.h>
 
@@ -65,9 +66,21 @@ struct Per_CPU_Control;
  * the cpu by checking all the executing nodes in the affinity set of the
  * node and the subsequent nodes executing on the processors in its
  * affinity set.
+ *
+ * The nodes in Scheduler_strong_APA_Context::Ready are queued by priority.
+ * In addition, each processor has a chain for each priority with the queued
+ * nodes which have the processor in their affinity set and a bit map of the
+ * non-empty chains.  The search for the highest ready node walks only along
+ * the processors reachable from the victim processor and then looks at the
+ * first nodes of the chains of the reachable processors.  At most one
+ * scheduled node per processor precedes the first ready node of a chain, so
+ * the search time depends on the processor count and not on the number of
+ * ready nodes.
  * @{
  */
 
+#define SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY 255
+
 /**
  * @brief Scheduler node specialization for Strong APA schedulers.
  */
@@ -82,6 +95,27 @@ typedef struct {
    */
   Chain_Node Ready_node;
 
+  /**
+   * @brief The index of the Scheduler_strong_APA_Context::Ready chain which
+   * contains the Ready_node.
+   */
+  unsigned int ready_index;
+
+  /**
+   * @brief The order of arrival of this node on the
+   * Scheduler_strong_APA_Context::Ready chain.
+   *
+   * It is used to select the first of the ready nodes of equal priority
+   * found on the Scheduler_strong_APA_CPU::Ready chains of different cpus.
+   */
+  uint32_t ready_order;
+
+  /**
+   * @brief Chain nodes for the Scheduler_strong_APA_CPU::Ready chains of the
+   * cpus in the affinity set of this node.
+   */
+  Chain_Node Affinity_nodes[ CPU_MAXIMUM_PROCESSORS ];
+
   /**
    * @brief CPU that this node would preempt in the backtracking part of
    * _Scheduler_strong_APA_Get_highest_ready and
@@ -120,6 +154,20 @@ typedef struct {
    * @brief The node currently executing on this cpu.
    */
   Scheduler_Node *executing;
+
+  /**
+   * @brief Bit map of the non-empty Ready chains of this cpu.
+   */
+  Priority_bit_map_Control Bit_map;
+
+  /**
+   * @brief Chains of the ready and scheduled nodes with this cpu in their
+   * affinity set, one chain for each priority.
+   *
+   * The nodes are in the same order as on the
+   * Scheduler_strong_APA_Context::Ready chains.
+   */
+  Chain_Control Ready[ SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY + 1 ];
 } Scheduler_strong_APA_CPU;
 
 /**
@@ -132,10 +180,21 @@ typedef struct {
   Scheduler_SMP_Context Base;
 
   /**
-   * @brief Chain of all the ready and scheduled nodes present in
-   * the Strong APA scheduler.
+   * @brief Chains of all the ready and scheduled nodes present in
+   * the Strong APA scheduler, one chain for each priority.
    */
-  Chain_Control Ready;
+  Chain_Control Ready[ SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY + 1 ];
+
+  /**
+   * @brief The count of nodes on the Ready chains.
+   */
+  uint32_t ready_node_count;
+
+  /**
+   * @brief The Scheduler_strong_APA_Node::ready_order of the next node
+   * appended to a Ready chain.
+   */
+  uint32_t ready_order;
 
   /**
    * @brief Stores cpu-specific variables.
@@ -143,8 +202,6 @@ typedef struct {
   Scheduler_strong_APA_CPU CPU[ RTEMS_ZERO_LENGTH_ARRAY ];
 } Scheduler_strong_APA_Context;
 
-#define SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY 255
-
 /**
  * @brief Entry points for the Strong APA Scheduler.
  */
@@ -0,0 +1,399 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerWorkStealingSMP
+ *
+ * @brief This header file provides interfaces of the
+ *   @ref RTEMSScoreSchedulerWorkStealingSMP which are used by the
+ *   implementation and the @ref RTEMSImplApplConfig.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULERWORKSTEALINGSMP_H
+#define _RTEMS_SCORE_SCHEDULERWORKSTEALINGSMP_H
+
+#include <rtems/score/scheduler.h>
+#include <rtems/score/schedulersmp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSScoreSchedulerWorkStealingSMP Work Stealing SMP Scheduler
+ *
+ * @ingroup RTEMSScoreSchedulerSMP
+ *
+ * @brief This group contains the Work Stealing SMP Scheduler implementation.
+ *
+ * This is a fixed-priority scheduler intended for throughput workloads with
+ * many short-lived threads.  Each processor owned by the scheduler instance
+ * has its own ready queue.  A ready thread is queued on its home processor,
+ * which is the processor it executed on most recently.  Threads without a home
+ * processor owned by the scheduler instance, for example new threads, use the
+ * processor which makes them ready.
+ *
+ * A processor selects the next thread from its own ready queue.  It steals the
+ * highest priority thread of another ready queue
+ *
+ * - if its own ready queue is empty (idle-time stealing), or
+ *
+ * - every steal period selections, if the priority of the remote thread is
+ *   higher than the priority of the local thread by more than the migration
+ *   cost (periodic stealing).
+ *
+ * An unblocked thread preempts the thread executing on its home processor or
+ * an idle processor.  It preempts the lowest priority thread on another
+ * processor only if its priority is higher by more than the migration cost.
+ * The migration cost is a count of priority levels.
+ *
+ * The scheduler operations are carried out under the lock of the scheduler
+ * instance, like in the other SMP schedulers.  The per-processor ready queues
+ * keep the ready queue operations short and preserve the cache affinity of
+ * threads.
+ *
+ * @{
+ */
+
+/**
+ * @brief Scheduler node specialization for Work Stealing SMP schedulers.
+ */
+typedef struct {
+  /**
+   * @brief SMP scheduler node.
+   */
+  Scheduler_SMP_Node Base;
+
+  /**
+   * @brief The index of the home processor of the node.
+   *
+   * This is the processor which executed the thread most recently.
+   */
+  uint32_t home_index;
+
+  /**
+   * @brief The index of the ready queue containing the node.
+   *
+   * This member is only valid if the node is in the ready state and is not
+   * the node of an idle thread.
+   */
+  uint32_t ready_queue_index;
+} Scheduler_work_stealing_SMP_Node;
+
+/**
+ * @brief The ready queue of a processor.
+ */
+typedef struct {
+  /**
+   * @brief The ready threads with this processor as the home processor.
+   */
+  RBTree_Control Queue;
+
+  /**
+   * @brief This member references the node allocated to the corresponding
+   *   processor.
+   */
+  Scheduler_work_stealing_SMP_Node *allocated;
+
+  /**
+   * @brief Count of selections since the last check for periodic stealing.
+   */
+  uint32_t selections;
+
+  /**
+   * @brief Count of threads stolen by the corresponding processor.
+   */
+  uint32_t steals;
+} Scheduler_work_stealing_SMP_Ready_queue;
+
+/**
+ * @brief Scheduler context specialization for Work Stealing SMP schedulers.
+ */
+typedef struct {
+  /**
+   * @brief SMP scheduler context.
+   */
+  Scheduler_SMP_Context Base;
+
+  /**
+   * @brief The count of priority levels a remote thread shall exceed the
+   *   local candidate so that it is worth a migration.
+   */
+  uint32_t migration_cost;
+
+  /**
+   * @brief The count of selections of a processor after which it checks the
+   *   other ready queues for a better thread.
+   *
+   * A value of zero disables periodic stealing.
+   */
+  uint32_t steal_period;
+
+  /**
+   * @brief The idle threads which are not scheduled.
+   */
+  Chain_Control Idle;
+
+  /**
+   * @brief A table with ready queues, one for each processor.
+   */
+  Scheduler_work_stealing_SMP_Ready_queue Ready[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Scheduler_work_stealing_SMP_Context;
+
+#define SCHEDULER_WORK_STEALING_SMP_MAXIMUM_PRIORITY 255
+
+/**
+ * @brief Entry points for the Work Stealing SMP Scheduler.
+ */
+#define SCHEDULER_WORK_STEALING_SMP_ENTRY_POINTS \
+  { \
+    _Scheduler_work_stealing_SMP_Initialize, \
+    _Scheduler_default_Schedule, \
+    _Scheduler_work_stealing_SMP_Yield, \
+    _Scheduler_work_stealing_SMP_Block, \
+    _Scheduler_work_stealing_SMP_Unblock, \
+    _Scheduler_work_stealing_SMP_Update_priority, \
+    _Scheduler_default_Map_priority, \
+    _Scheduler_default_Unmap_priority, \
+    _Scheduler_work_stealing_SMP_Ask_for_help, \
+    _Scheduler_work_stealing_SMP_Reconsider_help_request, \
+    _Scheduler_work_stealing_SMP_Withdraw_node, \
+    _Scheduler_work_stealing_SMP_Make_sticky, \
+    _Scheduler_work_stealing_SMP_Clean_sticky, \
+    _Scheduler_default_Pin_or_unpin_not_supported, \
+    _Scheduler_default_Pin_or_unpin_not_supported, \
+    _Scheduler_work_stealing_SMP_Add_processor, \
+    _Scheduler_work_stealing_SMP_Remove_processor, \
+    _Scheduler_work_stealing_SMP_Node_initialize, \
+    _Scheduler_default_Node_destroy, \
+    _Scheduler_default_Release_job, \
+    _Scheduler_default_Cancel_job, \
+    _Scheduler_work_stealing_SMP_Start_idle \
+    SCHEDULER_DEFAULT_SET_AFFINITY_OPERATION \
+  }
+
+/**
+ * @brief Initializes the scheduler's context.
+ *
+ * @param scheduler The scheduler instance to initialize.
+ */
+void _Scheduler_work_stealing_SMP_Initialize(
+  const Scheduler_Control *scheduler
+);
+
+/**
+ * @brief Initializes the node with the given priority.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[out] node The node to initialize.
+ * @param the_thread The thread of the scheduler node.
+ * @param priority The priority for the initialization.
+ */
+void _Scheduler_work_stealing_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+);
+
+/**
+ * @brief Blocks the thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread The thread to block.
+ * @param[in, out] node The @a thread's scheduler node.
+ */
+void _Scheduler_work_stealing_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Unblocks the thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread The thread to unblock.
+ * @param[in, out] node The @a thread's scheduler node.
+ */
+void _Scheduler_work_stealing_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Updates the priority of the node.
+ *
+ * @param scheduler The scheduler instance.
+ * @param the_thread The thread for the operation.
+ * @param node The thread's scheduler node.
+ */
+void _Scheduler_work_stealing_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Asks for help operation.
+ *
+ * @param scheduler The scheduler instance to ask for help.
+ * @param the_thread The thread needing help.
+ * @param node The scheduler node.
+ *
+ * @retval true Ask for help was successful.
+ * @retval false Ask for help was not successful.
+ */
+bool _Scheduler_work_stealing_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Reconsiders help operation.
+ *
+ * @param scheduler The scheduler instance to reconsider the help
+ *   request.
+ * @param the_thread The thread reconsidering a help request.
+ * @param node The scheduler node.
+ */
+void _Scheduler_work_stealing_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Withdraws node operation.
+ *
+ * @param scheduler The scheduler instance to withdraw the node.
+ * @param the_thread The thread using the node.
+ * @param node The scheduler node to withdraw.
+ * @param next_state The next thread scheduler state in case the node is
+ *   scheduled.
+ */
+void _Scheduler_work_stealing_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+);
+
+/**
+ * @brief Makes the node sticky.
+ *
+ * @param scheduler is the scheduler of the node.
+ *
+ * @param[in, out] the_thread is the thread owning the node.
+ *
+ * @param[in, out] node is the scheduler node to make sticky.
+ */
+void _Scheduler_work_stealing_SMP_Make_sticky(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Cleans the sticky property from the node.
+ *
+ * @param scheduler is the scheduler of the node.
+ *
+ * @param[in, out] the_thread is the thread owning the node.
+ *
+ * @param[in, out] node is the scheduler node to clean the sticky property.
+ */
+void _Scheduler_work_stealing_SMP_Clean_sticky(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Adds processor.
+ *
+ * @param[in, out] scheduler The scheduler instance to add the processor to.
+ * @param idle The idle thread of the processor to add.
+ */
+void _Scheduler_work_stealing_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+);
+
+/**
+ * @brief Removes an idle thread from the given cpu.
+ *
+ * The ready threads with the processor as the home processor are moved to
+ * the ready queues of the remaining processors.
+ *
+ * @param scheduler The scheduler instance.
+ * @param cpu The cpu control to remove from @a scheduler.
+ *
+ * @return The idle thread of the processor.
+ */
+Thread_Control *_Scheduler_work_stealing_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  struct Per_CPU_Control  *cpu
+);
+
+/**
+ * @brief Performs the yield of a thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread The thread that performed the yield operation.
+ * @param node The scheduler node of @a the_thread.
+ */
+void _Scheduler_work_stealing_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Starts an idle thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread An idle thread.
+ * @param cpu The cpu for the operation.
+ */
+void _Scheduler_work_stealing_SMP_Start_idle(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle,
+  struct Per_CPU_Control  *cpu
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_SCORE_SCHEDULERWORKSTEALINGSMP_H */
@@ -200,6 +200,19 @@ void _Timecounter_Install( struct timecounter *tc );
  */
 void _Timecounter_Tick( void );
 
+/**
+ * @brief Performs a timecounter tick which accounts for the specified count of
+ *   clock ticks.
+ *
+ * This function is used by clock drivers which skipped clock tick interrupts
+ * while the processor was idle.  The time elapsed since the last timecounter
+ * tick shall be less than the half of the timecounter period.
+ *
+ * @param ticks is the count of elapsed clock ticks.  It shall be greater than
+ *   zero.
+ */
+void _Timecounter_Tick_multiple( uint32_t ticks );
+
 #if ISR_LOCK_NEEDS_OBJECT
 /**
  * @brief Lock to protect the timecounter mechanic.
@@ -84,6 +84,53 @@ typedef void Watchdog_Service_routine;
 typedef Watchdog_Service_routine
   ( *Watchdog_Service_routine_entry )( Watchdog_Control * );
 
+/**
+ * @brief The count of bits of the expiration time used to select the slot in
+ * one level of a watchdog timer wheel.
+ */
+#define WATCHDOG_WHEEL_LEVEL_BITS 6
+
+/**
+ * @brief The count of slots in one level of a watchdog timer wheel.
+ */
+#define WATCHDOG_WHEEL_SLOTS ( 1U << WATCHDOG_WHEEL_LEVEL_BITS )
+
+/**
+ * @brief The count of levels of a watchdog timer wheel.
+ *
+ * Watchdogs which expire at or beyond WATCHDOG_WHEEL_SLOTS to the power of
+ * WATCHDOG_WHEEL_LEVELS ticks in the future are placed in the last slot which
+ * can be reached and are moved again once this slot is processed.
+ */
+#define WATCHDOG_WHEEL_LEVELS 4
+
+/**
+ * @brief The hierarchical timer wheel to manage scheduled watchdogs with an
+ * expiration time in clock ticks.
+ *
+ * The slots of the first level contain the watchdogs which expire in the next
+ * WATCHDOG_WHEEL_SLOTS ticks.  Each slot of a higher level covers the range
+ * of all slots of the next lower level.  The watchdogs of a higher level slot
+ * are moved to the lower levels when the wheel of the lower level wraps
+ * around.  Inserting and removing a watchdog is a constant time operation.
+ */
+typedef struct {
+  /**
+   * @brief The next tick to process.
+   */
+  uint64_t next;
+
+  /**
+   * @brief The count of scheduled watchdogs on this wheel.
+   */
+  uint64_t count;
+
+  /**
+   * @brief The slots of each level.
+   */
+  Chain_Control Slots[ WATCHDOG_WHEEL_LEVELS ][ WATCHDOG_WHEEL_SLOTS ];
+} Watchdog_Wheel;
+
 /**
  * @brief The watchdog header to manage scheduled watchdogs.
  */
@@ -96,8 +143,18 @@ typedef struct {
   /**
    * @brief The scheduled watchdog with the earliest expiration time or NULL in
    * case no watchdog is scheduled.
+   *
+   * This member is always NULL if the header uses a timer wheel.
    */
   RBTree_Node *first;
+
+  /**
+   * @brief The timer wheel used instead of the red-black tree or NULL.
+   *
+   * A timer wheel is only used for the per-CPU watchdog header of the tick
+   * clock, see #CONFIGURE_WATCHDOG_TIMER_WHEEL.
+   */
+  Watchdog_Wheel *wheel;
 } Watchdog_Header;
 
 /**
@@ -119,7 +176,8 @@ struct Watchdog_Control {
 
     /**
      * @brief this field is a chain node structure and allows this to be placed
-     * on a chain used to manage pending watchdogs by the timer server.
+     * on a chain used to manage pending watchdogs by the timer server or on a
+     * slot of a timer wheel.
      */
     Chain_Node Chain;
   } Node;
@@ -41,6 +41,7 @@
 #include <rtems/score/watchdog.h>
 #include <rtems/score/watchdogticks.h>
 #include <rtems/score/assert.h>
+#include <rtems/score/chainimpl.h>
 #include <rtems/score/isrlock.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/rbtreeimpl.h>
@@ -120,11 +121,15 @@ static inline void _Watchdog_Header_initialize(
 {
   _RBTree_Initialize_empty( &header->Watchdogs );
   header->first = NULL;
+  header->wheel = NULL;
 }
 
 /**
  * @brief Returns the first of the watchdog header.
  *
+ * For a header with a timer wheel, NULL is returned, see
+ * _Watchdog_Header_is_empty().
+ *
  * @param header The watchdog header to remove the first of.
  *
  * @return The first of @a header.
@@ -136,6 +141,27 @@ static inline Watchdog_Control *_Watchdog_Header_first(
   return (Watchdog_Control *) header->first;
 }
 
+/**
+ * @brief Checks if the watchdog header has no scheduled watchdogs.
+ *
+ * In contrast to _Watchdog_Header_first(), this function considers the timer
+ * wheel of the header.
+ *
+ * @param header is the watchdog header to check.
+ *
+ * @retval true The watchdog header has no scheduled watchdogs.
+ *
+ * @retval false Otherwise.
+ */
+static inline bool _Watchdog_Header_is_empty( const Watchdog_Header *header )
+{
+  if ( header->wheel != NULL ) {
+    return header->wheel->count == 0;
+  }
+
+  return header->first == NULL;
+}
+
 /**
  * @brief Destroys the watchdog header.
  *
@@ -156,6 +182,91 @@ static inline void _Watchdog_Header_destroy(
  */
 void _Watchdog_Tick( struct Per_CPU_Control *cpu );
 
+/**
+ * @brief Performs the specified count of watchdog ticks at once.
+ *
+ * This function is used by clock drivers which skipped clock tick interrupts
+ * while the processor was idle, see _Watchdog_Skip_ticks_begin().  It may be
+ * called by the idle thread outside of an interrupt context, so the routines
+ * of the expired watchdogs may not be called in interrupt context.
+ *
+ * @param cpu is the processor for the watchdog ticks.
+ *
+ * @param ticks is the count of ticks to perform.  It shall be greater than
+ *   zero.
+ */
+void _Watchdog_Tick_multiple( struct Per_CPU_Control *cpu, uint32_t ticks );
+
+/**
+ * @brief Gets the count of clock ticks until the next tick at which a
+ * scheduled watchdog of the processor may expire.
+ *
+ * The clock tick interrupts before this tick may be skipped by the clock
+ * driver.  The elapsed ticks shall be performed afterwards by
+ * _Watchdog_Tick_multiple().
+ *
+ * @param cpu is the processor of the watchdogs.
+ *
+ * @param maximum is the maximum count of ticks to return.
+ *
+ * @return Returns the count of ticks until the next tick at which a watchdog
+ *   may expire.  The value is in the range from one to @a maximum.
+ */
+uint32_t _Watchdog_Ticks_until_expiration(
+  struct Per_CPU_Control *cpu,
+  uint32_t                maximum
+);
+
+/**
+ * @brief Begins to skip the clock ticks of the idle processor.
+ *
+ * This function shall be called by the processor itself with interrupts
+ * disabled.  If the returned count is greater than one, then the clock driver
+ * may skip the clock tick interrupts before the tick at the returned count.
+ * In this case, _Watchdog_Skip_ticks_end() shall be called afterwards and then
+ * the elapsed ticks shall be performed by _Watchdog_Tick_multiple().
+ *
+ * In SMP configurations, the boot processor never skips ticks if more than
+ * one processor is present, since it maintains the timecounter and the ticks
+ * since boot for all processors.  While a secondary processor skips ticks,
+ * the boot processor advances the ticks of the skipping processor, so that
+ * watchdogs inserted by other processors use an up to date tick count.  If
+ * another processor inserts a watchdog which expires before the next clock
+ * tick interrupt of the skipping processor, then an inter-processor interrupt
+ * wakes up the skipping processor, see _Watchdog_Insert().
+ *
+ * @param cpu is the processor of the watchdogs.
+ *
+ * @param maximum is the maximum count of ticks to skip.
+ *
+ * @return Returns the count of ticks until the next tick at which a watchdog
+ *   may expire.  The value is in the range from one to @a maximum.
+ */
+uint32_t _Watchdog_Skip_ticks_begin(
+  struct Per_CPU_Control *cpu,
+  uint32_t                maximum
+);
+
+/**
+ * @brief Ends to skip the clock ticks of the processor.
+ *
+ * The ticks of the processor are set back to the value at
+ * _Watchdog_Skip_ticks_begin(), since the ticks counted by the clock driver of
+ * the processor shall be performed afterwards.
+ *
+ * @param cpu is the processor of the watchdogs.
+ */
+void _Watchdog_Skip_ticks_end( struct Per_CPU_Control *cpu );
+
+#if defined(RTEMS_SMP)
+/**
+ * @brief This counter contains the count of processors which skip clock ticks.
+ *
+ * @see _Watchdog_Skip_ticks_begin().
+ */
+extern Atomic_Uint _Watchdog_Skipping_processors;
+#endif
+
 /**
  * @brief Gets the state of the watchdog.
  *
@@ -288,11 +399,120 @@ void _Watchdog_Do_tickle(
     _Watchdog_Do_tickle( header, first, now, lock_context )
 #endif
 
+/**
+ * @brief Initializes the timer wheel.
+ *
+ * @param[out] wheel is the timer wheel to initialize.
+ *
+ * @param now is the current tick.
+ */
+void _Watchdog_Wheel_initialize( Watchdog_Wheel *wheel, uint64_t now );
+
+/**
+ * @brief Uses the timer wheels provided by the application configuration for
+ * the per-CPU watchdog headers of the tick clock.
+ *
+ * This function is a system initialization handler, see
+ * #CONFIGURE_WATCHDOG_TIMER_WHEEL.
+ */
+void _Watchdog_Wheel_initialize_per_CPU( void );
+
+/**
+ * @brief The per-CPU timer wheels of the tick clock.
+ *
+ * This object is defined by the application configuration option
+ * #CONFIGURE_WATCHDOG_TIMER_WHEEL via <rtems/confdefs.h>.
+ */
+extern Watchdog_Wheel _Watchdog_Wheels[];
+
+/**
+ * @brief Inserts the watchdog into the timer wheel.
+ *
+ * The watchdog must be inactive.  A watchdog with an expiration time before
+ * the next tick to process expires with the next tick.
+ *
+ * @param[in, out] wheel is the timer wheel.
+ *
+ * @param[in, out] the_watchdog is the watchdog to insert.
+ *
+ * @param expire is the expiration time in ticks.
+ */
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+);
+
+/**
+ * @brief Gets the tick at which a watchdog of the timer wheel may expire or
+ * the timer wheel has to move watchdogs to a lower level next.
+ *
+ * @param wheel is the timer wheel.
+ *
+ * @retval UINT64_MAX The timer wheel has no scheduled watchdogs.
+ *
+ * @return Returns the next tick which has to be processed by
+ *   _Watchdog_Wheel_tickle().
+ */
+uint64_t _Watchdog_Wheel_next_expiration( const Watchdog_Wheel *wheel );
+
+/**
+ * @brief Removes the watchdog from the timer wheel.
+ *
+ * @param[in, out] wheel is the timer wheel.
+ *
+ * @param[in, out] the_watchdog is the scheduled watchdog to remove.
+ */
+static inline void _Watchdog_Wheel_remove(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+)
+{
+  _Assert( wheel->count > 0 );
+  --wheel->count;
+  _Chain_Extract_unprotected( &the_watchdog->Node.Chain );
+}
+
+/**
+ * @brief Calls the routines of the watchdogs of the timer wheel which expire
+ * up to and including the specified tick.
+ *
+ * The watchdog routines are called with the lock released.
+ *
+ * @param[in, out] wheel is the timer wheel.
+ *
+ * @param now is the current tick.
+ *
+ * @param lock is the lock protecting the timer wheel.
+ *
+ * @param lock_context is the lock context for the release before calling the
+ *   routine and for the acquire after.
+ */
+void _Watchdog_Do_wheel_tickle(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#if defined(RTEMS_SMP)
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+);
+
+#if defined(RTEMS_SMP)
+  #define _Watchdog_Wheel_tickle( wheel, now, lock, lock_context ) \
+    _Watchdog_Do_wheel_tickle( wheel, now, lock, lock_context )
+#else
+  #define _Watchdog_Wheel_tickle( wheel, now, lock, lock_context ) \
+    _Watchdog_Do_wheel_tickle( wheel, now, lock_context )
+#endif
+
 /**
  * @brief Inserts a watchdog into the set of scheduled watchdogs according to
  * the specified expiration time.
  *
- * The watchdog must be inactive.
+ * The watchdog must be inactive.  In SMP configurations, the header shall
+ * belong to the processor of the watchdog.  If this processor skips clock
+ * ticks and the watchdog may expire before its next clock tick interrupt,
+ * then an inter-processor interrupt is sent to the processor.
  *
  * @param[in, out] header The set of scheduler watchdogs to insert into.
  * @param[in, out] the_watchdog The watchdog to insert.
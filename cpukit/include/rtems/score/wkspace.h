@@ -65,6 +65,21 @@ extern Heap_Control _Workspace_Area;
  */
 void _Workspace_Handler_initialization( void );
 
+/**
+ * @brief The segregated free list index storage of the workspace.
+ *
+ * This object is defined by the application configuration option
+ * #CONFIGURE_WORKSPACE_FREE_INDEX via <rtems/confdefs.h>.
+ */
+extern Heap_Free_index _Workspace_Free_index;
+
+/**
+ * @brief Enables the segregated free list index for the workspace.
+ *
+ * @see _Heap_Free_index_enable().
+ */
+void _Workspace_Enable_free_index( void );
+
 /**
  * @brief Allocates a memory block of the specified size from the workspace.
  *
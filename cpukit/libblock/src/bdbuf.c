@@ -97,6 +97,8 @@ typedef struct rtems_bdbuf_cache
                                           * swap out task. It deletes itself. */
   rtems_chain_control swapout_free_workers; /**< The work threads for the swapout
                                              * task. */
+  rtems_chain_control swapout_devices;   /**< The devices with modified
+                                          * buffers or an active sync. */
 
   rtems_bdbuf_buffer* bds;               /**< Pointer to table of buffer
                                           * descriptors. */
@@ -108,19 +110,10 @@ typedef struct rtems_bdbuf_cache
   uint32_t            flags;             /**< Configuration flags. */
 
   rtems_mutex         lock;              /**< The cache lock. It locks all
-                                          * cache data, BD and lists. */
-  rtems_mutex         sync_lock;         /**< Sync calls block writes. */
-  bool                sync_active;       /**< True if a sync is active. */
-  rtems_id            sync_requester;    /**< The sync requester. */
-  rtems_disk_device  *sync_device;       /**< The device to sync and
-                                          * BDBUF_INVALID_DEV not a device
-                                          * sync. */
-
-  rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
-                                          * root. There is only one. */
+                                          * cache data, BD and lists. It is
+                                          * not held during transfers. */
+
   rtems_chain_control lru;               /**< Least recently used list */
-  rtems_chain_control modified;          /**< Modified buffers list */
-  rtems_chain_control sync;              /**< Buffers to sync list */
 
   rtems_bdbuf_waiters access_waiters;    /**< Wait for a buffer in
                                           * ACCESS_CACHED, ACCESS_MODIFIED or
@@ -176,6 +169,19 @@ typedef enum {
 #define RTEMS_BDBUF_SWAPOUT_SYNC   RTEMS_EVENT_2
 #define RTEMS_BDBUF_READ_AHEAD_WAKE_UP RTEMS_EVENT_1
 
+/**
+ * The initial read-ahead window of a read stream in blocks.  It is limited by
+ * the configured maximum read-ahead blocks.
+ */
+#define RTEMS_BDBUF_READ_AHEAD_WINDOW_INITIAL 4
+
+/**
+ * The maximum count of scatter/gather buffers of a direct read request.  It
+ * limits the request size on the stack for drivers without the multi-block
+ * buffer capability.
+ */
+#define RTEMS_BDBUF_DIRECT_READ_MAX_BUFFERS 32
+
 static rtems_task rtems_bdbuf_swapout_task(rtems_task_argument arg);
 
 static rtems_task rtems_bdbuf_read_ahead_task(rtems_task_argument arg);
@@ -185,7 +191,6 @@ static rtems_task rtems_bdbuf_read_ahead_task(rtems_task_argument arg);
  */
 static rtems_bdbuf_cache bdbuf_cache = {
   .lock = RTEMS_MUTEX_INITIALIZER(NULL),
-  .sync_lock = RTEMS_MUTEX_INITIALIZER(NULL),
   .access_waiters = { .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL) },
   .transfer_waiters = {
     .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL)
@@ -225,9 +230,12 @@ rtems_bdbuf_list_count (rtems_chain_control* list)
 void
 rtems_bdbuf_show_usage (void)
 {
-  uint32_t group;
-  uint32_t total = 0;
-  uint32_t val;
+  uint32_t          group;
+  uint32_t          total = 0;
+  uint32_t          val;
+  uint32_t          modified = 0;
+  uint32_t          sync = 0;
+  rtems_chain_node* node;
 
   for (group = 0; group < bdbuf_cache.group_count; group++)
     total += bdbuf_cache.groups[group].users;
@@ -235,12 +243,22 @@ rtems_bdbuf_show_usage (void)
   val = rtems_bdbuf_list_count (&bdbuf_cache.lru);
   printf (", lru=%lu", val);
   total = val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.modified);
-  printf (", mod=%lu", val);
-  total += val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.sync);
-  printf (", sync=%lu", val);
-  total += val;
+
+  node = rtems_chain_first (&bdbuf_cache.swapout_devices);
+  while (!rtems_chain_is_tail (&bdbuf_cache.swapout_devices, node))
+  {
+    rtems_disk_device *dd =
+      RTEMS_CONTAINER_OF (node, rtems_disk_device, swapout.node);
+
+    modified += rtems_bdbuf_list_count (&dd->swapout.modified);
+    sync += rtems_bdbuf_list_count (&dd->swapout.sync);
+    node = rtems_chain_next (node);
+  }
+
+  printf (", mod=%lu", modified);
+  total += modified;
+  printf (", sync=%lu", sync);
+  total += sync;
   printf (", total=%lu\n", total);
 }
 
@@ -270,15 +288,6 @@ rtems_bdbuf_show_users (const char* where, rtems_bdbuf_buffer* bd)
 #define rtems_bdbuf_show_users(_w, _b) ((void) 0)
 #endif
 
-/**
- * The default maximum height of 32 allows for AVL trees having between
- * 5,704,880 and 4,294,967,295 nodes, depending on order of insertion.  You may
- * change this compile-time constant as you wish.
- */
-#ifndef RTEMS_BDBUF_AVL_MAX_HEIGHT
-#define RTEMS_BDBUF_AVL_MAX_HEIGHT (32)
-#endif
-
 static void
 rtems_bdbuf_fatal (rtems_fatal_code error)
 {
@@ -293,492 +302,204 @@ rtems_bdbuf_fatal_with_state (rtems_bdbuf_buf_state state,
 }
 
 /**
- * Searches for the node with specified dd/block.
+ * Returns the hash table bucket of the disk device for the media block.  The
+ * multiplicative hash spreads blocks with a stride of the media blocks per
+ * block evenly over the buckets.
  *
- * @param root pointer to the root node of the AVL-Tree
- * @param dd disk device search key
- * @param block block search key
- * @retval NULL node with the specified dd/block is not found
- * @return pointer to the node with specified dd/block
+ * @param dd The disk device.
+ * @param block The media block.
+ * @return Pointer to the head of the bucket.
  */
-static rtems_bdbuf_buffer *
-rtems_bdbuf_avl_search (rtems_bdbuf_buffer** root,
-                        const rtems_disk_device *dd,
-                        rtems_blkdev_bnum    block)
+static rtems_bdbuf_buffer **
+rtems_bdbuf_hash_bucket (const rtems_disk_device *dd,
+                         rtems_blkdev_bnum        block)
 {
-  rtems_bdbuf_buffer* p = *root;
+  uint32_t index = (uint32_t) (block * UINT32_C (2654435761))
+    >> dd->bd_hash_shift;
 
-  while ((p != NULL) && ((p->dd != dd) || (p->block != block)))
-  {
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p = p->avl.right;
-    }
-    else
-    {
-      p = p->avl.left;
-    }
-  }
+  return &dd->bd_hash[index];
+}
 
-  return p;
+static rtems_blkdev_bnum
+rtems_bdbuf_hash_bucket_count (const rtems_disk_device *dd)
+{
+  return (rtems_blkdev_bnum) 1 << (32 - dd->bd_hash_shift);
 }
 
+static int
+rtems_bdbuf_hash_insert (rtems_bdbuf_buffer* node);
+
 /**
- * Inserts the specified node to the AVl-Tree.
+ * Moves the buffers of the hash table to the hash table of the disk device
+ * and frees the hash table.
  *
- * @param root pointer to the root node of the AVL-Tree
- * @param node Pointer to the node to add.
- * @retval 0 The node added successfully
- * @retval -1 An error occurred
+ * @param dd The disk device.
+ * @param bd_hash The hash table to free.
+ * @param bucket_count The bucket count of the hash table to free.
  */
-static int
-rtems_bdbuf_avl_insert(rtems_bdbuf_buffer** root,
-                       rtems_bdbuf_buffer*  node)
+static void
+rtems_bdbuf_hash_move_and_free (rtems_disk_device   *dd,
+                                rtems_bdbuf_buffer **bd_hash,
+                                rtems_blkdev_bnum    bucket_count)
 {
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
-
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
-
-  bool modified = false;
-
-  if (p == NULL)
-  {
-    *root = node;
-    node->avl.left = NULL;
-    node->avl.right = NULL;
-    node->avl.bal = 0;
-    return 0;
-  }
+  rtems_blkdev_bnum bucket;
 
-  while (p != NULL)
+  for (bucket = 0; bucket < bucket_count; ++bucket)
   {
-    *buf_prev++ = p;
+    rtems_bdbuf_buffer *bd = bd_hash [bucket];
 
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p->avl.cache = 1;
-      q = p->avl.right;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.right = q = node;
-        break;
-      }
-    }
-    else if ((p->dd != dd) || (p->block != block))
-    {
-      p->avl.cache = -1;
-      q = p->avl.left;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.left = q;
-        break;
-      }
-    }
-    else
+    while (bd != NULL)
     {
-      return -1;
-    }
+      rtems_bdbuf_buffer *next = bd->hash_next;
 
-    p = q;
-  }
-
-  q->avl.left = q->avl.right = NULL;
-  q->avl.bal = 0;
-  modified = true;
-  buf_prev--;
-
-  while (modified)
-  {
-    if (p->avl.cache == -1)
-    {
-      switch (p->avl.bal)
-      {
-        case 1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = -1;
-          break;
-
-        case -1:
-          p1 = p->avl.left;
-          if (p1->avl.bal == -1) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
-            if (p2->avl.bal == -1) p->avl.bal = +1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
+      (void) rtems_bdbuf_hash_insert (bd);
+      bd = next;
     }
-    else
-    {
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = 1;
-          break;
-
-        case 1:
-          p1 = p->avl.right;
-          if (p1->avl.bal == 1) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = +1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
-    }
-    q = p;
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
-
-      if (p->avl.cache == -1)
-      {
-        p->avl.left = q;
-      }
-      else
-      {
-        p->avl.right = q;
-      }
-    }
-    else
-    {
-      *root = p;
-      break;
-    }
-  };
+  }
 
-  return 0;
+  free (bd_hash);
 }
 
-
 /**
- * Removes the node from the tree.
+ * Allocates the hash table of the disk device for the block count.  The table
+ * size is a power of two which covers all buffers of the cache or all blocks
+ * of the disk, whatever is less.  An existing hash table of a different size
+ * is replaced.  Buffers which are still in the existing table, for example
+ * buffers of a transfer in progress, are moved to the new table.  If there is
+ * not enough memory for the new table, then the existing table is kept.  The
+ * swapout control of the disk device is initialized together with the first
+ * hash table.
  *
- * @param root Pointer to pointer to the root node
- * @param node Pointer to the node to remove
- * @retval 0 Item removed
- * @retval -1 No such item found
+ * @param dd The disk device.
+ * @param block_count The block count of the disk device.
+ * @retval RTEMS_SUCCESSFUL The hash table is available.
+ * @retval RTEMS_NO_MEMORY Not enough memory to allocate the hash table.
  */
-static int
-rtems_bdbuf_avl_remove(rtems_bdbuf_buffer**      root,
-                       const rtems_bdbuf_buffer* node)
+static rtems_status_code
+rtems_bdbuf_hash_create (rtems_disk_device *dd, rtems_blkdev_bnum block_count)
 {
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
-
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  r;
-  rtems_bdbuf_buffer*  s;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
+  rtems_blkdev_bnum    buffer_count;
+  rtems_bdbuf_buffer **bd_hash;
+  uint32_t             shift;
 
-  bool modified = false;
+  buffer_count = bdbuf_cache.buffer_min_count;
 
-  memset (buf_stack, 0, sizeof(buf_stack));
+  if (buffer_count > block_count)
+    buffer_count = block_count;
 
-  while (p != NULL)
-  {
-    *buf_prev++ = p;
+  shift = 31;
 
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p->avl.cache = 1;
-      p = p->avl.right;
-    }
-    else if ((p->dd != dd) || (p->block != block))
-    {
-      p->avl.cache = -1;
-      p = p->avl.left;
-    }
-    else
-    {
-      /* node found */
-      break;
-    }
-  }
+  while (shift > 0 && ((rtems_blkdev_bnum) 1 << (32 - shift)) < buffer_count)
+    --shift;
 
-  if (p == NULL)
-  {
-    /* there is no such node */
-    return -1;
-  }
+  if (dd->bd_hash != NULL && dd->bd_hash_shift == shift)
+    return RTEMS_SUCCESSFUL;
 
-  q = p;
+  bd_hash = calloc ((size_t) 1 << (32 - shift), sizeof (*bd_hash));
+  if (bd_hash == NULL)
+    return dd->bd_hash != NULL ? RTEMS_SUCCESSFUL : RTEMS_NO_MEMORY;
 
-  buf_prev--;
-  if (buf_prev > buf_stack)
-  {
-    p = *(buf_prev - 1);
-  }
-  else
+  if (dd->bd_hash != NULL)
   {
-    p = NULL;
-  }
+    rtems_bdbuf_buffer **old_hash = dd->bd_hash;
+    rtems_blkdev_bnum    old_bucket_count = rtems_bdbuf_hash_bucket_count (dd);
 
-  /* at this moment q - is a node to delete, p is q's parent */
-  if (q->avl.right == NULL)
-  {
-    r = q->avl.left;
-    if (r != NULL)
-    {
-      r->avl.bal = 0;
-    }
-    q = r;
+    dd->bd_hash = bd_hash;
+    dd->bd_hash_shift = shift;
+    rtems_bdbuf_hash_move_and_free (dd, old_hash, old_bucket_count);
+    return RTEMS_SUCCESSFUL;
   }
-  else
-  {
-    rtems_bdbuf_buffer **t;
 
-    r = q->avl.right;
+  dd->bd_hash = bd_hash;
+  dd->bd_hash_shift = shift;
 
-    if (r->avl.left == NULL)
-    {
-      r->avl.left = q->avl.left;
-      r->avl.bal = q->avl.bal;
-      r->avl.cache = 1;
-      *buf_prev++ = q = r;
-    }
-    else
-    {
-      t = buf_prev++;
-      s = r;
-
-      while (s->avl.left != NULL)
-      {
-        *buf_prev++ = r = s;
-        s = r->avl.left;
-        r->avl.cache = -1;
-      }
+  rtems_chain_set_off_chain (&dd->swapout.node);
+  rtems_chain_initialize_empty (&dd->swapout.modified);
+  rtems_chain_initialize_empty (&dd->swapout.sync);
+  rtems_mutex_init (&dd->swapout.sync_lock, "bdbuf sync lock");
+  dd->swapout.sync_requester = 0;
+  dd->swapout.sync_active = false;
+  dd->swapout.transfer_active = false;
 
-      s->avl.left = q->avl.left;
-      r->avl.left = s->avl.right;
-      s->avl.right = q->avl.right;
-      s->avl.bal = q->avl.bal;
-      s->avl.cache = 1;
+  return RTEMS_SUCCESSFUL;
+}
 
-      *t = q = s;
-    }
-  }
+/**
+ * Searches for the BD with specified block in the hash table of the disk
+ * device.
+ *
+ * @param dd disk device search key
+ * @param block block search key
+ * @retval NULL BD with the specified dd/block is not found
+ * @return pointer to the BD with specified dd/block
+ */
+static rtems_bdbuf_buffer *
+rtems_bdbuf_hash_search (const rtems_disk_device *dd,
+                         rtems_blkdev_bnum        block)
+{
+  rtems_bdbuf_buffer* p = *rtems_bdbuf_hash_bucket (dd, block);
 
-  if (p != NULL)
-  {
-    if (p->avl.cache == -1)
-    {
-      p->avl.left = q;
-    }
-    else
-    {
-      p->avl.right = q;
-    }
-  }
-  else
+  while ((p != NULL) && (p->block != block))
   {
-    *root = q;
+    p = p->hash_next;
   }
 
-  modified = true;
-
-  while (modified)
-  {
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
-    }
-    else
-    {
-      break;
-    }
-
-    if (p->avl.cache == -1)
-    {
-      /* rebalance left branch */
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          break;
-        case  0:
-          p->avl.bal = 1;
-          modified = false;
-          break;
-
-        case +1:
-          p1 = p->avl.right;
-
-          if (p1->avl.bal >= 0) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = -1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = 1; else p1->avl.bal = 0;
-
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
-
-        default:
-          break;
-      }
-    }
-    else
-    {
-      /* rebalance right branch */
-      switch (p->avl.bal)
-      {
-        case +1:
-          p->avl.bal = 0;
-          break;
-
-        case  0:
-          p->avl.bal = -1;
-          modified = false;
-          break;
-
-        case -1:
-          p1 = p->avl.left;
+  return p;
+}
 
-          if (p1->avl.bal <= 0) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = 1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
+/**
+ * Inserts the specified BD to the hash table of its disk device.
+ *
+ * @param node Pointer to the BD to add.
+ * @retval 0 The BD added successfully
+ * @retval -1 A BD with the same dd/block is already present
+ */
+static int
+rtems_bdbuf_hash_insert (rtems_bdbuf_buffer* node)
+{
+  rtems_bdbuf_buffer** bucket = rtems_bdbuf_hash_bucket (node->dd,
+                                                         node->block);
+  rtems_bdbuf_buffer*  p = *bucket;
 
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
+  while (p != NULL)
+  {
+    if (p->block == node->block)
+      return -1;
 
-            if (p2->avl.bal == -1) p->avl.bal = 1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
+    p = p->hash_next;
+  }
 
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
+  node->hash_next = *bucket;
+  *bucket = node;
 
-        default:
-          break;
-      }
-    }
+  return 0;
+}
 
-    if (buf_prev > buf_stack)
-    {
-      q = *(buf_prev - 1);
+/**
+ * Removes the BD from the hash table of its disk device.
+ *
+ * @param node Pointer to the BD to remove
+ * @retval 0 BD removed
+ * @retval -1 No such BD found
+ */
+static int
+rtems_bdbuf_hash_remove (const rtems_bdbuf_buffer* node)
+{
+  rtems_bdbuf_buffer** prev = rtems_bdbuf_hash_bucket (node->dd,
+                                                       node->block);
 
-      if (q->avl.cache == -1)
-      {
-        q->avl.left = p;
-      }
-      else
-      {
-        q->avl.right = p;
-      }
-    }
-    else
+  while (*prev != NULL)
+  {
+    if (*prev == node)
     {
-      *root = p;
-      break;
+      *prev = node->hash_next;
+      return 0;
     }
 
+    prev = &(*prev)->hash_next;
   }
 
-  return 0;
+  return -1;
 }
 
 static void
@@ -842,21 +563,25 @@ rtems_bdbuf_unlock_cache (void)
 }
 
 /**
- * Lock the cache's sync. A single task can nest calls.
+ * Lock the device's sync. A single task can nest calls.
+ *
+ * @param dd The disk device.
  */
 static void
-rtems_bdbuf_lock_sync (void)
+rtems_bdbuf_lock_sync (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock (&bdbuf_cache.sync_lock);
+  rtems_bdbuf_lock (&dd->swapout.sync_lock);
 }
 
 /**
- * Unlock the cache's sync lock. Any blocked writers are woken.
+ * Unlock the device's sync lock. Any blocked writers are woken.
+ *
+ * @param dd The disk device.
  */
 static void
-rtems_bdbuf_unlock_sync (void)
+rtems_bdbuf_unlock_sync (rtems_disk_device *dd)
 {
-  rtems_bdbuf_unlock (&bdbuf_cache.sync_lock);
+  rtems_bdbuf_unlock (&dd->swapout.sync_lock);
 }
 
 static void
@@ -937,22 +662,70 @@ rtems_bdbuf_has_buffer_waiters (void)
   return bdbuf_cache.buffer_waiters.count;
 }
 
+/**
+ * Puts the device on the device chain of the swapout task if necessary.
+ *
+ * @param dd The disk device.
+ */
+static void
+rtems_bdbuf_swapout_add_device (rtems_disk_device *dd)
+{
+  if (rtems_chain_is_node_off_chain (&dd->swapout.node))
+    rtems_chain_append_unprotected (&bdbuf_cache.swapout_devices,
+                                    &dd->swapout.node);
+}
+
+static void
+rtems_bdbuf_swapout_remove_device (rtems_disk_device *dd)
+{
+  if (!rtems_chain_is_node_off_chain (&dd->swapout.node))
+  {
+    rtems_chain_extract_unprotected (&dd->swapout.node);
+    rtems_chain_set_off_chain (&dd->swapout.node);
+  }
+}
+
 static void
-rtems_bdbuf_remove_from_tree (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_add_to_sync_list (rtems_bdbuf_buffer *bd)
 {
-  if (rtems_bdbuf_avl_remove (&bdbuf_cache.tree, bd) != 0)
+  rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
+  rtems_chain_append_unprotected (&bd->dd->swapout.sync, &bd->link);
+  rtems_bdbuf_swapout_add_device (bd->dd);
+}
+
+static void
+rtems_bdbuf_remove_from_hash (rtems_bdbuf_buffer *bd)
+{
+  if (rtems_bdbuf_hash_remove (bd) != 0)
     rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_TREE_RM);
 }
 
+/**
+ * Accounts a read-ahead miss if the buffer was read ahead and not accessed
+ * since.
+ *
+ * @param bd The buffer which is recycled or discarded.
+ */
+static void
+rtems_bdbuf_read_ahead_unused (rtems_bdbuf_buffer *bd)
+{
+  if (bd->read_ahead)
+  {
+    bd->read_ahead = false;
+    ++bd->dd->stats.read_ahead_misses;
+  }
+}
+
 static void
-rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_hash_and_lru_list (rtems_bdbuf_buffer *bd)
 {
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_FREE:
       break;
     case RTEMS_BDBUF_STATE_CACHED:
-      rtems_bdbuf_remove_from_tree (bd);
+      rtems_bdbuf_read_ahead_unused (bd);
+      rtems_bdbuf_remove_from_hash (bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_10);
@@ -984,11 +757,12 @@ rtems_bdbuf_make_cached_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
 static void
 rtems_bdbuf_discard_buffer (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_read_ahead_unused (bd);
   rtems_bdbuf_make_empty (bd);
 
   if (bd->waiters == 0)
   {
-    rtems_bdbuf_remove_from_tree (bd);
+    rtems_bdbuf_remove_from_hash (bd);
     rtems_bdbuf_make_free_and_add_to_lru_list (bd);
   }
 }
@@ -996,16 +770,18 @@ rtems_bdbuf_discard_buffer (rtems_bdbuf_buffer *bd)
 static void
 rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
 {
-  if (bdbuf_cache.sync_active && bdbuf_cache.sync_device == bd->dd)
+  rtems_disk_device *dd = bd->dd;
+
+  if (dd->swapout.sync_active)
   {
     rtems_bdbuf_unlock_cache ();
 
     /*
-     * Wait for the sync lock.
+     * Wait for the sync lock of the device.
      */
-    rtems_bdbuf_lock_sync ();
+    rtems_bdbuf_lock_sync (dd);
 
-    rtems_bdbuf_unlock_sync ();
+    rtems_bdbuf_unlock_sync (dd);
     rtems_bdbuf_lock_cache ();
   }
 
@@ -1025,7 +801,8 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
     bd->hold_timer = bdbuf_config.swap_block_hold;
 
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_MODIFIED);
-  rtems_chain_append_unprotected (&bdbuf_cache.modified, &bd->link);
+  rtems_chain_append_unprotected (&dd->swapout.modified, &bd->link);
+  rtems_bdbuf_swapout_add_device (dd);
 
   if (bd->waiters)
     rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
@@ -1083,7 +860,7 @@ rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_buffer *bd)
 
 /**
  * Reallocate a group. The BDs currently allocated in the group are removed
- * from the ALV tree and any lists then the new BD's are prepended to the ready
+ * from the hash table of their disk device and any lists then the new BD's are prepended to the ready
  * list of the cache.
  *
  * @param group The group to reallocate.
@@ -1107,7 +884,7 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
   for (b = 0, bd = group->bdbuf;
        b < group->bds_per_group;
        b++, bd += bufs_per_bd)
-    rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+    rtems_bdbuf_remove_from_hash_and_lru_list (bd);
 
   group->bds_per_group = new_bds_per_group;
   bufs_per_bd = bdbuf_cache.max_bds_per_group / new_bds_per_group;
@@ -1128,13 +905,12 @@ rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
                                 rtems_disk_device  *dd,
                                 rtems_blkdev_bnum   block)
 {
-  bd->dd        = dd ;
-  bd->block     = block;
-  bd->avl.left  = NULL;
-  bd->avl.right = NULL;
-  bd->waiters   = 0;
+  bd->dd         = dd ;
+  bd->block      = block;
+  bd->waiters    = 0;
+  bd->read_ahead = false;
 
-  if (rtems_bdbuf_avl_insert (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_hash_insert (bd) != 0)
     rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RECYCLE);
 
   rtems_bdbuf_make_empty (bd);
@@ -1164,7 +940,7 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
     {
       if (bd->group->bds_per_group == dd->bds_per_group)
       {
-        rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+        rtems_bdbuf_remove_from_hash_and_lru_list (bd);
 
         empty_bd = bd;
       }
@@ -1321,16 +1097,12 @@ rtems_bdbuf_do_init (void)
       > RTEMS_MINIMUM_STACK_SIZE / 8U)
     return RTEMS_INVALID_NUMBER;
 
-  bdbuf_cache.sync_device = BDBUF_INVALID_DEV;
-
   rtems_chain_initialize_empty (&bdbuf_cache.swapout_free_workers);
+  rtems_chain_initialize_empty (&bdbuf_cache.swapout_devices);
   rtems_chain_initialize_empty (&bdbuf_cache.lru);
-  rtems_chain_initialize_empty (&bdbuf_cache.modified);
-  rtems_chain_initialize_empty (&bdbuf_cache.sync);
   rtems_chain_initialize_empty (&bdbuf_cache.read_ahead_chain);
 
   rtems_mutex_set_name (&bdbuf_cache.lock, "bdbuf lock");
-  rtems_mutex_set_name (&bdbuf_cache.sync_lock, "bdbuf sync lock");
   rtems_condition_variable_set_name (&bdbuf_cache.access_waiters.cond_var,
                                      "bdbuf access");
   rtems_condition_variable_set_name (&bdbuf_cache.transfer_waiters.cond_var,
@@ -1576,9 +1348,8 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
 static void
 rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
 {
-  rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
   rtems_chain_extract_unprotected (&bd->link);
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_bdbuf_add_to_sync_list (bd);
   rtems_bdbuf_wake_swapper ();
 }
 
@@ -1661,7 +1432,7 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
 static void
 rtems_bdbuf_wait_for_buffer (void)
 {
-  if (!rtems_chain_is_empty (&bdbuf_cache.modified))
+  if (!rtems_chain_is_empty (&bdbuf_cache.swapout_devices))
     rtems_bdbuf_wake_swapper ();
 
   rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
@@ -1670,9 +1441,7 @@ rtems_bdbuf_wait_for_buffer (void)
 static void
 rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
 {
-  rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
-
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_bdbuf_add_to_sync_list (bd);
 
   if (bd->waiters)
     rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
@@ -1689,7 +1458,7 @@ rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
   {
     if (bd->state == RTEMS_BDBUF_STATE_EMPTY)
     {
-      rtems_bdbuf_remove_from_tree (bd);
+      rtems_bdbuf_remove_from_hash (bd);
       rtems_bdbuf_make_free_and_add_to_lru_list (bd);
     }
     rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
@@ -1702,14 +1471,17 @@ rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
 {
   rtems_bdbuf_buffer *bd = NULL;
 
-  bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+  bd = rtems_bdbuf_hash_search (dd, block);
 
   if (bd == NULL)
   {
     bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
 
     if (bd != NULL)
+    {
       rtems_bdbuf_group_obtain (bd);
+      bd->read_ahead = true;
+    }
   }
   else
     /*
@@ -1729,7 +1501,7 @@ rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
 
   do
   {
-    bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+    bd = rtems_bdbuf_hash_search (dd, block);
 
     if (bd != NULL)
     {
@@ -1737,7 +1509,7 @@ rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
       {
         if (rtems_bdbuf_wait_for_recycle (bd))
         {
-          rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+          rtems_bdbuf_remove_from_hash_and_lru_list (bd);
           rtems_bdbuf_make_free_and_add_to_lru_list (bd);
           rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
         }
@@ -1810,6 +1582,7 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
+        bd->read_ahead = false;
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
@@ -2013,16 +1786,99 @@ rtems_bdbuf_read_ahead_cancel (rtems_disk_device *dd)
 static void
 rtems_bdbuf_read_ahead_reset (rtems_disk_device *dd)
 {
+  size_t i;
+
   rtems_bdbuf_read_ahead_cancel (dd);
-  dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i)
+  {
+    rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams [i];
+
+    stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+    stream->window = 0;
+    stream->pending = false;
+  }
+}
+
+/**
+ * Moves the stream to the front of the streams of the disk device.  This
+ * keeps the streams ordered from the most to the least recently used one.
+ *
+ * @param dd The disk device.
+ * @param index The index of the stream.
+ * @return The stream at its new position.
+ */
+static rtems_blkdev_read_ahead_stream *
+rtems_bdbuf_read_ahead_use_stream (rtems_disk_device *dd, size_t index)
+{
+  rtems_blkdev_read_ahead_stream *streams = dd->read_ahead.streams;
+  rtems_blkdev_read_ahead_stream  stream = streams [index];
+
+  memmove (&streams [1], &streams [0], index * sizeof (streams [0]));
+  streams [0] = stream;
+
+  return &streams [0];
+}
+
+/**
+ * Returns the index of the stream with the specified trigger block, otherwise
+ * RTEMS_DISK_READ_AHEAD_STREAM_COUNT.
+ */
+static size_t
+rtems_bdbuf_read_ahead_find_trigger (const rtems_disk_device *dd,
+                                     rtems_blkdev_bnum        block)
+{
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i)
+  {
+    if (dd->read_ahead.streams [i].trigger == block)
+      break;
+  }
+
+  return i;
+}
+
+/**
+ * Returns the index of the stream which read ahead the specified block beyond
+ * its trigger, otherwise RTEMS_DISK_READ_AHEAD_STREAM_COUNT.  A read miss of
+ * such a block indicates that the window of the stream is too large for the
+ * cache.
+ */
+static size_t
+rtems_bdbuf_read_ahead_find_window (const rtems_disk_device *dd,
+                                    rtems_blkdev_bnum        block)
+{
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i)
+  {
+    const rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams [i];
+
+    if (stream->trigger != RTEMS_DISK_READ_AHEAD_NO_TRIGGER
+        && stream->window != 0
+        && stream->trigger <= block
+        && block < stream->next)
+      break;
+  }
+
+  return i;
 }
 
 static void
-rtems_bdbuf_read_ahead_add_to_chain (rtems_disk_device *dd)
+rtems_bdbuf_read_ahead_request (rtems_disk_device              *dd,
+                                rtems_blkdev_read_ahead_stream *stream,
+                                uint32_t                        nr_blocks)
 {
   rtems_status_code sc;
   rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
 
+  stream->nr_blocks = nr_blocks;
+  stream->pending = true;
+
+  if (rtems_bdbuf_is_read_ahead_active (dd))
+    return;
+
   if (rtems_chain_is_empty (chain))
   {
     sc = rtems_event_send (bdbuf_cache.read_ahead_task,
@@ -2038,12 +1894,20 @@ static void
 rtems_bdbuf_check_read_ahead_trigger (rtems_disk_device *dd,
                                       rtems_blkdev_bnum  block)
 {
-  if (bdbuf_cache.read_ahead_task != 0
-      && dd->read_ahead.trigger == block
-      && !rtems_bdbuf_is_read_ahead_active (dd))
+  if (bdbuf_cache.read_ahead_task != 0)
   {
-    dd->read_ahead.nr_blocks = RTEMS_DISK_READ_AHEAD_SIZE_AUTO;
-    rtems_bdbuf_read_ahead_add_to_chain(dd);
+    size_t index = rtems_bdbuf_read_ahead_find_trigger (dd, block);
+
+    if (index < RTEMS_DISK_READ_AHEAD_STREAM_COUNT)
+    {
+      rtems_blkdev_read_ahead_stream *stream =
+        rtems_bdbuf_read_ahead_use_stream (dd, index);
+
+      if (!stream->pending)
+        rtems_bdbuf_read_ahead_request (dd,
+                                        stream,
+                                        RTEMS_DISK_READ_AHEAD_SIZE_AUTO);
+    }
   }
 }
 
@@ -2051,14 +1915,70 @@ static void
 rtems_bdbuf_set_read_ahead_trigger (rtems_disk_device *dd,
                                     rtems_blkdev_bnum  block)
 {
-  if (dd->read_ahead.trigger != block)
+  if (rtems_bdbuf_read_ahead_find_trigger (dd, block)
+      == RTEMS_DISK_READ_AHEAD_STREAM_COUNT)
   {
-    rtems_bdbuf_read_ahead_cancel (dd);
-    dd->read_ahead.trigger = block + 1;
-    dd->read_ahead.next = block + 2;
+    rtems_blkdev_read_ahead_stream *stream;
+    size_t                          index;
+    uint32_t                        window;
+
+    index = rtems_bdbuf_read_ahead_find_window (dd, block);
+
+    if (index < RTEMS_DISK_READ_AHEAD_STREAM_COUNT)
+    {
+      /*
+       * Blocks of this stream were recycled before they were read.  Restart
+       * the stream at this block with half the window of the stream.
+       */
+      stream = rtems_bdbuf_read_ahead_use_stream (dd, index);
+      window = stream->window / 2;
+
+      if (window == 0)
+        window = 1;
+    }
+    else
+    {
+      /*
+       * This may be the start of a new stream or a random access.  Replace
+       * the least recently used stream.
+       */
+      stream = rtems_bdbuf_read_ahead_use_stream (
+        dd,
+        RTEMS_DISK_READ_AHEAD_STREAM_COUNT - 1
+      );
+      window = 0;
+    }
+
+    stream->trigger = block + 1;
+    stream->next = block + 2;
+    stream->window = window;
+    stream->pending = false;
   }
 }
 
+/**
+ * Returns the most recently used stream with a pending read-ahead request,
+ * otherwise NULL.
+ */
+static rtems_blkdev_read_ahead_stream *
+rtems_bdbuf_read_ahead_get_pending (rtems_disk_device *dd)
+{
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i)
+  {
+    rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams [i];
+
+    if (stream->pending)
+    {
+      stream->pending = false;
+      return stream;
+    }
+  }
+
+  return NULL;
+}
+
 rtems_status_code
 rtems_bdbuf_read (rtems_disk_device   *dd,
                   rtems_blkdev_bnum    block,
@@ -2082,6 +2002,11 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
     {
       case RTEMS_BDBUF_STATE_CACHED:
         ++dd->stats.read_hits;
+        if (bd->read_ahead)
+        {
+          bd->read_ahead = false;
+          ++dd->stats.read_ahead_hits;
+        }
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_MODIFIED:
@@ -2108,12 +2033,215 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
         break;
     }
 
-    rtems_bdbuf_check_read_ahead_trigger (dd, block);
-  }
+    rtems_bdbuf_check_read_ahead_trigger (dd, block);
+  }
+
+  rtems_bdbuf_unlock_cache ();
+
+  *bd_ptr = bd;
+
+  return sc;
+}
+
+static uint32_t
+rtems_bdbuf_uncached_blocks (rtems_disk_device *dd,
+                             rtems_blkdev_bnum  block,
+                             uint32_t           block_count,
+                             uint32_t           max_blocks)
+{
+  uint32_t count = 0;
+
+  while (count < block_count && count < max_blocks)
+  {
+    rtems_blkdev_bnum media_block =
+      rtems_bdbuf_media_block (dd, block + count) + dd->start;
+
+    if (rtems_bdbuf_hash_search (dd, media_block) != NULL)
+      break;
+
+    ++count;
+  }
+
+  return count;
+}
+
+static rtems_status_code
+rtems_bdbuf_execute_direct_read (rtems_disk_device *dd,
+                                 rtems_blkdev_bnum  block,
+                                 uint32_t           block_count,
+                                 uint8_t           *buffer,
+                                 bool               multi_block_buffer)
+{
+  rtems_blkdev_request *req = NULL;
+  rtems_blkdev_bnum media_block = rtems_bdbuf_media_block (dd, block) + dd->start;
+  uint32_t block_size = dd->block_size;
+  uint32_t transfer_count = multi_block_buffer ? 1 : block_count;
+  uint32_t transfer_index;
+  rtems_status_code sc;
+
+  if (rtems_bdbuf_tracer)
+    printf ("bdbuf:read-blocks: %" PRIu32 " (%" PRIu32 ") count=%" PRIu32
+            " (dev = %08x)\n",
+            media_block, block, block_count, (unsigned) dd->dev);
+
+  req = bdbuf_alloc (rtems_bdbuf_read_request_size (transfer_count));
+
+  req->req = RTEMS_BLKDEV_REQ_READ;
+  req->done = rtems_bdbuf_transfer_done;
+  req->io_task = rtems_task_self ();
+  req->bufnum = transfer_count;
+
+  if (multi_block_buffer)
+  {
+    req->bufs [0].user   = NULL;
+    req->bufs [0].block  = media_block;
+    req->bufs [0].length = block_count * block_size;
+    req->bufs [0].buffer = buffer;
+  }
+  else
+  {
+    for (transfer_index = 0; transfer_index < transfer_count; ++transfer_index)
+    {
+      req->bufs [transfer_index].user   = NULL;
+      req->bufs [transfer_index].block  = media_block;
+      req->bufs [transfer_index].length = block_size;
+      req->bufs [transfer_index].buffer = buffer;
+
+      media_block += dd->media_blocks_per_block;
+      buffer += block_size;
+    }
+  }
+
+  /* The return value will be ignored for transfer requests */
+  dd->ioctl (dd->phys_dev, RTEMS_BLKIO_REQUEST, req);
+
+  /* Wait for transfer request completion */
+  rtems_bdbuf_wait_for_transient_event ();
+  sc = req->status;
+
+  rtems_bdbuf_lock_cache ();
+
+  /* Statistics */
+  dd->stats.read_misses += block_count;
+  dd->stats.read_blocks += block_count;
+  if (sc != RTEMS_SUCCESSFUL)
+    ++dd->stats.read_errors;
+
+  rtems_bdbuf_unlock_cache ();
+
+  if (sc == RTEMS_SUCCESSFUL)
+    return sc;
+  else
+    return RTEMS_IO_ERROR;
+}
+
+static rtems_status_code
+rtems_bdbuf_read_cached_block (rtems_disk_device *dd,
+                               rtems_blkdev_bnum  block,
+                               uint8_t           *data)
+{
+  rtems_bdbuf_buffer *bd;
+  rtems_status_code   sc;
+
+  sc = rtems_bdbuf_read (dd, block, &bd);
+  if (sc == RTEMS_SUCCESSFUL)
+  {
+    memcpy (data, bd->buffer, dd->block_size);
+    sc = rtems_bdbuf_release (bd);
+  }
+
+  return sc;
+}
+
+/*
+ * The cache is not locked during a direct read transfer.  Blocks of the range
+ * may enter the cache and be modified in the meantime, so the data read from
+ * the device may be stale.  Copy the blocks which are in the cache now.
+ */
+static rtems_status_code
+rtems_bdbuf_read_blocks_entered_cache (rtems_disk_device *dd,
+                                       rtems_blkdev_bnum  block,
+                                       uint32_t           block_count,
+                                       uint8_t           *data)
+{
+  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  uint32_t          i;
+
+  rtems_bdbuf_lock_cache ();
+
+  for (i = 0; i < block_count; ++i)
+  {
+    rtems_blkdev_bnum media_block =
+      rtems_bdbuf_media_block (dd, block + i) + dd->start;
+
+    if (rtems_bdbuf_hash_search (dd, media_block) != NULL)
+    {
+      rtems_bdbuf_unlock_cache ();
+
+      sc = rtems_bdbuf_read_cached_block (dd,
+                                          block + i,
+                                          data + i * dd->block_size);
+      if (sc != RTEMS_SUCCESSFUL)
+        return sc;
+
+      rtems_bdbuf_lock_cache ();
+    }
+  }
+
+  rtems_bdbuf_unlock_cache ();
+
+  return sc;
+}
+
+rtems_status_code
+rtems_bdbuf_read_blocks (rtems_disk_device *dd,
+                         rtems_blkdev_bnum  block,
+                         uint32_t           block_count,
+                         void              *buffer)
+{
+  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  uint8_t *data = buffer;
+  uint32_t block_size = dd->block_size;
+  bool multi_block_buffer =
+    (dd->phys_dev->capabilities & RTEMS_BLKDEV_CAP_MULTIBLOCK_BUFFER) != 0;
+  uint32_t max_blocks;
+
+  if (block_count > dd->block_count || block > dd->block_count - block_count)
+    return RTEMS_INVALID_ID;
 
-  rtems_bdbuf_unlock_cache ();
+  if (multi_block_buffer)
+    max_blocks = UINT32_MAX / block_size;
+  else
+    max_blocks = RTEMS_BDBUF_DIRECT_READ_MAX_BUFFERS;
 
-  *bd_ptr = bd;
+  while (sc == RTEMS_SUCCESSFUL && block_count > 0)
+  {
+    uint32_t count;
+
+    rtems_bdbuf_lock_cache ();
+    count = rtems_bdbuf_uncached_blocks (dd, block, block_count, max_blocks);
+    rtems_bdbuf_unlock_cache ();
+
+    if (count > 0)
+    {
+      sc = rtems_bdbuf_execute_direct_read (dd,
+                                            block,
+                                            count,
+                                            data,
+                                            multi_block_buffer);
+      if (sc == RTEMS_SUCCESSFUL)
+        sc = rtems_bdbuf_read_blocks_entered_cache (dd, block, count, data);
+    }
+    else
+    {
+      count = 1;
+      sc = rtems_bdbuf_read_cached_block (dd, block, data);
+    }
+
+    block += count;
+    block_count -= count;
+    data += count * block_size;
+  }
 
   return sc;
 }
@@ -2127,10 +2255,12 @@ rtems_bdbuf_peek (rtems_disk_device *dd,
 
   if (bdbuf_cache.read_ahead_enabled && nr_blocks > 0)
   {
-    rtems_bdbuf_read_ahead_reset(dd);
-    dd->read_ahead.next = block;
-    dd->read_ahead.nr_blocks = nr_blocks;
-    rtems_bdbuf_read_ahead_add_to_chain(dd);
+    rtems_blkdev_read_ahead_stream *stream;
+
+    rtems_bdbuf_read_ahead_reset (dd);
+    stream = rtems_bdbuf_read_ahead_use_stream (dd, 0);
+    stream->next = block;
+    rtems_bdbuf_read_ahead_request (dd, stream, nr_blocks);
   }
 
   rtems_bdbuf_unlock_cache ();
@@ -2256,29 +2386,31 @@ rtems_bdbuf_syncdev (rtems_disk_device *dd)
     printf ("bdbuf:syncdev: %08x\n", (unsigned) dd->dev);
 
   /*
-   * Take the sync lock before locking the cache. Once we have the sync lock we
-   * can lock the cache. If another thread has the sync lock it will cause this
-   * thread to block until it owns the sync lock then it can own the cache. The
-   * sync lock can only be obtained with the cache unlocked.
+   * Take the sync lock of the device before locking the cache. Once we have
+   * the sync lock we can lock the cache. If another thread has the sync lock
+   * it will cause this thread to block until it owns the sync lock then it can
+   * own the cache. The sync lock can only be obtained with the cache unlocked.
+   * A sync of another device is not blocked by this sync.
    */
-  rtems_bdbuf_lock_sync ();
+  rtems_bdbuf_lock_sync (dd);
   rtems_bdbuf_lock_cache ();
 
   /*
-   * Set the cache to have a sync active for a specific device and let the swap
-   * out task know the id of the requester to wake when done.
+   * Set the device to have a sync active and let the swap out task know the
+   * id of the requester to wake when done.
    *
    * The swap out task will negate the sync active flag when no more buffers
-   * for the device are held on the "modified for sync" queues.
+   * for the device are held on the modified and sync lists of the device and
+   * no write transfer of the device is in progress.
    */
-  bdbuf_cache.sync_active    = true;
-  bdbuf_cache.sync_requester = rtems_task_self ();
-  bdbuf_cache.sync_device    = dd;
+  dd->swapout.sync_active    = true;
+  dd->swapout.sync_requester = rtems_task_self ();
+  rtems_bdbuf_swapout_add_device (dd);
 
   rtems_bdbuf_wake_swapper ();
   rtems_bdbuf_unlock_cache ();
   rtems_bdbuf_wait_for_transient_event ();
-  rtems_bdbuf_unlock_sync ();
+  rtems_bdbuf_unlock_sync (dd);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2393,138 +2525,180 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
 }
 
 /**
- * Process the modified list of buffers. There is a sync or modified list that
- * needs to be handled so we have a common function to do the work.
+ * Process the modified list of buffers of a device. There is a sync or
+ * modified list that needs to be handled so we have a common function to do
+ * the work.
  *
- * @param dd_ptr Pointer to the device to handle. If BDBUF_INVALID_DEV no
- * device is selected so select the device of the first buffer to be written to
- * disk.
  * @param chain The modified chain to process.
  * @param transfer The chain to append buffers to be written too.
- * @param sync_active If true this is a sync operation so expire all timers.
- * @param update_timers If true update the timers.
- * @param timer_delta It update_timers is true update the timers by this
- *                    amount.
+ * @param force If true expire all timers of the buffers on the chain.
  */
 static void
-rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
-                                         rtems_chain_control* chain,
+rtems_bdbuf_swapout_modified_processing (rtems_chain_control* chain,
                                          rtems_chain_control* transfer,
-                                         bool                 sync_active,
-                                         bool                 update_timers,
-                                         uint32_t             timer_delta)
+                                         bool                 force)
 {
-  if (!rtems_chain_is_empty (chain))
-  {
-    rtems_chain_node* node = rtems_chain_head (chain);
-    bool              sync_all;
+  rtems_chain_node* node = rtems_chain_first (chain);
 
-    node = node->next;
+  while (!rtems_chain_is_tail (chain, node))
+  {
+    rtems_bdbuf_buffer* bd = (rtems_bdbuf_buffer*) node;
+    rtems_chain_node*   next_node = node->next;
 
     /*
-     * A sync active with no valid dev means sync all.
+     * Check if the buffer's hold timer has reached 0. If a sync is active or
+     * someone waits for a buffer written force all the timers to 0.
+     *
+     * @note Lots of sync requests will skew this timer. It should be based
+     *       on TOD to be accurate. Does it matter ?
      */
-    if (sync_active && (*dd_ptr == BDBUF_INVALID_DEV))
-      sync_all = true;
-    else
-      sync_all = false;
+    if (force)
+      bd->hold_timer = 0;
 
-    while (!rtems_chain_is_tail (chain, node))
+    if (bd->hold_timer == 0)
     {
-      rtems_bdbuf_buffer* bd = (rtems_bdbuf_buffer*) node;
+      rtems_chain_node* tnode = rtems_chain_tail (transfer);
 
       /*
-       * Check if the buffer's hold timer has reached 0. If a sync is active
-       * or someone waits for a buffer written force all the timers to 0.
-       *
-       * @note Lots of sync requests will skew this timer. It should be based
-       *       on TOD to be accurate. Does it matter ?
+       * The blocks on the transfer list are sorted in block order. This
+       * means multi-block transfers for drivers that require consecutive
+       * blocks perform better with sorted blocks and for real disks it may
+       * help lower head movement.
        */
-      if (sync_all || (sync_active && (*dd_ptr == bd->dd))
-          || rtems_bdbuf_has_buffer_waiters ())
-        bd->hold_timer = 0;
 
-      if (bd->hold_timer)
+      rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
+
+      rtems_chain_extract_unprotected (node);
+
+      tnode = tnode->previous;
+
+      while (node && !rtems_chain_is_head (transfer, tnode))
       {
-        if (update_timers)
-        {
-          if (bd->hold_timer > timer_delta)
-            bd->hold_timer -= timer_delta;
-          else
-            bd->hold_timer = 0;
-        }
+        rtems_bdbuf_buffer* tbd = (rtems_bdbuf_buffer*) tnode;
 
-        if (bd->hold_timer)
+        if (bd->block > tbd->block)
         {
-          node = node->next;
-          continue;
+          rtems_chain_insert_unprotected (tnode, node);
+          node = NULL;
         }
+        else
+          tnode = tnode->previous;
       }
 
-      /*
-       * This assumes we can set it to BDBUF_INVALID_DEV which is just an
-       * assumption. Cannot use the transfer list being empty the sync dev
-       * calls sets the dev to use.
-       */
-      if (*dd_ptr == BDBUF_INVALID_DEV)
-        *dd_ptr = bd->dd;
+      if (node)
+        rtems_chain_prepend_unprotected (transfer, node);
+    }
 
-      if (bd->dd == *dd_ptr)
-      {
-        rtems_chain_node* next_node = node->next;
-        rtems_chain_node* tnode = rtems_chain_tail (transfer);
+    node = next_node;
+  }
+}
 
-        /*
-         * The blocks on the transfer list are sorted in block order. This
-         * means multi-block transfers for drivers that require consecutive
-         * blocks perform better with sorted blocks and for real disks it may
-         * help lower head movement.
-         */
+/**
+ * Update the hold timers of the modified buffers of all devices.
+ *
+ * @param timer_delta Update the timers by this amount.
+ */
+static void
+rtems_bdbuf_swapout_update_timers (uint32_t timer_delta)
+{
+  rtems_chain_node* dd_node = rtems_chain_first (&bdbuf_cache.swapout_devices);
+
+  while (!rtems_chain_is_tail (&bdbuf_cache.swapout_devices, dd_node))
+  {
+    rtems_disk_device*   dd =
+      RTEMS_CONTAINER_OF (dd_node, rtems_disk_device, swapout.node);
+    rtems_chain_control* chain = &dd->swapout.modified;
+    rtems_chain_node*    node = rtems_chain_first (chain);
 
-        rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
+    while (!rtems_chain_is_tail (chain, node))
+    {
+      rtems_bdbuf_buffer* bd = (rtems_bdbuf_buffer*) node;
 
-        rtems_chain_extract_unprotected (node);
+      if (bd->hold_timer > timer_delta)
+        bd->hold_timer -= timer_delta;
+      else
+        bd->hold_timer = 0;
 
-        tnode = tnode->previous;
+      node = rtems_chain_next (node);
+    }
 
-        while (node && !rtems_chain_is_head (transfer, tnode))
-        {
-          rtems_bdbuf_buffer* tbd = (rtems_bdbuf_buffer*) tnode;
+    dd_node = rtems_chain_next (dd_node);
+  }
+}
 
-          if (bd->block > tbd->block)
-          {
-            rtems_chain_insert_unprotected (tnode, node);
-            node = NULL;
-          }
-          else
-            tnode = tnode->previous;
-        }
+/**
+ * Gather the buffers of the device suitable to be written to disk. Check the
+ * sync list first then the modified list.
+ *
+ * @param dd The disk device.
+ * @param transfer The transfer transaction data.
+ *
+ * @retval true There are buffers to transfer.
+ * @retval false There is nothing to transfer.
+ */
+static bool
+rtems_bdbuf_swapout_gather (rtems_disk_device*            dd,
+                            rtems_bdbuf_swapout_transfer* transfer)
+{
+  bool sync_active = dd->swapout.sync_active;
+
+  rtems_chain_initialize_empty (&transfer->bds);
+  transfer->dd = dd;
+  transfer->syncing = sync_active;
 
-        if (node)
-          rtems_chain_prepend_unprotected (transfer, node);
+  rtems_bdbuf_swapout_modified_processing (&dd->swapout.sync,
+                                           &transfer->bds,
+                                           true);
 
-        node = next_node;
-      }
-      else
-      {
-        node = node->next;
-      }
-    }
+  rtems_bdbuf_swapout_modified_processing (&dd->swapout.modified,
+                                           &transfer->bds,
+                                           sync_active
+                                             || rtems_bdbuf_has_buffer_waiters ());
+
+  return !rtems_chain_is_empty (&transfer->bds);
+}
+
+/**
+ * The device has nothing to transfer. Finish an active sync and remove the
+ * device from the device chain of the swapout task if it has no modified
+ * buffers left.
+ *
+ * @param dd The disk device.
+ */
+static void
+rtems_bdbuf_swapout_device_idle (rtems_disk_device *dd)
+{
+  if (dd->swapout.sync_active)
+  {
+    rtems_id sync_requester = dd->swapout.sync_requester;
+
+    dd->swapout.sync_active = false;
+    dd->swapout.sync_requester = 0;
+
+    if (sync_requester)
+      rtems_event_transient_send (sync_requester);
   }
+
+  if (rtems_chain_is_empty (&dd->swapout.modified)
+        && rtems_chain_is_empty (&dd->swapout.sync))
+    rtems_bdbuf_swapout_remove_device (dd);
 }
 
 /**
- * Process the cache's modified buffers. Check the sync list first then the
- * modified list extracting the buffers suitable to be written to disk. We have
- * a device at a time. The task level loop will repeat this operation while
- * there are buffers to be written. If the transfer fails place the buffers
- * back on the modified list and try again later. The cache is unlocked while
- * the buffers are being written to disk.
+ * Process the modified buffers of the devices. For each device check the sync
+ * list first then the modified list extracting the buffers suitable to be
+ * written to disk. A transfer covers one device. The transfer is handed over
+ * to a free swapout worker, so that the devices are written in parallel,
+ * otherwise the swapout task writes the buffers itself. A device with a
+ * transfer in progress is skipped. The task level loop will repeat this
+ * operation while there are buffers to be written. If the transfer fails the
+ * buffers are discarded. The cache is unlocked while the buffers are being
+ * written to disk.
  *
  * @param timer_delta It update_timers is true update the timers by this
  *                    amount.
  * @param update_timers If true update the timers.
- * @param transfer The transfer transaction data.
+ * @param transfer The transfer transaction data of the swapout task.
  *
  * @retval true Buffers where written to disk so scan again.
  * @retval false No buffers where written to disk.
@@ -2534,80 +2708,48 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
                                 bool                          update_timers,
                                 rtems_bdbuf_swapout_transfer* transfer)
 {
-  rtems_bdbuf_swapout_worker* worker;
-  bool                        transfered_buffers = false;
-  bool                        sync_active;
+  bool              transfered_buffers = false;
+  rtems_chain_node* node;
 
   rtems_bdbuf_lock_cache ();
 
-  /*
-   * To set this to true you need the cache and the sync lock.
-   */
-  sync_active = bdbuf_cache.sync_active;
+  if (update_timers)
+    rtems_bdbuf_swapout_update_timers (timer_delta);
 
-  /*
-   * If a sync is active do not use a worker because the current code does not
-   * cleaning up after. We need to know the buffers have been written when
-   * syncing to release sync lock and currently worker threads do not return to
-   * here. We do not know the worker is the last in a sequence of sync writes
-   * until after we have it running so we do not know to tell it to release the
-   * lock. The simplest solution is to get the main swap out task perform all
-   * sync operations.
-   */
-  if (sync_active)
-    worker = NULL;
-  else
+  node = rtems_chain_first (&bdbuf_cache.swapout_devices);
+
+  while (!rtems_chain_is_tail (&bdbuf_cache.swapout_devices, node))
   {
+    rtems_disk_device*            dd =
+      RTEMS_CONTAINER_OF (node, rtems_disk_device, swapout.node);
+    rtems_bdbuf_swapout_worker*   worker;
+    rtems_bdbuf_swapout_transfer* dd_transfer;
+
+    node = rtems_chain_next (node);
+
+    if (dd->swapout.transfer_active)
+      continue;
+
     worker = (rtems_bdbuf_swapout_worker*)
       rtems_chain_get_unprotected (&bdbuf_cache.swapout_free_workers);
     if (worker)
-      transfer = &worker->transfer;
-  }
-
-  rtems_chain_initialize_empty (&transfer->bds);
-  transfer->dd = BDBUF_INVALID_DEV;
-  transfer->syncing = sync_active;
-
-  /*
-   * When the sync is for a device limit the sync to that device. If the sync
-   * is for a buffer handle process the devices in the order on the sync
-   * list. This means the dev is BDBUF_INVALID_DEV.
-   */
-  if (sync_active)
-    transfer->dd = bdbuf_cache.sync_device;
+      dd_transfer = &worker->transfer;
+    else
+      dd_transfer = transfer;
 
-  /*
-   * If we have any buffers in the sync queue move them to the modified
-   * list. The first sync buffer will select the device we use.
-   */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.sync,
-                                           &transfer->bds,
-                                           true, false,
-                                           timer_delta);
+    if (!rtems_bdbuf_swapout_gather (dd, dd_transfer))
+    {
+      if (worker)
+        rtems_chain_prepend_unprotected (&bdbuf_cache.swapout_free_workers,
+                                         &worker->link);
 
-  /*
-   * Process the cache's modified list.
-   */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.modified,
-                                           &transfer->bds,
-                                           sync_active,
-                                           update_timers,
-                                           timer_delta);
+      rtems_bdbuf_swapout_device_idle (dd);
+      continue;
+    }
 
-  /*
-   * We have all the buffers that have been modified for this device so the
-   * cache can be unlocked because the state of each buffer has been set to
-   * TRANSFER.
-   */
-  rtems_bdbuf_unlock_cache ();
+    dd->swapout.transfer_active = true;
+    transfered_buffers = true;
 
-  /*
-   * If there are buffers to transfer to the media transfer them.
-   */
-  if (!rtems_chain_is_empty (&transfer->bds))
-  {
     if (worker)
     {
       rtems_status_code sc = rtems_event_send (worker->id,
@@ -2617,24 +2759,35 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
     }
     else
     {
+      /*
+       * We have all the buffers that have been modified for this device so
+       * the cache can be unlocked because the state of each buffer has been
+       * set to TRANSFER. The device chain may change while the cache is
+       * unlocked so start a new scan afterwards.
+       */
+      rtems_bdbuf_unlock_cache ();
       rtems_bdbuf_swapout_write (transfer);
-    }
+      rtems_bdbuf_lock_cache ();
 
-    transfered_buffers = true;
-  }
+      dd->swapout.transfer_active = false;
 
-  if (sync_active && !transfered_buffers)
-  {
-    rtems_id sync_requester;
-    rtems_bdbuf_lock_cache ();
-    sync_requester = bdbuf_cache.sync_requester;
-    bdbuf_cache.sync_active = false;
-    bdbuf_cache.sync_requester = 0;
-    rtems_bdbuf_unlock_cache ();
-    if (sync_requester)
-      rtems_event_transient_send (sync_requester);
+      /*
+       * Move the device to the end of the device chain so that it does not
+       * starve the other devices.
+       */
+      if (!rtems_chain_is_node_off_chain (&dd->swapout.node))
+      {
+        rtems_chain_extract_unprotected (&dd->swapout.node);
+        rtems_chain_append_unprotected (&bdbuf_cache.swapout_devices,
+                                        &dd->swapout.node);
+      }
+
+      break;
+    }
   }
 
+  rtems_bdbuf_unlock_cache ();
+
   return transfered_buffers;
 }
 
@@ -2651,12 +2804,27 @@ rtems_bdbuf_swapout_worker_task (rtems_task_argument arg)
 
   while (worker->enabled)
   {
+    rtems_disk_device* dd;
+
     rtems_bdbuf_wait_for_event (RTEMS_BDBUF_SWAPOUT_SYNC);
 
     rtems_bdbuf_swapout_write (&worker->transfer);
 
     rtems_bdbuf_lock_cache ();
 
+    dd = worker->transfer.dd;
+    if (dd != BDBUF_INVALID_DEV)
+    {
+      dd->swapout.transfer_active = false;
+
+      /*
+       * Let the swapout task look at the device again, for example to finish
+       * an active sync.
+       */
+      if (!rtems_chain_is_node_off_chain (&dd->swapout.node))
+        rtems_bdbuf_wake_swapper ();
+    }
+
     rtems_chain_initialize_empty (&worker->transfer.bds);
     worker->transfer.dd = BDBUF_INVALID_DEV;
 
@@ -2728,9 +2896,9 @@ rtems_bdbuf_swapout_task (rtems_task_argument arg)
     bool update_timers = true;
 
     /*
-     * If we write buffers to any disk perform a check again. We only write a
-     * single device at a time and the cache may have more than one device's
-     * buffers modified waiting to be written.
+     * If we write buffers to any disk perform a check again. A transfer covers
+     * a single device and the cache may have more than one device's buffers
+     * modified waiting to be written.
      */
     bool transfered_buffers;
 
@@ -2739,9 +2907,8 @@ rtems_bdbuf_swapout_task (rtems_task_argument arg)
       transfered_buffers = false;
 
       /*
-       * Extact all the buffers we find for a specific device. The device is
-       * the first one we find on a modified list. Process the sync queue of
-       * buffers first.
+       * Extact all the buffers we find for each device. Process the sync
+       * queue of buffers of a device first.
        */
       if (rtems_bdbuf_swapout_processing (timer_delta,
                                           update_timers,
@@ -2797,15 +2964,19 @@ static void
 rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
                               const rtems_disk_device *dd)
 {
-  rtems_bdbuf_buffer *stack [RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer **prev = stack;
-  rtems_bdbuf_buffer *cur = bdbuf_cache.tree;
+  rtems_blkdev_bnum bucket_count;
+  rtems_blkdev_bnum bucket;
+
+  if (dd->bd_hash == NULL)
+    return;
 
-  *prev = NULL;
+  bucket_count = rtems_bdbuf_hash_bucket_count (dd);
 
-  while (cur != NULL)
+  for (bucket = 0; bucket < bucket_count; ++bucket)
   {
-    if (cur->dd == dd)
+    rtems_bdbuf_buffer *cur = dd->bd_hash [bucket];
+
+    while (cur != NULL)
     {
       switch (cur->state)
       {
@@ -2835,37 +3006,8 @@ rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
         default:
           rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
       }
-    }
 
-    if (cur->avl.left != NULL)
-    {
-      /* Left */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.left;
-    }
-    else if (cur->avl.right != NULL)
-    {
-      /* Right */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.right;
-    }
-    else
-    {
-      while (*prev != NULL
-             && (cur == (*prev)->avl.right || (*prev)->avl.right == NULL))
-      {
-        /* Up */
-        cur = *prev;
-        --prev;
-      }
-      if (*prev != NULL)
-        /* Right */
-        cur = (*prev)->avl.right;
-      else
-        /* Finished */
-        cur = NULL;
+      cur = cur->hash_next;
     }
   }
 }
@@ -2889,6 +3031,90 @@ rtems_bdbuf_purge_dev (rtems_disk_device *dd)
   rtems_bdbuf_unlock_cache ();
 }
 
+/**
+ * Returns a buffer of the hash table of the disk device, otherwise NULL.
+ */
+static rtems_bdbuf_buffer *
+rtems_bdbuf_hash_first (const rtems_disk_device *dd)
+{
+  rtems_blkdev_bnum bucket_count;
+  rtems_blkdev_bnum bucket;
+
+  if (dd->bd_hash == NULL)
+    return NULL;
+
+  bucket_count = rtems_bdbuf_hash_bucket_count (dd);
+
+  for (bucket = 0; bucket < bucket_count; ++bucket)
+  {
+    if (dd->bd_hash [bucket] != NULL)
+      return dd->bd_hash [bucket];
+  }
+
+  return NULL;
+}
+
+/**
+ * Purges the disk device until its hash table is empty.  Buffers in a
+ * transfer or access state are only marked as purged.  They stay in the hash
+ * table until the transfer is done or the buffer is released, so wait for
+ * them.
+ */
+static void
+rtems_bdbuf_purge_dev_and_wait (rtems_disk_device *dd)
+{
+  rtems_bdbuf_buffer *bd;
+
+  rtems_bdbuf_do_purge_dev (dd);
+
+  while ((bd = rtems_bdbuf_hash_first (dd)) != NULL)
+  {
+    switch (bd->state)
+    {
+      case RTEMS_BDBUF_STATE_EMPTY:
+        if (bd->waiters == 0)
+        {
+          rtems_bdbuf_remove_from_hash (bd);
+          rtems_bdbuf_make_free_and_add_to_lru_list (bd);
+          rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+        }
+        else
+          rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+        break;
+      case RTEMS_BDBUF_STATE_ACCESS_PURGED:
+        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        break;
+      case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
+        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        break;
+      default:
+        rtems_bdbuf_do_purge_dev (dd);
+        break;
+    }
+  }
+}
+
+void
+rtems_bdbuf_destroy_dev (rtems_disk_device *dd)
+{
+  rtems_bdbuf_buffer **bd_hash;
+
+  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_purge_dev_and_wait (dd);
+  bd_hash = dd->bd_hash;
+  dd->bd_hash = NULL;
+
+  if (bd_hash != NULL)
+    rtems_bdbuf_swapout_remove_device (dd);
+
+  rtems_bdbuf_unlock_cache ();
+
+  if (bd_hash != NULL)
+    rtems_mutex_destroy (&dd->swapout.sync_lock);
+
+  free (bd_hash);
+}
+
 rtems_status_code
 rtems_bdbuf_set_block_size (rtems_disk_device *dd,
                             uint32_t           block_size,
@@ -2908,11 +3134,20 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
   if (block_size > 0)
   {
     size_t bds_per_group = rtems_bdbuf_bds_per_group (block_size);
+    uint32_t media_blocks_per_block = block_size / dd->media_block_size;
+    rtems_blkdev_bnum block_count = 0;
+
+    if (bds_per_group != 0 && media_blocks_per_block != 0)
+    {
+      block_count = dd->size / media_blocks_per_block;
+      sc = rtems_bdbuf_hash_create (dd, block_count);
+    }
+    else
+      sc = RTEMS_INVALID_NUMBER;
 
-    if (bds_per_group != 0)
+    if (sc == RTEMS_SUCCESSFUL)
     {
       int block_to_media_block_shift = 0;
-      uint32_t media_blocks_per_block = block_size / dd->media_block_size;
       uint32_t one = 1;
 
       while ((one << block_to_media_block_shift) < media_blocks_per_block)
@@ -2924,17 +3159,13 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
         block_to_media_block_shift = -1;
 
       dd->block_size = block_size;
-      dd->block_count = dd->size / media_blocks_per_block;
+      dd->block_count = block_count;
       dd->media_blocks_per_block = media_blocks_per_block;
       dd->block_to_media_block_shift = block_to_media_block_shift;
       dd->bds_per_group = bds_per_group;
 
       rtems_bdbuf_do_purge_dev (dd);
     }
-    else
-    {
-      sc = RTEMS_INVALID_NUMBER;
-    }
   }
   else
   {
@@ -2962,56 +3193,78 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
     {
       rtems_disk_device *dd =
         RTEMS_CONTAINER_OF (node, rtems_disk_device, read_ahead.node);
-      rtems_blkdev_bnum block = dd->read_ahead.next;
-      rtems_blkdev_bnum media_block = 0;
-      rtems_status_code sc =
-        rtems_bdbuf_get_media_block (dd, block, &media_block);
+      rtems_blkdev_read_ahead_stream *stream;
 
       rtems_chain_set_off_chain (&dd->read_ahead.node);
 
-      if (sc == RTEMS_SUCCESSFUL)
+      /*
+       * The cache is unlocked during the read transfers, so the streams may
+       * change in the meantime.  Look for the next pending stream each time.
+       */
+      while ((stream = rtems_bdbuf_read_ahead_get_pending (dd)) != NULL)
       {
-        rtems_bdbuf_buffer *bd =
-          rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+        rtems_blkdev_bnum block = stream->next;
+        rtems_blkdev_bnum media_block = 0;
+        rtems_status_code sc =
+          rtems_bdbuf_get_media_block (dd, block, &media_block);
 
-        if (bd != NULL)
+        if (sc == RTEMS_SUCCESSFUL)
         {
-          uint32_t transfer_count = dd->read_ahead.nr_blocks;
-          uint32_t blocks_until_end_of_disk = dd->block_count - block;
-          uint32_t max_transfer_count = bdbuf_config.max_read_ahead_blocks;
-
-          if (transfer_count == RTEMS_DISK_READ_AHEAD_SIZE_AUTO) {
-            transfer_count = blocks_until_end_of_disk;
-
-            if (transfer_count >= max_transfer_count)
-            {
-              transfer_count = max_transfer_count;
-              dd->read_ahead.trigger = block + transfer_count / 2;
-              dd->read_ahead.next = block + transfer_count;
-            }
-            else
-            {
-              dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
-            }
-          } else {
-            if (transfer_count > blocks_until_end_of_disk) {
+          rtems_bdbuf_buffer *bd =
+            rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+
+          if (bd != NULL)
+          {
+            uint32_t transfer_count = stream->nr_blocks;
+            uint32_t blocks_until_end_of_disk = dd->block_count - block;
+            uint32_t max_transfer_count = bdbuf_config.max_read_ahead_blocks;
+
+            if (transfer_count == RTEMS_DISK_READ_AHEAD_SIZE_AUTO) {
+              uint32_t window = stream->window;
+
+              if (window == 0)
+                window = RTEMS_BDBUF_READ_AHEAD_WINDOW_INITIAL;
+
+              if (window > max_transfer_count)
+                window = max_transfer_count;
+
               transfer_count = blocks_until_end_of_disk;
-            }
 
-            if (transfer_count > max_transfer_count) {
-              transfer_count = max_transfer_count;
+              if (transfer_count >= window)
+              {
+                transfer_count = window;
+                stream->trigger = block + transfer_count / 2;
+                stream->next = block + transfer_count;
+
+                if (window <= max_transfer_count / 2)
+                  stream->window = 2 * window;
+                else
+                  stream->window = max_transfer_count;
+              }
+              else
+              {
+                stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+              }
+            } else {
+              if (transfer_count > blocks_until_end_of_disk) {
+                transfer_count = blocks_until_end_of_disk;
+              }
+
+              if (transfer_count > max_transfer_count) {
+                transfer_count = max_transfer_count;
+              }
+
+              ++dd->stats.read_ahead_peeks;
             }
 
-            ++dd->stats.read_ahead_peeks;
+            ++dd->stats.read_ahead_transfers;
+            rtems_bdbuf_execute_read_request (dd, bd, transfer_count);
           }
-
-          ++dd->stats.read_ahead_transfers;
-          rtems_bdbuf_execute_read_request (dd, bd, transfer_count);
         }
-      }
-      else
-      {
-        dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+        else
+        {
+          stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+        }
       }
     }
 
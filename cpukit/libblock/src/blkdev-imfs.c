@@ -242,6 +242,7 @@ static const rtems_filesystem_file_handlers_r rtems_blkdev_imfs_node = {
   .fcntl_h = rtems_filesystem_default_fcntl,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
   .mmap_h = rtems_filesystem_default_mmap,
+  .munmap_h = rtems_filesystem_default_munmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
@@ -270,7 +271,7 @@ static void rtems_blkdev_imfs_destroy(IMFS_jnode_t *node)
   rtems_disk_device *dd = &ctx->dd;
 
   (void) rtems_bdbuf_syncdev(dd);
-  rtems_bdbuf_purge_dev(dd);
+  rtems_bdbuf_destroy_dev(dd);
 
   if (ctx->fd >= 0) {
     close(ctx->fd);
@@ -327,6 +328,7 @@ rtems_status_code rtems_blkdev_create(
       );
 
       if (rv != 0) {
+        rtems_bdbuf_destroy_dev(&ctx->dd);
         free(ctx);
         sc = RTEMS_UNSATISFIED;
       }
@@ -381,6 +383,7 @@ rtems_status_code rtems_blkdev_create_partition(
             );
 
             if (rv != 0) {
+              rtems_bdbuf_destroy_dev(&ctx->dd);
               free(ctx);
               sc = RTEMS_UNSATISFIED;
             }
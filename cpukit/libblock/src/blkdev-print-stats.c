@@ -61,6 +61,8 @@ void rtems_blkdev_print_stats(
      " READ MISSES          | %" PRIu32 "\n"
      " READ AHEAD TRANSFERS | %" PRIu32 "\n"
      " READ AHEAD PEEKS     | %" PRIu32 "\n"
+     " READ AHEAD HITS      | %" PRIu32 "\n"
+     " READ AHEAD MISSES    | %" PRIu32 "\n"
      " READ BLOCKS          | %" PRIu32 "\n"
      " READ ERRORS          | %" PRIu32 "\n"
      " WRITE TRANSFERS      | %" PRIu32 "\n"
@@ -74,6 +76,8 @@ void rtems_blkdev_print_stats(
      stats->read_misses,
      stats->read_ahead_transfers,
      stats->read_ahead_peeks,
+     stats->read_ahead_hits,
+     stats->read_ahead_misses,
      stats->read_blocks,
      stats->read_errors,
      stats->write_transfers,
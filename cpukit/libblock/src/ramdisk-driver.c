@@ -121,6 +121,10 @@ ramdisk_ioctl(rtems_disk_device *dd, uint32_t req, void *argp)
             break;
         }
 
+        case RTEMS_BLKIO_CAPABILITIES:
+            *(uint32_t *) argp = RTEMS_BLKDEV_CAP_MULTIBLOCK_BUFFER;
+            return 0;
+
         case RTEMS_BLKIO_DELETED:
             if (rd->free_at_delete_request) {
               ramdisk_free(rd);
@@ -84,6 +84,15 @@ int _rename_r(
     new_currentloc
   );
   if ( rv == 0 ) {
+    rtems_filesystem_lookup_cache_invalidate_node(
+      &old_parentloc,
+      old_currentloc
+    );
+    rtems_filesystem_lookup_cache_invalidate_name(
+      new_currentloc,
+      rtems_filesystem_eval_path_get_token( &new_ctx ),
+      rtems_filesystem_eval_path_get_tokenlen( &new_ctx )
+    );
     rv = (*new_currentloc->mt_entry->ops->rename_h)(
       &old_parentloc,
       old_currentloc,
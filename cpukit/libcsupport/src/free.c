@@ -85,6 +85,16 @@ static void _Malloc_Deferred_free( void *p )
   rtems_interrupt_lock_release( &_Malloc_GC_lock, &lock_context );
 }
 
+RTEMS_WEAK bool _Malloc_Per_CPU_cache_free( void *ptr )
+{
+  /*
+   * Do not use a cache by default.  If CONFIGURE_MALLOC_PER_CPU_CACHE is
+   * defined, then a strong implementation of this function will be provided.
+   */
+  (void) ptr;
+  return false;
+}
+
 void free(
   void *ptr
 )
@@ -100,6 +110,10 @@ void free(
       return;
   }
 
+  if ( _Malloc_Per_CPU_cache_free( ptr ) ) {
+    return;
+  }
+
   if ( !_Protected_heap_Free( RTEMS_Malloc_Heap, ptr ) ) {
     rtems_fatal( RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE, (rtems_fatal_code) ptr );
   }
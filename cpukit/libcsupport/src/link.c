@@ -63,6 +63,11 @@ int link( const char *path1, const char *path2 )
     currentloc_2
   );
   if ( rv == 0 ) {
+    rtems_filesystem_lookup_cache_invalidate_name(
+      currentloc_2,
+      rtems_filesystem_eval_path_get_token( &ctx_2 ),
+      rtems_filesystem_eval_path_get_tokenlen( &ctx_2 )
+    );
     rv = (*currentloc_2->mt_entry->ops->link_h)(
       currentloc_2,
       currentloc_1,
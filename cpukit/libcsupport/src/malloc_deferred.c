@@ -74,6 +74,16 @@ RTEMS_WEAK void _Malloc_Process_deferred_frees( void )
    */
 }
 
+RTEMS_WEAK void *_Malloc_Per_CPU_cache_allocate( size_t size )
+{
+  /*
+   * Do not use a cache by default.  If CONFIGURE_MALLOC_PER_CPU_CACHE is
+   * defined, then a strong implementation of this function will be provided.
+   */
+  (void) size;
+  return NULL;
+}
+
 void *rtems_heap_allocate_aligned_with_boundary(
   size_t    size,
   uintptr_t alignment,
@@ -85,15 +95,23 @@ void *rtems_heap_allocate_aligned_with_boundary(
 
   switch ( _Malloc_System_state() ) {
     case MALLOC_SYSTEM_STATE_NORMAL:
-      _RTEMS_Lock_allocator();
-      _Malloc_Process_deferred_frees();
-      p = _Heap_Allocate_aligned_with_boundary(
-        heap,
-        size,
-        alignment,
-        boundary
-      );
-      _RTEMS_Unlock_allocator();
+      if ( alignment == 0 && boundary == 0 ) {
+        p = _Malloc_Per_CPU_cache_allocate( size );
+      } else {
+        p = NULL;
+      }
+
+      if ( p == NULL ) {
+        _RTEMS_Lock_allocator();
+        _Malloc_Process_deferred_frees();
+        p = _Heap_Allocate_aligned_with_boundary(
+          heap,
+          size,
+          alignment,
+          boundary
+        );
+        _RTEMS_Unlock_allocator();
+      }
       break;
     case MALLOC_SYSTEM_STATE_NO_PROTECTION:
       p = _Heap_Allocate_aligned_with_boundary(
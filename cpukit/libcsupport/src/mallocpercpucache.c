@@ -0,0 +1,391 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup MallocSupport
+ *
+ * @brief This source file contains the implementation of
+ *   _Malloc_Initialize_per_CPU_caches(), _Malloc_Per_CPU_cache_allocate(), and
+ *   _Malloc_Per_CPU_cache_free().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "malloc_p.h"
+
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/isrlevel.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smp.h>
+
+/*
+ * This is the maximum count of blocks moved between a cache and the heap while
+ * the allocator mutex is owned.
+ */
+#define MALLOC_PER_CPU_CACHE_BATCH_MAXIMUM 8
+
+void _Malloc_Initialize_per_CPU_caches( void )
+{
+  uint32_t cpu_index;
+  uint32_t blocks_per_cpu;
+
+  blocks_per_cpu = MALLOC_PER_CPU_CACHE_CLASS_COUNT
+    * _Malloc_Per_CPU_cache_capacity;
+
+  for (
+    cpu_index = 0;
+    cpu_index < _SMP_Processor_configured_maximum;
+    ++cpu_index
+  ) {
+    Per_CPU_Control      *cpu;
+    Malloc_Per_CPU_cache *cache;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    cache = &_Malloc_Per_CPU_caches[ cpu_index ];
+    cache->blocks = &_Malloc_Per_CPU_cache_blocks[ cpu_index * blocks_per_cpu ];
+    cpu->malloc_cache = cache;
+  }
+}
+
+/*
+ * The first word of the allocation area of a cached block contains the address
+ * of the cache slot which holds the block.  This marks the block as cached
+ * without a search of the caches.  The Heap_Block::size_and_flag member is not
+ * used for this, since the heap changes the HEAP_PREV_BLOCK_USED flag of
+ * allocated blocks while the allocator mutex is owned and a flag set with only
+ * interrupts disabled could get lost.
+ */
+static void _Malloc_Per_CPU_cache_put( void **slot, void *ptr )
+{
+  *slot = ptr;
+  *(void ***) ptr = slot;
+}
+
+/*
+ * The slots below the count of a size class hold exactly the blocks cached for
+ * the size class, so an allocated block which is not cached cannot refer to a
+ * slot which holds the block, whatever the content of its first word is.  The
+ * caches of other processors are read without synchronization.  A double free
+ * which races with the cache operations of another processor may go
+ * undetected.
+ */
+static bool _Malloc_Per_CPU_cache_is_cached( const void *ptr )
+{
+  void * const *slot;
+  uintptr_t     index;
+  uint32_t      capacity;
+  uint32_t      blocks_per_cpu;
+  uint32_t      cpu_index;
+  uint32_t      class_index;
+
+  slot = *(void * const * const *) ptr;
+  index = (uintptr_t) slot - (uintptr_t) &_Malloc_Per_CPU_cache_blocks[ 0 ];
+
+  if ( index % sizeof( *slot ) != 0 ) {
+    return false;
+  }
+
+  index /= sizeof( *slot );
+  capacity = _Malloc_Per_CPU_cache_capacity;
+  blocks_per_cpu = MALLOC_PER_CPU_CACHE_CLASS_COUNT * capacity;
+
+  if (
+    index >= (uintptr_t) _SMP_Processor_configured_maximum * blocks_per_cpu
+  ) {
+    return false;
+  }
+
+  cpu_index = (uint32_t) ( index / blocks_per_cpu );
+  class_index = (uint32_t) ( index % blocks_per_cpu ) / capacity;
+
+  return ( index % capacity )
+      < _Malloc_Per_CPU_caches[ cpu_index ].count[ class_index ]
+    && *slot == ptr;
+}
+
+static uint32_t _Malloc_Per_CPU_cache_batch_count( void )
+{
+  uint32_t batch_count;
+
+  batch_count = _Malloc_Per_CPU_cache_capacity / 2;
+
+  if ( batch_count == 0 ) {
+    batch_count = 1;
+  } else if ( batch_count > MALLOC_PER_CPU_CACHE_BATCH_MAXIMUM ) {
+    batch_count = MALLOC_PER_CPU_CACHE_BATCH_MAXIMUM;
+  }
+
+  return batch_count;
+}
+
+static void _Malloc_Per_CPU_cache_release(
+  void * const *batch,
+  uint32_t      batch_count
+)
+{
+  uint32_t i;
+
+  _RTEMS_Lock_allocator();
+
+  for ( i = 0; i < batch_count; ++i ) {
+    if ( !_Heap_Free( RTEMS_Malloc_Heap, batch[ i ] ) ) {
+      rtems_fatal(
+        RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE,
+        (rtems_fatal_code) batch[ i ]
+      );
+    }
+  }
+
+  _RTEMS_Unlock_allocator();
+}
+
+void *_Malloc_Per_CPU_cache_allocate( size_t size )
+{
+  Malloc_Per_CPU_cache *cache;
+  ISR_Level             level;
+  uint32_t              capacity;
+  uint32_t              class_index;
+  uint32_t              count;
+  uint32_t              batch_count;
+  uintptr_t             alloc_size;
+  void                **blocks;
+  void                 *batch[ MALLOC_PER_CPU_CACHE_BATCH_MAXIMUM ];
+  void                 *p;
+
+  if (
+    size == 0 ||
+    size > MALLOC_PER_CPU_CACHE_CLASS_COUNT * MALLOC_PER_CPU_CACHE_CLASS_SIZE
+  ) {
+    return NULL;
+  }
+
+  capacity = _Malloc_Per_CPU_cache_capacity;
+  class_index = (uint32_t) ( ( size - 1 ) / MALLOC_PER_CPU_CACHE_CLASS_SIZE );
+
+  _ISR_Local_disable( level );
+  cache = _Per_CPU_Get()->malloc_cache;
+
+  if ( cache == NULL ) {
+    _ISR_Local_enable( level );
+    return NULL;
+  }
+
+  count = cache->count[ class_index ];
+
+  if ( count > 0 ) {
+    --count;
+    p = cache->blocks[ class_index * capacity + count ];
+    cache->count[ class_index ] = count;
+    _ISR_Local_enable( level );
+    return p;
+  }
+
+  _ISR_Local_enable( level );
+
+  /*
+   * The cache is empty.  Refill it with a batch of blocks which fit all sizes
+   * of the size class.
+   */
+  alloc_size = ( class_index + 1 ) * MALLOC_PER_CPU_CACHE_CLASS_SIZE;
+  batch_count = _Malloc_Per_CPU_cache_batch_count();
+
+  _RTEMS_Lock_allocator();
+  _Malloc_Process_deferred_frees();
+
+  for ( count = 0; count < batch_count; ++count ) {
+    p = _Heap_Allocate( RTEMS_Malloc_Heap, alloc_size );
+
+    if ( p == NULL ) {
+      break;
+    }
+
+    batch[ count ] = p;
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  if ( count == 0 ) {
+    return NULL;
+  }
+
+  batch_count = count - 1;
+  p = batch[ batch_count ];
+
+  /*
+   * The thread may have migrated to another processor in the meantime, so get
+   * the cache again.
+   */
+  _ISR_Local_disable( level );
+  cache = _Per_CPU_Get()->malloc_cache;
+  blocks = &cache->blocks[ class_index * capacity ];
+  count = cache->count[ class_index ];
+
+  while ( batch_count > 0 && count < capacity ) {
+    --batch_count;
+    _Malloc_Per_CPU_cache_put( &blocks[ count ], batch[ batch_count ] );
+    ++count;
+  }
+
+  cache->count[ class_index ] = count;
+  _ISR_Local_enable( level );
+
+  if ( batch_count > 0 ) {
+    _Malloc_Per_CPU_cache_release( batch, batch_count );
+  }
+
+  return p;
+}
+
+static bool _Malloc_Per_CPU_cache_is_allocated(
+  Heap_Control *heap,
+  Heap_Block   *block
+)
+{
+  Heap_Block *next_block;
+
+  if ( !_Heap_Is_block_in_heap( heap, block ) ) {
+    return false;
+  }
+
+  next_block = _Heap_Block_at( block, _Heap_Block_size( block ) );
+
+  return _Heap_Is_block_in_heap( heap, next_block )
+    && _Heap_Is_prev_used( next_block );
+}
+
+bool _Malloc_Per_CPU_cache_free( void *ptr )
+{
+  Heap_Control         *heap;
+  Heap_Block           *block;
+  Malloc_Per_CPU_cache *cache;
+  ISR_Level             level;
+  uintptr_t             alloc_begin;
+  uintptr_t             alloc_size;
+  uint32_t              capacity;
+  uint32_t              class_index;
+  uint32_t              count;
+  uint32_t              batch_count;
+  uint32_t              i;
+  bool                  is_allocated;
+  void                **blocks;
+  void                 *batch[ MALLOC_PER_CPU_CACHE_BATCH_MAXIMUM ];
+
+  heap = RTEMS_Malloc_Heap;
+  alloc_begin = (uintptr_t) ptr;
+  block = _Heap_Block_of_alloc_area( alloc_begin, heap->page_size );
+
+  /*
+   * Only allocated blocks with an allocation area which starts right after
+   * the block header are cached, since they are indistinguishable from blocks
+   * allocated by _Malloc_Per_CPU_cache_allocate().  The size field and the
+   * used flag of an allocated block are stable without the allocator mutex.
+   * Other pointers are left to the heap, which rejects invalid frees.
+   *
+   * This check is only sound for pointers to allocated blocks.  An invalid
+   * pointer may refer to memory which the heap changes concurrently.  Without
+   * RTEMS_DEBUG such a pointer may pass the check and the block is cached.
+   * With RTEMS_DEBUG, the block is checked while the allocator mutex is
+   * owned, so that invalid pointers are reliably rejected.
+   */
+#if defined(RTEMS_DEBUG)
+  _RTEMS_Lock_allocator();
+#endif
+
+  is_allocated = _Malloc_Per_CPU_cache_is_allocated( heap, block )
+    && _Heap_Alloc_area_of_block( block ) == alloc_begin;
+
+#if defined(RTEMS_DEBUG)
+  _RTEMS_Unlock_allocator();
+#endif
+
+  if ( !is_allocated ) {
+    return false;
+  }
+
+  alloc_size = _Heap_Block_size( block ) - HEAP_BLOCK_HEADER_SIZE
+    + HEAP_ALLOC_BONUS;
+
+  if (
+    alloc_size < MALLOC_PER_CPU_CACHE_CLASS_SIZE
+      || alloc_size >= ( MALLOC_PER_CPU_CACHE_CLASS_COUNT + 1 )
+        * MALLOC_PER_CPU_CACHE_CLASS_SIZE
+  ) {
+    return false;
+  }
+
+  capacity = _Malloc_Per_CPU_cache_capacity;
+  class_index = (uint32_t) ( alloc_size / MALLOC_PER_CPU_CACHE_CLASS_SIZE ) - 1;
+
+  _ISR_Local_disable( level );
+  cache = _Per_CPU_Get()->malloc_cache;
+
+  if ( cache == NULL ) {
+    _ISR_Local_enable( level );
+    return false;
+  }
+
+  blocks = &cache->blocks[ class_index * capacity ];
+  count = cache->count[ class_index ];
+
+  /*
+   * Cached blocks are allocated from the view of the heap.  A block freed
+   * twice must not end up in a cache twice.
+   */
+  if ( _Malloc_Per_CPU_cache_is_cached( ptr ) ) {
+    _ISR_Local_enable( level );
+    rtems_fatal( RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE, (rtems_fatal_code) ptr );
+  }
+
+  if ( count < capacity ) {
+    _Malloc_Per_CPU_cache_put( &blocks[ count ], ptr );
+    cache->count[ class_index ] = count + 1;
+    _ISR_Local_enable( level );
+    return true;
+  }
+
+  /*
+   * The cache is full.  Give a batch of blocks back to the heap, so that the
+   * next frees of this size class are served by the cache again.
+   */
+  batch_count = _Malloc_Per_CPU_cache_batch_count();
+
+  for ( i = 0; i < batch_count; ++i ) {
+    --count;
+    batch[ i ] = blocks[ count ];
+  }
+
+  _Malloc_Per_CPU_cache_put( &blocks[ count ], ptr );
+  cache->count[ class_index ] = count + 1;
+  _ISR_Local_enable( level );
+
+  _Malloc_Per_CPU_cache_release( batch, batch_count );
+  return true;
+}
@@ -69,6 +69,7 @@ int rtems_filesystem_mknod(
   if ( rv == 0 ) {
     const rtems_filesystem_operations_table *ops = parentloc->mt_entry->ops;
 
+    rtems_filesystem_lookup_cache_invalidate_name( parentloc, name, namelen );
     rv = (*ops->mknod_h)( parentloc, name, namelen, mode, dev );
   }
 
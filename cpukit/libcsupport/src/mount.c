@@ -233,6 +233,7 @@ int mount(
 
           if ( rv != 0 ) {
             (*mt_entry->ops->fsunmount_me_h)( mt_entry );
+            rtems_filesystem_lookup_cache_destroy( mt_entry );
           }
         }
 
@@ -66,6 +66,7 @@ int rmdir( const char *path )
 
   if ( S_ISDIR( type ) ) {
     if ( !rtems_filesystem_location_is_instance_root( currentloc ) ) {
+      rtems_filesystem_lookup_cache_invalidate_node( &parentloc, currentloc );
       rv = (*ops->rmnod_h)( &parentloc, currentloc );
     } else {
       rtems_filesystem_eval_path_error( &ctx, EBUSY );
@@ -248,6 +248,7 @@ void rtems_filesystem_do_unmount(
   rtems_filesystem_mt_unlock();
   rtems_filesystem_global_location_release(mt_entry->mt_point_node, false);
   (*mt_entry->ops->fsunmount_me_h)(mt_entry);
+  rtems_filesystem_lookup_cache_destroy(mt_entry);
 
   if (mt_entry->unmount_task != 0) {
     rtems_status_code sc =
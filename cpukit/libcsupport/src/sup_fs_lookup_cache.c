@@ -0,0 +1,404 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ *  @file
+ *
+ *  @brief RTEMS File System Path Lookup Cache
+ *  @ingroup LibIOInternal
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/libio_.h>
+
+typedef struct {
+  rtems_chain_node lru_node;
+  rtems_chain_node hash_node;
+  uintptr_t dir_key;
+  uintptr_t node;
+  uintptr_t node_2;
+  bool positive;
+  uint8_t namelen;
+  char name[RTEMS_FILESYSTEM_LOOKUP_CACHE_NAME_MAX];
+} lookup_cache_entry;
+
+struct rtems_filesystem_lookup_cache {
+  /*
+   * The least recently used entry is at the head, unused entries are
+   * prepended.
+   */
+  rtems_chain_control lru;
+  rtems_chain_control *buckets;
+  size_t bucket_mask;
+  size_t entry_count;
+  rtems_filesystem_lookup_cache_stats stats;
+  lookup_cache_entry entries[RTEMS_ZERO_LENGTH_ARRAY];
+};
+
+static uint32_t lookup_cache_hash(
+  uintptr_t dir_key,
+  const char *name,
+  size_t namelen
+)
+{
+  uint32_t hash = 2166136261U ^ (uint32_t) dir_key;
+  size_t i;
+
+  for (i = 0; i < namelen; ++i) {
+    hash ^= (unsigned char) name[i];
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+static rtems_chain_control *lookup_cache_bucket(
+  rtems_filesystem_lookup_cache *cache,
+  uintptr_t dir_key,
+  const char *name,
+  size_t namelen
+)
+{
+  uint32_t hash = lookup_cache_hash(dir_key, name, namelen);
+
+  return &cache->buckets[hash & cache->bucket_mask];
+}
+
+static lookup_cache_entry *lookup_cache_search(
+  rtems_filesystem_lookup_cache *cache,
+  uintptr_t dir_key,
+  const char *name,
+  size_t namelen
+)
+{
+  rtems_chain_control *bucket =
+    lookup_cache_bucket(cache, dir_key, name, namelen);
+  rtems_chain_node *node = rtems_chain_first(bucket);
+  const rtems_chain_node *tail = rtems_chain_immutable_tail(bucket);
+
+  while (node != tail) {
+    lookup_cache_entry *entry =
+      RTEMS_CONTAINER_OF(node, lookup_cache_entry, hash_node);
+
+    if (
+      entry->dir_key == dir_key
+        && entry->namelen == namelen
+        && memcmp(entry->name, name, namelen) == 0
+    ) {
+      return entry;
+    }
+
+    node = rtems_chain_next(node);
+  }
+
+  return NULL;
+}
+
+static void lookup_cache_remove(
+  rtems_filesystem_lookup_cache *cache,
+  lookup_cache_entry *entry
+)
+{
+  rtems_chain_extract_unprotected(&entry->hash_node);
+  rtems_chain_set_off_chain(&entry->hash_node);
+  rtems_chain_extract_unprotected(&entry->lru_node);
+  rtems_chain_prepend_unprotected(&cache->lru, &entry->lru_node);
+  ++cache->stats.invalidations;
+}
+
+static bool lookup_cache_is_dot_or_dotdot(const char *name, size_t namelen)
+{
+  return rtems_filesystem_is_current_directory(name, namelen)
+    || rtems_filesystem_is_parent_directory(name, namelen);
+}
+
+int rtems_filesystem_lookup_cache_create(
+  rtems_filesystem_mount_table_entry_t *mt_entry,
+  size_t entry_count
+)
+{
+  rtems_filesystem_lookup_cache *cache;
+  size_t bucket_count;
+  size_t i;
+
+  _Assert(mt_entry->ops->lookup_cache_key_h != NULL);
+  _Assert(mt_entry->lookup_cache == NULL);
+
+  if (entry_count == 0) {
+    rtems_set_errno_and_return_minus_one(EINVAL);
+  }
+
+  bucket_count = 1;
+  while (bucket_count < entry_count) {
+    bucket_count <<= 1;
+  }
+
+  cache = calloc(
+    1,
+    sizeof(*cache) + entry_count * sizeof(cache->entries[0])
+  );
+  if (cache == NULL) {
+    rtems_set_errno_and_return_minus_one(ENOMEM);
+  }
+
+  cache->buckets = malloc(bucket_count * sizeof(cache->buckets[0]));
+  if (cache->buckets == NULL) {
+    free(cache);
+    rtems_set_errno_and_return_minus_one(ENOMEM);
+  }
+
+  for (i = 0; i < bucket_count; ++i) {
+    rtems_chain_initialize_empty(&cache->buckets[i]);
+  }
+
+  rtems_chain_initialize_empty(&cache->lru);
+
+  for (i = 0; i < entry_count; ++i) {
+    lookup_cache_entry *entry = &cache->entries[i];
+
+    rtems_chain_set_off_chain(&entry->hash_node);
+    rtems_chain_append_unprotected(&cache->lru, &entry->lru_node);
+  }
+
+  cache->bucket_mask = bucket_count - 1;
+  cache->entry_count = entry_count;
+  mt_entry->lookup_cache = cache;
+
+  return 0;
+}
+
+void rtems_filesystem_lookup_cache_destroy(
+  rtems_filesystem_mount_table_entry_t *mt_entry
+)
+{
+  rtems_filesystem_lookup_cache *cache = mt_entry->lookup_cache;
+
+  if (cache != NULL) {
+    mt_entry->lookup_cache = NULL;
+    free(cache->buckets);
+    free(cache);
+  }
+}
+
+rtems_filesystem_lookup_cache_status rtems_filesystem_lookup_cache_find(
+  rtems_filesystem_mount_table_entry_t *mt_entry,
+  uintptr_t dir_key,
+  const char *name,
+  size_t namelen,
+  uintptr_t *node,
+  uintptr_t *node_2
+)
+{
+  rtems_filesystem_lookup_cache *cache = mt_entry->lookup_cache;
+  lookup_cache_entry *entry;
+
+  if (cache == NULL || namelen > RTEMS_FILESYSTEM_LOOKUP_CACHE_NAME_MAX) {
+    return RTEMS_FILESYSTEM_LOOKUP_CACHE_MISS;
+  }
+
+  entry = lookup_cache_search(cache, dir_key, name, namelen);
+  if (entry == NULL) {
+    ++cache->stats.misses;
+    return RTEMS_FILESYSTEM_LOOKUP_CACHE_MISS;
+  }
+
+  rtems_chain_extract_unprotected(&entry->lru_node);
+  rtems_chain_append_unprotected(&cache->lru, &entry->lru_node);
+
+  if (!entry->positive) {
+    ++cache->stats.negative_hits;
+    return RTEMS_FILESYSTEM_LOOKUP_CACHE_NEGATIVE;
+  }
+
+  ++cache->stats.hits;
+  *node = entry->node;
+  *node_2 = entry->node_2;
+  return RTEMS_FILESYSTEM_LOOKUP_CACHE_POSITIVE;
+}
+
+void rtems_filesystem_lookup_cache_enter(
+  rtems_filesystem_mount_table_entry_t *mt_entry,
+  uintptr_t dir_key,
+  const char *name,
+  size_t namelen,
+  bool positive,
+  uintptr_t node,
+  uintptr_t node_2
+)
+{
+  rtems_filesystem_lookup_cache *cache = mt_entry->lookup_cache;
+  lookup_cache_entry *entry;
+
+  if (
+    cache == NULL
+      || namelen > RTEMS_FILESYSTEM_LOOKUP_CACHE_NAME_MAX
+      || lookup_cache_is_dot_or_dotdot(name, namelen)
+  ) {
+    return;
+  }
+
+  entry = lookup_cache_search(cache, dir_key, name, namelen);
+  if (entry == NULL) {
+    entry = RTEMS_CONTAINER_OF(
+      rtems_chain_first(&cache->lru),
+      lookup_cache_entry,
+      lru_node
+    );
+
+    if (!rtems_chain_is_node_off_chain(&entry->hash_node)) {
+      rtems_chain_extract_unprotected(&entry->hash_node);
+    }
+
+    entry->dir_key = dir_key;
+    entry->namelen = (uint8_t) namelen;
+    memcpy(entry->name, name, namelen);
+    rtems_chain_prepend_unprotected(
+      lookup_cache_bucket(cache, dir_key, name, namelen),
+      &entry->hash_node
+    );
+  }
+
+  entry->positive = positive;
+  entry->node = node;
+  entry->node_2 = node_2;
+  rtems_chain_extract_unprotected(&entry->lru_node);
+  rtems_chain_append_unprotected(&cache->lru, &entry->lru_node);
+}
+
+void rtems_filesystem_lookup_cache_invalidate_name(
+  const rtems_filesystem_location_info_t *parentloc,
+  const char *name,
+  size_t namelen
+)
+{
+  rtems_filesystem_mount_table_entry_t *mt_entry = parentloc->mt_entry;
+  rtems_filesystem_lookup_cache *cache = mt_entry->lookup_cache;
+  lookup_cache_entry *entry;
+  uintptr_t dir_key;
+
+  if (cache == NULL || namelen > RTEMS_FILESYSTEM_LOOKUP_CACHE_NAME_MAX) {
+    return;
+  }
+
+  dir_key = (*mt_entry->ops->lookup_cache_key_h)(parentloc);
+  entry = lookup_cache_search(cache, dir_key, name, namelen);
+  if (entry != NULL) {
+    lookup_cache_remove(cache, entry);
+  }
+}
+
+void rtems_filesystem_lookup_cache_invalidate_node(
+  const rtems_filesystem_location_info_t *parentloc,
+  const rtems_filesystem_location_info_t *loc
+)
+{
+  rtems_filesystem_mount_table_entry_t *mt_entry = loc->mt_entry;
+  rtems_filesystem_lookup_cache *cache = mt_entry->lookup_cache;
+  uintptr_t dir_key;
+  uintptr_t key;
+  size_t i;
+
+  if (cache == NULL || parentloc->mt_entry != mt_entry) {
+    return;
+  }
+
+  dir_key = (*mt_entry->ops->lookup_cache_key_h)(parentloc);
+  key = (*mt_entry->ops->lookup_cache_key_h)(loc);
+
+  /* Name space changes are rare compared to lookups */
+  for (i = 0; i < cache->entry_count; ++i) {
+    lookup_cache_entry *entry = &cache->entries[i];
+
+    if (
+      !rtems_chain_is_node_off_chain(&entry->hash_node)
+        && (
+          entry->dir_key == key
+            || (entry->dir_key == dir_key && entry->positive
+              && entry->node == key)
+        )
+    ) {
+      lookup_cache_remove(cache, entry);
+    }
+  }
+}
+
+void rtems_filesystem_lookup_cache_invalidate_dir(
+  const rtems_filesystem_location_info_t *parentloc
+)
+{
+  rtems_filesystem_mount_table_entry_t *mt_entry = parentloc->mt_entry;
+  rtems_filesystem_lookup_cache *cache = mt_entry->lookup_cache;
+  uintptr_t dir_key;
+  size_t i;
+
+  if (cache == NULL) {
+    return;
+  }
+
+  dir_key = (*mt_entry->ops->lookup_cache_key_h)(parentloc);
+
+  for (i = 0; i < cache->entry_count; ++i) {
+    lookup_cache_entry *entry = &cache->entries[i];
+
+    if (
+      !rtems_chain_is_node_off_chain(&entry->hash_node)
+        && entry->dir_key == dir_key
+        && entry->positive
+    ) {
+      lookup_cache_remove(cache, entry);
+    }
+  }
+}
+
+int rtems_filesystem_lookup_cache_get_stats(
+  const rtems_filesystem_mount_table_entry_t *mt_entry,
+  rtems_filesystem_lookup_cache_stats *stats
+)
+{
+  const rtems_filesystem_location_info_t *rootloc =
+    &mt_entry->mt_fs_root->location;
+  int rv = 0;
+
+  rtems_filesystem_instance_lock(rootloc);
+
+  if (mt_entry->lookup_cache != NULL) {
+    *stats = mt_entry->lookup_cache->stats;
+  } else {
+    errno = ENOTSUP;
+    rv = -1;
+  }
+
+  rtems_filesystem_instance_unlock(rootloc);
+
+  return rv;
+}
@@ -51,6 +51,11 @@ int symlink( const char *path1, const char *path2 )
   const rtems_filesystem_location_info_t *currentloc =
     rtems_filesystem_eval_path_start( &ctx, path2, eval_flags );
 
+  rtems_filesystem_lookup_cache_invalidate_name(
+    currentloc,
+    rtems_filesystem_eval_path_get_token( &ctx ),
+    rtems_filesystem_eval_path_get_tokenlen( &ctx )
+  );
   rv = (*currentloc->mt_entry->ops->symlink_h)(
     currentloc,
     rtems_filesystem_eval_path_get_token( &ctx ),
@@ -65,6 +65,7 @@ int unlink( const char *path )
   if ( !rtems_filesystem_location_is_instance_root( currentloc ) ) {
     const rtems_filesystem_operations_table *ops = currentloc->mt_entry->ops;
 
+    rtems_filesystem_lookup_cache_invalidate_node( &parentloc, currentloc );
     rv = (*ops->rmnod_h)( &parentloc, currentloc );
   } else {
     rtems_filesystem_eval_path_error( &ctx, EBUSY );
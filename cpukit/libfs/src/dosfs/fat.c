@@ -150,11 +150,49 @@ fat_buf_release(fat_fs_info_t *fs_info)
     return RC_OK;
 }
 
+/* fat_block_read_bulk --
+ *     This function reads whole consecutive blocks directly into the buffer
+ *     provided by user with as few device requests as possible.  The cached
+ *     buffer is released before, since it may be one of the blocks.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     blk      - block num to start read from
+ *     blk_cnt  - count of blocks to read
+ *     buff     - buffer provided by user
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+static int
+fat_block_read_bulk(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                              blk,
+    uint32_t                              blk_cnt,
+    void                                 *buff
+    )
+{
+    rtems_status_code sc = RTEMS_SUCCESSFUL;
+    int               rc = RC_OK;
+
+    rc = fat_buf_release(fs_info);
+    if (rc != RC_OK)
+        return rc;
+
+    sc = rtems_bdbuf_read_blocks(fs_info->vol.dd, blk, blk_cnt, buff);
+    if (sc != RTEMS_SUCCESSFUL)
+        rtems_set_errno_and_return_minus_one(EIO);
+
+    return RC_OK;
+}
+
 /* _fat_block_read --
  *     This function reads 'count' bytes from device filesystem is mounted on,
  *     starts at 'start+offset' position where 'start' computed in sectors
  *     and 'offset' is offset inside sector (reading may cross sectors
- *     boundary; in this case assumed we want to read sequential sector(s))
+ *     boundary; in this case assumed we want to read sequential sector(s)).
+ *     Runs of more than one whole block are read in one go.
  *
  * PARAMETERS:
  *     fs_info  - FS info
@@ -185,6 +223,26 @@ _fat_block_read(
 
     while (count > 0)
     {
+        uint32_t blk_cnt = count >> fs_info->vol.bytes_per_block_log2;
+
+        if (blk_cnt > 1 &&
+            fat_sector_offset_to_block_offset(fs_info, sec_num, ofs) == 0)
+        {
+            rc = fat_block_read_bulk(fs_info,
+                                     fat_sector_num_to_block_num(fs_info,
+                                                                 sec_num),
+                                     blk_cnt,
+                                     buff + cmpltd);
+            if (rc != RC_OK)
+                return -1;
+
+            c = blk_cnt << fs_info->vol.bytes_per_block_log2;
+            count -= c;
+            cmpltd += c;
+            sec_num += fat_block_num_to_sector_num(fs_info, blk_cnt);
+            continue;
+        }
+
         rc = fat_buf_access(fs_info, sec_num, FAT_OP_TYPE_READ, &sec_buf);
         if (rc != RC_OK)
             return -1;
@@ -757,6 +815,21 @@ fat_init_volume_info(fat_fs_info_t *fs_info, const char *device)
         free(fs_info->uino);
         rtems_set_errno_and_return_minus_one( ENOMEM );
     }
+    fs_info->fat_cache_buf = (uint8_t *)calloc(FAT_SECTOR_CACHE_SIZE, vol->bps);
+    if (fs_info->fat_cache_buf == NULL)
+    {
+        close(vol->fd);
+        free(fs_info->vhash);
+        free(fs_info->rhash);
+        free(fs_info->uino);
+        free(fs_info->sec_buf);
+        rtems_set_errno_and_return_minus_one( ENOMEM );
+    }
+    for (i = 0; i < FAT_SECTOR_CACHE_SIZE; i++)
+    {
+        fs_info->fat_cache[i].sec_num = FAT_UNDEFINED_VALUE;
+        fs_info->fat_cache[i].buf = fs_info->fat_cache_buf + i * vol->bps;
+    }
 
     /*
      * If possible we will use the cluster size as bdbuf block size for faster
@@ -890,6 +963,8 @@ fat_shutdown_drive(fat_fs_info_t *fs_info)
 
     free(fs_info->uino);
     free(fs_info->sec_buf);
+    free(fs_info->fat_cache_buf);
+    free(fs_info->free_map);
     close(fs_info->vol.fd);
 
     if (rc)
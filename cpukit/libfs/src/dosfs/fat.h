@@ -336,6 +336,15 @@ typedef struct fat_vol_s
 } fat_vol_t;
 
 
+/* count of active FAT sectors copied by fat_get_fat_cluster() */
+#define FAT_SECTOR_CACHE_SIZE 8
+
+typedef struct fat_sector_cache_entry_s
+{
+    uint32_t            sec_num;        /* FAT_UNDEFINED_VALUE if unused */
+    uint8_t            *buf;
+} fat_sector_cache_entry_t;
+
 typedef struct fat_cache_s
 {
     uint32_t            blk_num;
@@ -359,6 +368,16 @@ typedef struct fat_fs_info_s
     uint32_t             uino_base;
     fat_cache_t          c;             /* cache */
     uint8_t             *sec_buf; /* just placeholder for anything */
+    fat_sector_cache_entry_t fat_cache[FAT_SECTOR_CACHE_SIZE]; /* copies of
+                                           active FAT sectors, most recently
+                                           used first */
+    uint8_t             *fat_cache_buf; /* memory of the FAT sector copies */
+    uint32_t            *free_map;      /* free cluster map, a set bit marks
+                                           a free cluster, bit 0 is
+                                           cluster 2 */
+    uint32_t             free_map_scanned; /* count of clusters added to the
+                                              free cluster map so far */
+    uint32_t             free_map_free_cls; /* free clusters among them */
 } fat_fs_info_t;
 
 /*
@@ -21,12 +21,251 @@
 #include <unistd.h>
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <rtems/libio_.h>
 
 #include "fat.h"
 #include "fat_fat_operations.h"
 
+#define FAT_FREE_MAP_BITS 32
+
+#define FAT_FREE_MAP_NONE UINT32_MAX
+
+/*
+ * This is the count of clusters added to the free cluster map by one cluster
+ * allocation or file system statistics request while the map is built.
+ */
+#define FAT_FREE_MAP_BUILD_STEP 512
+
+static bool
+fat_free_map_is_ready(
+    const fat_fs_info_t                  *fs_info
+    )
+{
+    return fs_info->free_map != NULL &&
+           fs_info->free_map_scanned == fs_info->vol.data_cls;
+}
+
+/* fat_free_map_set --
+ *     Update the free cluster map after a change of the file allocation
+ *     table.  Clusters not yet scanned by the map build are left alone, the
+ *     build reads their current value later.
+ */
+static void
+fat_free_map_set(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                              cln,
+    bool                                  is_free
+    )
+{
+    uint32_t  i = cln - FAT_RSRVD_CLN;
+    uint32_t  mask = UINT32_C(1) << (i % FAT_FREE_MAP_BITS);
+    uint32_t *word = &fs_info->free_map[i / FAT_FREE_MAP_BITS];
+    bool      was_free;
+
+    if (i >= fs_info->free_map_scanned)
+        return;
+
+    was_free = (*word & mask) != 0;
+
+    if (is_free)
+        *word |= mask;
+    else
+        *word &= ~mask;
+
+    /* Once the map is ready, the volume free clusters count is maintained */
+    if (!fat_free_map_is_ready(fs_info) && was_free != is_free)
+    {
+        if (is_free)
+            fs_info->free_map_free_cls++;
+        else
+            fs_info->free_map_free_cls--;
+    }
+}
+
+/* fat_free_map_search --
+ *     Search the free cluster map in the range ['begin', 'end') for a run
+ *     of 'count' free clusters
+ *
+ * PARAMETERS:
+ *     map        - free cluster map
+ *     begin      - first map index to search
+ *     end        - map index to stop the search
+ *     count      - length of the run
+ *     first_free - first free map index found if not already set
+ *
+ * RETURNS:
+ *     map index of the run start, or FAT_FREE_MAP_NONE if no run found
+ */
+static uint32_t
+fat_free_map_search(
+    const uint32_t                       *map,
+    uint32_t                              begin,
+    uint32_t                              end,
+    uint32_t                              count,
+    uint32_t                             *first_free
+    )
+{
+    uint32_t i = begin;
+    uint32_t run = 0;
+    uint32_t run_start = 0;
+
+    while (i < end)
+    {
+        uint32_t bits = map[i / FAT_FREE_MAP_BITS] >> (i % FAT_FREE_MAP_BITS);
+        uint32_t avail = MIN(FAT_FREE_MAP_BITS - (i % FAT_FREE_MAP_BITS),
+                             end - i);
+
+        /* Skip the rest of a word without free clusters in one step */
+        if (bits == 0)
+        {
+            run = 0;
+            i += avail;
+            continue;
+        }
+
+        for (; avail > 0; --avail, ++i, bits >>= 1)
+        {
+            if ((bits & 1) != 0)
+            {
+                if (run == 0)
+                {
+                    run_start = i;
+                    if (*first_free == FAT_FREE_MAP_NONE)
+                        *first_free = i;
+                }
+
+                if (++run == count)
+                    return run_start;
+            }
+            else
+            {
+                run = 0;
+            }
+        }
+    }
+
+    return FAT_FREE_MAP_NONE;
+}
+
+/* fat_free_map_find --
+ *     Find a free cluster in the free cluster map with next-fit starting at
+ *     cluster 'cln'.  The first cluster of a run of 'count' free clusters is
+ *     preferred to the first free cluster.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     cln      - cluster to start the search
+ *     count    - count of clusters to allocate
+ *
+ * RETURNS:
+ *     free cluster number, or 0 if there is no free cluster
+ */
+static uint32_t
+fat_free_map_find(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                              cln,
+    uint32_t                              count
+    )
+{
+    uint32_t start = cln - FAT_RSRVD_CLN;
+    uint32_t first_free = FAT_FREE_MAP_NONE;
+    uint32_t i;
+
+    i = fat_free_map_search(fs_info->free_map, start, fs_info->vol.data_cls,
+                            count, &first_free);
+    if (i == FAT_FREE_MAP_NONE)
+        i = fat_free_map_search(fs_info->free_map, 0, start, count,
+                                &first_free);
+    if (i == FAT_FREE_MAP_NONE)
+        i = first_free;
+    if (i == FAT_FREE_MAP_NONE)
+        return 0;
+
+    return i + FAT_RSRVD_CLN;
+}
+
+/* fat_free_map_init --
+ *     Allocate the free cluster map.  The map is built afterwards by
+ *     fat_free_map_build() in steps.  If the map cannot be allocated, then
+ *     the file allocation table is scanned as without the map.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *
+ * RETURNS:
+ *     None
+ */
+void
+fat_free_map_init(
+    fat_fs_info_t                        *fs_info
+    )
+{
+    fs_info->free_map = calloc((fs_info->vol.data_cls + FAT_FREE_MAP_BITS - 1) /
+                               FAT_FREE_MAP_BITS, sizeof(*fs_info->free_map));
+    fs_info->free_map_scanned = 0;
+    fs_info->free_map_free_cls = 0;
+}
+
+/* fat_free_map_build --
+ *     Add the next clusters of the file allocation table to the free
+ *     cluster map.  The map is used for the cluster allocation once all
+ *     clusters are added.  The free clusters count is exact afterwards.
+ *     Until then, the file allocation table is scanned as without the map.
+ *     This spreads the scan of a large file allocation table over the
+ *     first file system operations instead of a single long one.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     all      - if true, complete the map, otherwise add at most
+ *                FAT_FREE_MAP_BUILD_STEP clusters
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+int
+fat_free_map_build(
+    fat_fs_info_t                        *fs_info,
+    bool                                  all
+    )
+{
+    uint32_t end;
+
+    if (fs_info->free_map == NULL || fat_free_map_is_ready(fs_info))
+        return RC_OK;
+
+    end = fs_info->vol.data_cls;
+    if (!all && end - fs_info->free_map_scanned > FAT_FREE_MAP_BUILD_STEP)
+        end = fs_info->free_map_scanned + FAT_FREE_MAP_BUILD_STEP;
+
+    while (fs_info->free_map_scanned < end)
+    {
+        uint32_t i = fs_info->free_map_scanned;
+        uint32_t next_cln = 0;
+        int      rc;
+
+        rc = fat_get_fat_cluster(fs_info, i + FAT_RSRVD_CLN, &next_cln);
+        if ( rc != RC_OK )
+            return rc;
+
+        if (next_cln == FAT_GENFAT_FREE)
+        {
+            fs_info->free_map[i / FAT_FREE_MAP_BITS] |=
+                UINT32_C(1) << (i % FAT_FREE_MAP_BITS);
+            fs_info->free_map_free_cls++;
+        }
+
+        fs_info->free_map_scanned = i + 1;
+    }
+
+    if (fat_free_map_is_ready(fs_info))
+        fs_info->vol.free_cls = fs_info->free_map_free_cls;
+
+    return RC_OK;
+}
+
 /* fat_scan_fat_for_free_clusters --
  *     Allocate chain of free clusters from Files Allocation Table
  *
@@ -63,6 +302,10 @@ fat_scan_fat_for_free_clusters(
 
     *cls_added = 0;
 
+    rc = fat_free_map_build(fs_info, false);
+    if ( rc != RC_OK )
+        return rc;
+
     /*
      * fs_info->vol.data_cls is exactly the count of data clusters
      * starting at cluster 2, so the maximum valid cluster number is
@@ -72,12 +315,26 @@ fat_scan_fat_for_free_clusters(
     {
         uint32_t next_cln = 0;
 
-        rc = fat_get_fat_cluster(fs_info, cl4find, &next_cln);
-        if ( rc != RC_OK )
+        if (fat_free_map_is_ready(fs_info))
         {
-            if (*cls_added != 0)
-                fat_free_fat_clusters_chain(fs_info, (*chain));
-            return rc;
+            /*
+             * Only the first cluster needs a run search, the following
+             * clusters of the run are next to it
+             */
+            cl4find = fat_free_map_find(fs_info, cl4find,
+                                        *cls_added == 0 ? count : 1);
+            if (cl4find == 0)
+                break;
+        }
+        else
+        {
+            rc = fat_get_fat_cluster(fs_info, cl4find, &next_cln);
+            if ( rc != RC_OK )
+            {
+                if (*cls_added != 0)
+                    fat_free_fat_clusters_chain(fs_info, (*chain));
+                return rc;
+            }
         }
 
         if (next_cln == FAT_GENFAT_FREE)
@@ -214,6 +471,121 @@ fat_free_fat_clusters_chain(
     return RC_OK;
 }
 
+/* fat_sector_cache_get --
+ *     Get the copy of a sector of the active FAT and make it the most
+ *     recently used one.  On a cache miss the sector is read and replaces
+ *     the least recently used copy.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     sec      - sector num of the active FAT
+ *     sec_buf  - placeholder for the address of the sector copy
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+static int
+fat_sector_cache_get(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                              sec,
+    uint8_t                             **sec_buf
+    )
+{
+    fat_sector_cache_entry_t *cache = fs_info->fat_cache;
+    fat_sector_cache_entry_t  entry;
+    uint32_t                  i;
+
+    for (i = 0; i < FAT_SECTOR_CACHE_SIZE - 1; i++)
+    {
+        if (cache[i].sec_num == sec)
+            break;
+    }
+
+    entry = cache[i];
+
+    if (entry.sec_num != sec)
+    {
+        uint8_t *src;
+        int      rc;
+
+        rc = fat_buf_access(fs_info, sec, FAT_OP_TYPE_READ, &src);
+        if (rc != RC_OK)
+            return rc;
+
+        memcpy(entry.buf, src, fs_info->vol.bps);
+        entry.sec_num = sec;
+    }
+
+    memmove(&cache[1], &cache[0], i * sizeof(cache[0]));
+    cache[0] = entry;
+
+    *sec_buf = entry.buf;
+    return RC_OK;
+}
+
+/* fat_sector_cache_update --
+ *     Update the copy of a sector of the active FAT if it is cached
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     sec      - sector num of the active FAT
+ *     ofs      - offset inside the sector
+ *     src      - new content
+ *     count    - count of bytes to update
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_sector_cache_update(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                              sec,
+    uint32_t                              ofs,
+    const uint8_t                        *src,
+    uint32_t                              count
+    )
+{
+    uint32_t i;
+
+    for (i = 0; i < FAT_SECTOR_CACHE_SIZE; i++)
+    {
+        if (fs_info->fat_cache[i].sec_num == sec)
+        {
+            memcpy(fs_info->fat_cache[i].buf + ofs, src, count);
+            break;
+        }
+    }
+}
+
+/* fat_sector_cache_invalidate --
+ *     Drop the copy of a sector of the active FAT if it is cached
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     sec      - sector num of the active FAT
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_sector_cache_invalidate(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                              sec
+    )
+{
+    uint32_t i;
+
+    for (i = 0; i < FAT_SECTOR_CACHE_SIZE; i++)
+    {
+        if (fs_info->fat_cache[i].sec_num == sec)
+        {
+            fs_info->fat_cache[i].sec_num = FAT_UNDEFINED_VALUE;
+            break;
+        }
+    }
+}
+
 /* fat_get_fat_cluster --
  *     Fetches the contents of the cluster (link to next cluster in the chain)
  *     from Files Allocation Table.
@@ -248,7 +620,7 @@ fat_get_fat_cluster(
           fs_info->vol.afat_loc;
     ofs = FAT_FAT_OFFSET(fs_info->vol.type, cln) & (fs_info->vol.bps - 1);
 
-    rc = fat_buf_access(fs_info, sec, FAT_OP_TYPE_READ, &sec_buf);
+    rc = fat_sector_cache_get(fs_info, sec, &sec_buf);
     if (rc != RC_OK)
         return rc;
 
@@ -262,8 +634,7 @@ fat_get_fat_cluster(
             *ret_val = (*(sec_buf + ofs));
             if ( ofs == (fs_info->vol.bps - 1) )
             {
-                rc = fat_buf_access(fs_info, sec + 1, FAT_OP_TYPE_READ,
-                                    &sec_buf);
+                rc = fat_sector_cache_get(fs_info, sec + 1, &sec_buf);
                 if (rc != RC_OK)
                     return rc;
 
@@ -422,5 +793,20 @@ fat_set_fat_cluster(
 
     }
 
+    /* Keep the copies of the active FAT sectors up to date */
+    if ((fs_info->vol.type == FAT_FAT12) && (ofs == (fs_info->vol.bps - 1)))
+    {
+        fat_sector_cache_invalidate(fs_info, sec);
+        fat_sector_cache_invalidate(fs_info, sec + 1);
+    }
+    else
+    {
+        fat_sector_cache_update(fs_info, sec, ofs, sec_buf + ofs,
+                                fs_info->vol.type == FAT_FAT32 ? 4 : 2);
+    }
+
+    if (fs_info->free_map != NULL)
+        fat_free_map_set(fs_info, cln, in_val == FAT_GENFAT_FREE);
+
     return RC_OK;
 }
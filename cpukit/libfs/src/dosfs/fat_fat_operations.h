@@ -64,6 +64,13 @@ fat_free_fat_clusters_chain(
     uint32_t                              chain
 );
 
+void
+fat_free_map_init(fat_fs_info_t                          *fs_info);
+
+int
+fat_free_map_build(fat_fs_info_t                         *fs_info,
+                   bool                                   all);
+
 #ifdef __cplusplus
 }
 #endif
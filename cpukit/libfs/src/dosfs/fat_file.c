@@ -25,6 +25,7 @@
 #include <stdarg.h>
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include <time.h>
 
@@ -59,6 +60,12 @@ fat_file_lseek(
     uint32_t                              *disk_cln
 );
 
+static void
+fat_file_extent_free(fat_file_fd_t *fat_fd);
+
+static void
+fat_file_extent_trim(fat_file_fd_t *fat_fd, uint32_t file_cln);
+
 /* fat_file_open --
  *     Open fat-file. Two hash tables are accessed by key
  *     constructed from cluster num and offset of the node (i.e.
@@ -324,11 +331,14 @@ fat_file_close(
                 if (fat_ino_is_unique(fs_info, fat_fd->ino))
                     fat_free_unique_ino(fs_info, fat_fd->ino);
 
+                fat_file_extent_free(fat_fd);
                 free(fat_fd);
             }
         }
         else
         {
+            fat_file_extent_free(fat_fd);
+
             if (fat_ino_is_unique(fs_info, fat_fd->ino))
             {
                 fat_fd->links_num = 0;
@@ -436,6 +446,20 @@ fat_file_read(
         if ( rc != RC_OK )
             return rc;
 
+        /*
+         * Extend the read over physically contiguous clusters so that
+         * _fat_block_read() may transfer them in one request.
+         */
+        while ((c < count) && (cur_cln == save_cln + 1))
+        {
+            c += MIN(count - c, fs_info->vol.bpc);
+
+            save_cln = cur_cln;
+            rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
+            if ( rc != RC_OK )
+                return rc;
+        }
+
         sec_peek = fat_cluster_num_to_sector_num(fs_info, cur_cln);
         blk = fat_sector_num_to_block_num (fs_info, sec_peek);
         blk_cnt = fs_info->vol.bpc >> fs_info->vol.bytes_per_block_log2;
@@ -849,6 +873,15 @@ fat_file_truncate(
     if (rc != RC_OK)
         return rc;
 
+    /*
+     * Forget the clusters before they are freed, so that neither the extents
+     * nor the cache refer to clusters which may be reused by another fat-file
+     * if freeing the chain fails
+     */
+    fat_file_extent_trim(fat_fd, cl_start);
+    fat_fd->map.file_cln = FAT_UNDEFINED_VALUE;
+    fat_fd->map.disk_cln = FAT_UNDEFINED_VALUE;
+
     rc = fat_free_fat_clusters_chain(fs_info, cur_cln);
     if (rc != RC_OK)
         return rc;
@@ -1103,6 +1136,223 @@ _hash_search(
     return -1;
 }
 
+/* fat_file_extent_upper_bound --
+ *     Binary search in the extents of the fat-file
+ *
+ * PARAMETERS:
+ *     fat_fd   - fat-file descriptor
+ *     file_cln - cluster num in the fat-file
+ *
+ * RETURNS:
+ *     count of extents starting at or before 'file_cln'
+ */
+static uint32_t
+fat_file_extent_upper_bound(
+    const fat_file_fd_t                   *fat_fd,
+    uint32_t                               file_cln
+    )
+{
+    uint32_t lo = 0;
+    uint32_t hi = fat_fd->extent_count;
+
+    while (lo < hi)
+    {
+        uint32_t mid = lo + (hi - lo) / 2;
+
+        if (fat_fd->extents[mid].file_cln <= file_cln)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+/* fat_file_extent_thin --
+ *     Drop every second extent of the fat-file, so that the remaining extents
+ *     are spread over the whole cluster chain.  A cluster chain walk starts at
+ *     the preceding extent, so a dropped extent costs at most its length in
+ *     cluster reads.
+ *
+ * PARAMETERS:
+ *     fat_fd   - fat-file descriptor
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_file_extent_thin(
+    fat_file_fd_t                         *fat_fd
+    )
+{
+    uint32_t i;
+
+    for (i = 1; 2 * i < fat_fd->extent_count; ++i)
+        fat_fd->extents[i] = fat_fd->extents[2 * i];
+
+    fat_fd->extent_count = (fat_fd->extent_count + 1) / 2;
+}
+
+/* fat_file_extent_add --
+ *     Add the mapping of a fat-file cluster to a disk cluster to the extents
+ *     of the fat-file.  The mapping extends or joins adjacent extents if
+ *     possible.  If FAT_FILE_EXTENT_MAX extents are known, then every second
+ *     extent is dropped to make room.  Nothing is added if the extents cannot
+ *     grow due to a lack of memory.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     fat_fd   - fat-file descriptor
+ *     file_cln - cluster num in the fat-file
+ *     disk_cln - cluster num on the volume
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_file_extent_add(
+    fat_fs_info_t                         *fs_info,
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln,
+    uint32_t                               disk_cln
+    )
+{
+    fat_file_extent_t *prev = NULL;
+    fat_file_extent_t *next = NULL;
+    uint32_t           i;
+
+    if ((disk_cln < FAT_RSRVD_CLN) ||
+        ((disk_cln & fs_info->vol.mask) >= fs_info->vol.eoc_val))
+        return;
+
+    i = fat_file_extent_upper_bound(fat_fd, file_cln);
+
+    if (i > 0)
+    {
+        prev = &fat_fd->extents[i - 1];
+
+        /* already known */
+        if (file_cln - prev->file_cln < prev->length)
+            return;
+
+        if ((file_cln - prev->file_cln != prev->length) ||
+            (disk_cln - prev->disk_cln != prev->length))
+            prev = NULL;
+    }
+
+    if (i < fat_fd->extent_count)
+    {
+        next = &fat_fd->extents[i];
+
+        if ((next->file_cln != file_cln + 1) ||
+            (next->disk_cln != disk_cln + 1))
+            next = NULL;
+    }
+
+    if (prev != NULL)
+    {
+        prev->length++;
+
+        if (next != NULL)
+        {
+            prev->length += next->length;
+            memmove(next, next + 1,
+                    (fat_fd->extent_count - i - 1) * sizeof(*next));
+            fat_fd->extent_count--;
+        }
+    }
+    else if (next != NULL)
+    {
+        next->file_cln--;
+        next->disk_cln--;
+        next->length++;
+    }
+    else
+    {
+        if (fat_fd->extent_count == fat_fd->extent_capacity)
+        {
+            fat_file_extent_t *extents;
+            uint32_t           capacity;
+
+            if (fat_fd->extent_capacity == FAT_FILE_EXTENT_MAX)
+            {
+                fat_file_extent_thin(fat_fd);
+                i = fat_file_extent_upper_bound(fat_fd, file_cln);
+            }
+            else
+            {
+                capacity = MIN(MAX(2 * fat_fd->extent_capacity, 8),
+                               FAT_FILE_EXTENT_MAX);
+                extents = realloc(fat_fd->extents,
+                                  capacity * sizeof(*extents));
+                if (extents == NULL)
+                    return;
+
+                fat_fd->extents = extents;
+                fat_fd->extent_capacity = capacity;
+            }
+        }
+
+        memmove(&fat_fd->extents[i + 1], &fat_fd->extents[i],
+                (fat_fd->extent_count - i) * sizeof(fat_fd->extents[0]));
+        fat_fd->extents[i].file_cln = file_cln;
+        fat_fd->extents[i].disk_cln = disk_cln;
+        fat_fd->extents[i].length = 1;
+        fat_fd->extent_count++;
+    }
+}
+
+/* fat_file_extent_trim --
+ *     Forget the extents of the fat-file starting at cluster 'file_cln'
+ *
+ * PARAMETERS:
+ *     fat_fd   - fat-file descriptor
+ *     file_cln - first cluster num in the fat-file to forget
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_file_extent_trim(
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln
+    )
+{
+    uint32_t i = fat_file_extent_upper_bound(fat_fd, file_cln);
+
+    if (i > 0)
+    {
+        fat_file_extent_t *prev = &fat_fd->extents[i - 1];
+
+        if (prev->file_cln == file_cln)
+            i--;
+        else if (file_cln - prev->file_cln < prev->length)
+            prev->length = file_cln - prev->file_cln;
+    }
+
+    fat_fd->extent_count = i;
+}
+
+/* fat_file_extent_free --
+ *     Free the extents of the fat-file
+ *
+ * PARAMETERS:
+ *     fat_fd   - fat-file descriptor
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_file_extent_free(
+    fat_file_fd_t                         *fat_fd
+    )
+{
+    free(fat_fd->extents);
+    fat_fd->extents = NULL;
+    fat_fd->extent_count = 0;
+    fat_fd->extent_capacity = 0;
+}
+
 static off_t
 fat_file_lseek(
     fat_fs_info_t                         *fs_info,
@@ -1118,26 +1368,47 @@ fat_file_lseek(
     else
     {
         uint32_t   cur_cln;
-        uint32_t   count;
+        uint32_t   cur_file_cln;
         uint32_t   i;
 
-        if (file_cln > fat_fd->map.file_cln)
+        i = fat_file_extent_upper_bound(fat_fd, file_cln);
+        if (i > 0)
         {
-            cur_cln = fat_fd->map.disk_cln;
-            count = file_cln - fat_fd->map.file_cln;
+            const fat_file_extent_t *ext = &fat_fd->extents[i - 1];
+
+            cur_file_cln = ext->file_cln + ext->length - 1;
+            cur_cln = ext->disk_cln + ext->length - 1;
+
+            /* the cluster is within a known extent */
+            if (file_cln <= cur_file_cln)
+            {
+                cur_file_cln = file_cln;
+                cur_cln = ext->disk_cln + (file_cln - ext->file_cln);
+            }
         }
         else
         {
+            cur_file_cln = 0;
             cur_cln = fat_fd->cln;
-            count = file_cln;
+            fat_file_extent_add(fs_info, fat_fd, cur_file_cln, cur_cln);
+        }
+
+        if ((file_cln > fat_fd->map.file_cln) &&
+            (fat_fd->map.file_cln > cur_file_cln))
+        {
+            cur_file_cln = fat_fd->map.file_cln;
+            cur_cln = fat_fd->map.disk_cln;
         }
 
         /* skip over the clusters */
-        for (i = 0; i < count; i++)
+        while (cur_file_cln < file_cln)
         {
             rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
             if ( rc != RC_OK )
                 return rc;
+
+            cur_file_cln++;
+            fat_file_extent_add(fs_info, fat_fd, cur_file_cln, cur_cln);
         }
 
         /* update cache */
@@ -65,6 +65,23 @@ typedef struct fat_file_map_s
     uint32_t   last_cln;
 } fat_file_map_t;
 
+/**
+ * @brief Run of clusters which are consecutive in the fat-file and on the
+ * volume.
+ */
+typedef struct fat_file_extent_s
+{
+    uint32_t   file_cln;
+    uint32_t   disk_cln;
+    uint32_t   length;
+} fat_file_extent_t;
+
+/*
+ * maximum count of extents known per fat-file, if more extents are found
+ * every second extent is dropped
+ */
+#define FAT_FILE_EXTENT_MAX 256
+
 /**
  * @brief Descriptor of a fat-file.
  *
@@ -89,6 +106,13 @@ typedef struct fat_file_fd_s
     fat_dir_pos_t    dir_pos;
     uint8_t          flags;
     fat_file_map_t   map;
+    fat_file_extent_t *extents;     /*
+                                     * known extents of the cluster chain
+                                     * sorted by file cluster, populated by
+                                     * the cluster chain walks
+                                     */
+    uint32_t         extent_count;
+    uint32_t         extent_capacity;
     time_t           ctime;
     time_t           mtime;
 
@@ -154,6 +178,7 @@ static inline void
 fat_file_set_first_cluster_num(fat_file_fd_t *fat_fd, uint32_t cln)
 {
     fat_fd->cln = cln;
+    fat_fd->extent_count = 0;
     fat_fd->flags |= FAT_FILE_META_DATA_CHANGED;
 }
 
@@ -27,6 +27,7 @@
 
 #include <rtems/libio_.h>
 #include <rtems/dosfs.h>
+#include "fat_fat_operations.h"
 #include "msdos.h"
 
 static int msdos_clone_node_info(rtems_filesystem_location_info_t *loc)
@@ -121,6 +122,14 @@ int rtems_dosfs_initialize(
         if (rc != 0 && converter_created) {
             (*converter->handler->destroy)(converter);
         }
+
+        if (rc == 0 && mount_options != NULL &&
+            mount_options->version == RTEMS_DOSFS_MOUNT_OPTIONS_VERSION &&
+            (mount_options->flags & RTEMS_DOSFS_FREE_CLUSTER_MAP) != 0) {
+            msdos_fs_info_t *fs_info = mt_entry->fs_info;
+
+            fat_free_map_init(&fs_info->fat);
+        }
     } else {
         errno = ENOMEM;
         rc = -1;
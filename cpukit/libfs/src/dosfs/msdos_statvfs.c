@@ -39,6 +39,18 @@ int msdos_statvfs(
   sb->f_flag = 0;
   sb->f_namemax = MSDOS_NAME_MAX_LNF_LEN;
 
+  /*
+   * The free cluster map keeps the free clusters count up to date.  If the
+   * count is unknown, then complete the map since this needs the same scan of
+   * the file allocation table.
+   */
+  if (fat_free_map_build(&fs_info->fat,
+                         vol->free_cls == FAT_UNDEFINED_VALUE) != RC_OK)
+  {
+    msdos_fs_unlock(fs_info);
+    return -1;
+  }
+
   if (vol->free_cls == FAT_UNDEFINED_VALUE)
   {
     int rc;
@@ -0,0 +1,451 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup IMFS
+ *
+ * @brief IMFS Chunk File Handlers
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/imfsimpl.h>
+#include <rtems/malloc.h>
+#include <rtems/thread.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IMFS_CHUNKFILE_CHUNK_MASK ( IMFS_CHUNKFILE_CHUNK_SIZE - 1 )
+
+#define IMFS_CHUNKFILE_TABLE_MINIMUM 8
+
+/*
+ *  The pool of released chunks.  The free chunks are linked through their
+ *  first word.
+ */
+static rtems_mutex IMFS_chunkfile_pool_mutex =
+  RTEMS_MUTEX_INITIALIZER( "IMFS Chunks" );
+
+static block_p IMFS_chunkfile_pool_first;
+
+static size_t IMFS_chunkfile_pool_count;
+
+static block_p IMFS_chunkfile_alloc_chunk( void )
+{
+  block_p chunk;
+
+  rtems_mutex_lock( &IMFS_chunkfile_pool_mutex );
+  chunk = IMFS_chunkfile_pool_first;
+  if ( chunk != NULL ) {
+    IMFS_chunkfile_pool_first = *(block_p *) chunk;
+    --IMFS_chunkfile_pool_count;
+  }
+  rtems_mutex_unlock( &IMFS_chunkfile_pool_mutex );
+
+  if ( chunk == NULL ) {
+    chunk = rtems_heap_allocate_aligned_with_boundary(
+      IMFS_CHUNKFILE_CHUNK_SIZE,
+      IMFS_CHUNKFILE_CHUNK_SIZE,
+      0
+    );
+  }
+
+  return chunk;
+}
+
+static void IMFS_chunkfile_free_chunk( block_p chunk )
+{
+  rtems_mutex_lock( &IMFS_chunkfile_pool_mutex );
+  if ( IMFS_chunkfile_pool_count < IMFS_CHUNKFILE_POOL_MAXIMUM ) {
+    *(block_p *) chunk = IMFS_chunkfile_pool_first;
+    IMFS_chunkfile_pool_first = chunk;
+    ++IMFS_chunkfile_pool_count;
+    chunk = NULL;
+  }
+  rtems_mutex_unlock( &IMFS_chunkfile_pool_mutex );
+
+  free( chunk );
+}
+
+/*
+ *  Makes sure the chunk table has an entry for each chunk up to the chunk
+ *  count.  The table grows at least by doubling its size.
+ */
+static int IMFS_chunkfile_reserve(
+  IMFS_chunkfile_t *chunkfile,
+  size_t            chunk_count
+)
+{
+  block_p *chunks;
+  size_t   new_count;
+
+  if ( chunk_count <= chunkfile->chunk_count ) {
+    return 0;
+  }
+
+  new_count = chunkfile->chunk_count * 2;
+  if ( new_count < IMFS_CHUNKFILE_TABLE_MINIMUM ) {
+    new_count = IMFS_CHUNKFILE_TABLE_MINIMUM;
+  }
+  if ( new_count < chunk_count ) {
+    new_count = chunk_count;
+  }
+
+  if ( new_count > SIZE_MAX / sizeof( *chunks ) ) {
+    return EFBIG;
+  }
+
+  chunks = realloc( chunkfile->chunks, new_count * sizeof( *chunks ) );
+  if ( chunks == NULL ) {
+    return ENOSPC;
+  }
+
+  memset(
+    &chunks[ chunkfile->chunk_count ],
+    0,
+    ( new_count - chunkfile->chunk_count ) * sizeof( *chunks )
+  );
+  chunkfile->chunks = chunks;
+  chunkfile->chunk_count = new_count;
+
+  return 0;
+}
+
+/*
+ *  Releases the chunks past the specified size and zeros the bytes past the
+ *  size in the last chunk to keep the unused chunk space zero.
+ */
+static void IMFS_chunkfile_release(
+  IMFS_chunkfile_t *chunkfile,
+  size_t            size
+)
+{
+  size_t index;
+  size_t offset;
+
+  index = ( size >> IMFS_CHUNKFILE_CHUNK_SHIFT );
+  offset = size & IMFS_CHUNKFILE_CHUNK_MASK;
+
+  if ( offset != 0 ) {
+    if ( index < chunkfile->chunk_count && chunkfile->chunks[ index ] != NULL ) {
+      memset(
+        &chunkfile->chunks[ index ][ offset ],
+        0,
+        IMFS_CHUNKFILE_CHUNK_SIZE - offset
+      );
+    }
+
+    ++index;
+  }
+
+  for ( ; index < chunkfile->chunk_count ; ++index ) {
+    if ( chunkfile->chunks[ index ] != NULL ) {
+      IMFS_chunkfile_free_chunk( chunkfile->chunks[ index ] );
+      chunkfile->chunks[ index ] = NULL;
+    }
+  }
+}
+
+/*
+ *  IMFS_chunkfile_read
+ *
+ *  This routine reads from the chunk file into the destination buffer.  The
+ *  read is truncated at the end of the file.  Holes read as zeros.
+ */
+static ssize_t IMFS_chunkfile_read(
+  IMFS_chunkfile_t *chunkfile,
+  off_t             start,
+  unsigned char    *destination,
+  size_t            length
+)
+{
+  size_t size;
+  size_t position;
+  size_t copied;
+
+  IMFS_assert( chunkfile );
+  IMFS_assert( destination );
+
+  size = chunkfile->File.size;
+
+  if ( start >= (off_t) size ) {
+    return 0;
+  }
+
+  position = (size_t) start;
+  if ( length > size - position ) {
+    length = size - position;
+  }
+
+  copied = 0;
+
+  while ( copied < length ) {
+    size_t  index = position >> IMFS_CHUNKFILE_CHUNK_SHIFT;
+    size_t  offset = position & IMFS_CHUNKFILE_CHUNK_MASK;
+    size_t  to_copy = IMFS_CHUNKFILE_CHUNK_SIZE - offset;
+    block_p chunk = NULL;
+
+    if ( to_copy > length - copied ) {
+      to_copy = length - copied;
+    }
+
+    if ( index < chunkfile->chunk_count ) {
+      chunk = chunkfile->chunks[ index ];
+    }
+
+    if ( chunk != NULL ) {
+      memcpy( &destination[ copied ], &chunk[ offset ], to_copy );
+    } else {
+      memset( &destination[ copied ], 0, to_copy );
+    }
+
+    position += to_copy;
+    copied += to_copy;
+  }
+
+  IMFS_update_atime( &chunkfile->File.Node );
+
+  return (ssize_t) copied;
+}
+
+/*
+ *  IMFS_chunkfile_write
+ *
+ *  This routine writes the source buffer into the chunk file.  The file is
+ *  extended as needed.
+ */
+ssize_t IMFS_chunkfile_write(
+   IMFS_chunkfile_t    *chunkfile,
+   off_t                start,
+   const unsigned char *source,
+   size_t               length
+)
+{
+  size_t position;
+  size_t end;
+  size_t copied;
+  int    eno;
+
+  IMFS_assert( chunkfile );
+  IMFS_assert( source );
+
+  if (
+    (uintmax_t) start > SIZE_MAX
+      || length > SIZE_MAX - (size_t) start
+      || length > SSIZE_MAX
+  ) {
+    rtems_set_errno_and_return_minus_one( EFBIG );
+  }
+
+  position = (size_t) start;
+  end = position + length;
+
+  eno = IMFS_chunkfile_reserve(
+    chunkfile,
+    ( end >> IMFS_CHUNKFILE_CHUNK_SHIFT )
+      + ( ( end & IMFS_CHUNKFILE_CHUNK_MASK ) != 0 )
+  );
+  if ( eno != 0 ) {
+    rtems_set_errno_and_return_minus_one( eno );
+  }
+
+  copied = 0;
+
+  while ( copied < length ) {
+    size_t  index = position >> IMFS_CHUNKFILE_CHUNK_SHIFT;
+    size_t  offset = position & IMFS_CHUNKFILE_CHUNK_MASK;
+    size_t  to_copy = IMFS_CHUNKFILE_CHUNK_SIZE - offset;
+    block_p chunk = chunkfile->chunks[ index ];
+
+    if ( to_copy > length - copied ) {
+      to_copy = length - copied;
+    }
+
+    if ( chunk == NULL ) {
+      chunk = IMFS_chunkfile_alloc_chunk();
+      if ( chunk == NULL ) {
+        break;
+      }
+
+      if ( to_copy != IMFS_CHUNKFILE_CHUNK_SIZE ) {
+        memset( chunk, 0, IMFS_CHUNKFILE_CHUNK_SIZE );
+      }
+
+      chunkfile->chunks[ index ] = chunk;
+    }
+
+    memcpy( &chunk[ offset ], &source[ copied ], to_copy );
+    position += to_copy;
+    copied += to_copy;
+  }
+
+  if ( copied == 0 && length != 0 ) {
+    rtems_set_errno_and_return_minus_one( ENOSPC );
+  }
+
+  if ( position > chunkfile->File.size ) {
+    chunkfile->File.size = position;
+  }
+
+  IMFS_mtime_ctime_update( &chunkfile->File.Node );
+
+  return (ssize_t) copied;
+}
+
+static ssize_t chunkfile_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+)
+{
+  IMFS_file_t *file = IMFS_iop_to_file( iop );
+  ssize_t      status;
+
+  status = IMFS_chunkfile_read( &file->Chunkfile, iop->offset, buffer, count );
+
+  if ( status > 0 )
+    iop->offset += status;
+
+  return status;
+}
+
+static ssize_t chunkfile_write(
+  rtems_libio_t *iop,
+  const void    *buffer,
+  size_t         count
+)
+{
+  IMFS_file_t *file = IMFS_iop_to_file( iop );
+  ssize_t      status;
+
+  if (rtems_libio_iop_is_append(iop))
+    iop->offset = file->File.size;
+
+  status = IMFS_chunkfile_write( &file->Chunkfile, iop->offset, buffer, count );
+
+  if ( status > 0 )
+    iop->offset += status;
+
+  return status;
+}
+
+static int chunkfile_fstat(
+  const rtems_filesystem_location_info_t *loc,
+  struct stat                            *buf
+)
+{
+  const IMFS_file_t *file = loc->node_access;
+
+  buf->st_size = file->File.size;
+  buf->st_blksize = IMFS_CHUNKFILE_CHUNK_SIZE;
+
+  return IMFS_stat( loc, buf );
+}
+
+/*
+ *  The chunks past the new length are released.  Extending the file only sets
+ *  the new length since the unused space of the last chunk is zero and holes
+ *  read as zeros.
+ */
+static int chunkfile_ftruncate(
+  rtems_libio_t *iop,
+  off_t          length
+)
+{
+  IMFS_file_t *file = IMFS_iop_to_file( iop );
+
+  if ( (uintmax_t) length > SIZE_MAX )
+    rtems_set_errno_and_return_minus_one( EFBIG );
+
+  if ( (size_t) length < file->File.size )
+    IMFS_chunkfile_release( &file->Chunkfile, (size_t) length );
+
+  file->File.size = (size_t) length;
+
+  IMFS_mtime_ctime_update( &file->Node );
+
+  return 0;
+}
+
+static IMFS_jnode_t *IMFS_node_initialize_chunkfile(
+  IMFS_jnode_t *node,
+  void         *arg
+)
+{
+  IMFS_file_t *file = (IMFS_file_t *) node;
+
+  file->Chunkfile.chunks = NULL;
+  file->Chunkfile.chunk_count = 0;
+
+  return node;
+}
+
+static void IMFS_chunkfile_destroy( IMFS_jnode_t *node )
+{
+  IMFS_file_t *file = (IMFS_file_t *) node;
+
+  IMFS_chunkfile_release( &file->Chunkfile, 0 );
+  free( file->Chunkfile.chunks );
+
+  IMFS_node_destroy_default( node );
+}
+
+static const rtems_filesystem_file_handlers_r IMFS_chunkfile_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = rtems_filesystem_default_close,
+  .read_h = chunkfile_read,
+  .write_h = chunkfile_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek_file,
+  .fstat_h = chunkfile_fstat,
+  .ftruncate_h = chunkfile_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .mmap_h = rtems_filesystem_default_mmap,
+  .munmap_h = rtems_filesystem_default_munmap,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev
+};
+
+const IMFS_mknod_control IMFS_mknod_control_chunkfile = {
+  {
+    .handlers = &IMFS_chunkfile_handlers,
+    .node_initialize = IMFS_node_initialize_chunkfile,
+    .node_remove = IMFS_node_remove_default,
+    .node_destroy = IMFS_chunkfile_destroy
+  },
+  .node_size = sizeof( IMFS_file_t )
+};
@@ -72,16 +72,23 @@ static const IMFS_mknod_controls IMFS_default_mknod_controls = {
   .fifo = &IMFS_mknod_control_enosys
 };
 
-int IMFS_initialize(
+static const IMFS_mknod_controls IMFS_chunkfile_mknod_controls = {
+  .directory = &IMFS_mknod_control_dir_default,
+  .device = &IMFS_mknod_control_device,
+  .file = &IMFS_mknod_control_chunkfile,
+  .fifo = &IMFS_mknod_control_enosys
+};
+
+static int IMFS_do_initialize(
   rtems_filesystem_mount_table_entry_t *mt_entry,
-  const void                           *data
+  const IMFS_mknod_controls            *mknod_controls
 )
 {
   IMFS_fs_info_t *fs_info = calloc( 1, sizeof( *fs_info ) );
   IMFS_mount_data mount_data = {
     .fs_info = fs_info,
     .ops = &IMFS_ops,
-    .mknod_controls = &IMFS_default_mknod_controls
+    .mknod_controls = mknod_controls
   };
 
   if ( fs_info == NULL ) {
@@ -90,3 +97,19 @@ int IMFS_initialize(
 
   return IMFS_initialize_support( mt_entry, &mount_data );
 }
+
+int IMFS_initialize(
+  rtems_filesystem_mount_table_entry_t *mt_entry,
+  const void                           *data
+)
+{
+  return IMFS_do_initialize( mt_entry, &IMFS_default_mknod_controls );
+}
+
+int IMFS_chunkfile_initialize(
+  rtems_filesystem_mount_table_entry_t *mt_entry,
+  const void                           *data
+)
+{
+  return IMFS_do_initialize( mt_entry, &IMFS_chunkfile_mknod_controls );
+}
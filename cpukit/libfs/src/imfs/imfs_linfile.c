@@ -76,25 +76,102 @@ static int IMFS_linfile_open(
    * Perform 'copy on write' for linear files
    */
   if (rtems_libio_iop_is_writeable(iop)) {
-    uint32_t count = file->File.size;
-    const unsigned char *buffer = file->Linearfile.direct;
+    const IMFS_fs_info_t *fs_info = iop->pathinfo.mt_entry->fs_info;
+    uint32_t count;
+    const unsigned char *buffer;
+    ssize_t written;
+
+    rtems_filesystem_instance_lock( &iop->pathinfo );
+
+    /*
+     * The shared mappings refer to the file image, so the copy would no longer
+     * be the mapped file.
+     */
+    if (file->File.mapping_count != 0) {
+      rtems_filesystem_instance_unlock( &iop->pathinfo );
+      rtems_set_errno_and_return_minus_one( EBUSY );
+    }
+
+    count = file->File.size;
+    buffer = file->Linearfile.direct;
+    written = 0;
+    file->File.size = 0;
+
+    if (fs_info->mknod_controls->file == &IMFS_mknod_control_chunkfile) {
+      file->Node.control = &IMFS_mknod_control_chunkfile.node_control;
+      file->Chunkfile.chunks = NULL;
+      file->Chunkfile.chunk_count = 0;
+
+      IMFS_Set_handlers( &iop->pathinfo );
+
+      if (count != 0)
+        written = IMFS_chunkfile_write(&file->Chunkfile, 0, buffer, count);
+    } else {
+      file->Node.control            = &IMFS_mknod_control_memfile.node_control;
+      file->Memfile.indirect        = 0;
+      file->Memfile.doubly_indirect = 0;
+      file->Memfile.triply_indirect = 0;
+
+      IMFS_Set_handlers( &iop->pathinfo );
+
+      if (count != 0)
+        written = IMFS_memfile_write(&file->Memfile, 0, buffer, count);
+    }
+
+    rtems_filesystem_instance_unlock( &iop->pathinfo );
+
+    if (written == -1)
+      return -1;
+  }
 
-    file->Node.control            = &IMFS_mknod_control_memfile.node_control;
-    file->File.size               = 0;
-    file->Memfile.indirect        = 0;
-    file->Memfile.doubly_indirect = 0;
-    file->Memfile.triply_indirect = 0;
+  return 0;
+}
+
+/*
+ * The shared mappings of linear files refer directly to the file image.  The
+ * mapping count is changed under the file system instance lock like the
+ * copy on write in IMFS_linfile_open().
+ */
+static int IMFS_linfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_file_t *file = IMFS_iop_to_file( iop );
+  size_t size;
 
-    IMFS_Set_handlers( &iop->pathinfo );
+  rtems_filesystem_instance_lock( &iop->pathinfo );
 
-    if ((count != 0)
-     && (IMFS_memfile_write(&file->Memfile, 0, buffer, count) == -1))
-        return -1;
+  size = file->File.size;
+
+  if (off < 0 || (uintmax_t) off > size || len > size - (size_t) off) {
+    rtems_filesystem_instance_unlock( &iop->pathinfo );
+    rtems_set_errno_and_return_minus_one( ENXIO );
   }
 
+  *addr = &file->Linearfile.direct[off];
+  ++file->File.mapping_count;
+  IMFS_update_atime( &file->Node );
+
+  rtems_filesystem_instance_unlock( &iop->pathinfo );
+
   return 0;
 }
 
+static void IMFS_linfile_munmap(
+  const rtems_filesystem_location_info_t *loc,
+  void                                   *addr,
+  size_t                                  len
+)
+{
+  IMFS_file_t *file = loc->node_access;
+
+  --file->File.mapping_count;
+}
+
 static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .open_h = IMFS_linfile_open,
   .close_h = rtems_filesystem_default_close,
@@ -108,7 +185,8 @@ static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
   .fcntl_h = rtems_filesystem_default_fcntl,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
-  .mmap_h = rtems_filesystem_default_mmap,
+  .mmap_h = IMFS_linfile_mmap,
+  .munmap_h = IMFS_linfile_munmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
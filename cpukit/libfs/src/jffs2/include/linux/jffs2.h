@@ -46,6 +46,10 @@
 #define JFFS2_COMPR_DYNRUBIN	0x05
 #define JFFS2_COMPR_ZLIB	0x06
 #define JFFS2_COMPR_LZO		0x07
+#ifdef __rtems__
+/* Not supported by other JFFS2 implementations */
+#define JFFS2_COMPR_FASTLZ	0x40
+#endif /* __rtems__ */
 /* Compatibility flags. */
 #define JFFS2_COMPAT_MASK 0xc000      /* What do to if an unknown nodetype is found */
 #define JFFS2_NODE_ACCURATE 0x2000
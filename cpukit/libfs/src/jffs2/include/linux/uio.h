@@ -1,4 +1,7 @@
 #ifndef _LINUX_UIO_H
 #define _LINUX_UIO_H
 
+#include <linux/types.h>
+#include <sys/uio.h>
+
 #endif /* _LINUX_UIO_H */
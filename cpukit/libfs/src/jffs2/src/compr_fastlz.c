@@ -0,0 +1,295 @@
+#include "rtems-jffs2-config.h"
+
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Compressor producing the FastLZ level 1 format, see cpukit/libdl/fastlz.c.
+ *
+ * The stream is a sequence of instructions.  The upper three bits of the
+ * first instruction byte select either a literal run (zero) or a match:
+ *
+ * - A literal run is encoded as (count - 1) followed by count literal bytes,
+ *   with 1 <= count <= 32.
+ *
+ * - A match of length L at distance D + 1 is encoded as
+ *   ((L - 2) << 5) | (D >> 8) followed by (D & 0xff) for L < 9, and as
+ *   (7 << 5) | (D >> 8), (L - 9) and (D & 0xff) for 9 <= L <= 264.
+ *
+ * The stream always starts with a literal run, so that the upper three bits of
+ * the first byte indicate the level 1 format.  In contrast to the libdl
+ * implementation, the hash table is part of the compressor control and not
+ * placed on the stack and the output is bounded by the available space.
+ */
+
+#include <linux/kernel.h>
+#include <linux/types.h>
+#include <linux/errno.h>
+#include <linux/string.h>
+#include <linux/jffs2.h>
+#include "compr.h"
+
+#define FASTLZ_MIN_INPUT 16
+
+#define FASTLZ_MAX_COPY 32
+
+#define FASTLZ_MIN_LEN 3
+
+#define FASTLZ_MAX_LEN 264
+
+#define FASTLZ_MAX_DISTANCE 8192
+
+#define FASTLZ_HASH_LOG 12
+
+RTEMS_STATIC_ASSERT(
+	RTEMS_JFFS2_COMPRESSOR_FASTLZ_HASH_SIZE == (1U << FASTLZ_HASH_LOG),
+	jffs2_fastlz_hash_size
+);
+
+RTEMS_STATIC_ASSERT(PAGE_SIZE < UINT16_MAX, jffs2_fastlz_page_size);
+
+static rtems_jffs2_compressor_fastlz_control *get_fastlz_control(
+	rtems_jffs2_compressor_control *super
+)
+{
+	return (rtems_jffs2_compressor_fastlz_control *) super;
+}
+
+static uint32_t fastlz_hash(const unsigned char *p)
+{
+	uint32_t v = p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16);
+
+	return (v * 2654435761U) >> (32 - FASTLZ_HASH_LOG);
+}
+
+static unsigned char *fastlz_emit_literals(
+	unsigned char *op,
+	const unsigned char *op_end,
+	const unsigned char *ip,
+	uint32_t count
+)
+{
+	while (count > 0) {
+		uint32_t run = min_t(uint32_t, count, FASTLZ_MAX_COPY);
+
+		if ((uint32_t) (op_end - op) < run + 1) {
+			return NULL;
+		}
+
+		*op++ = (unsigned char) (run - 1);
+		memcpy(op, ip, run);
+		op += run;
+		ip += run;
+		count -= run;
+	}
+
+	return op;
+}
+
+static unsigned char *fastlz_emit_match(
+	unsigned char *op,
+	const unsigned char *op_end,
+	uint32_t len,
+	uint32_t distance
+)
+{
+	uint32_t code = len - 2;
+
+	if (op_end - op < 3) {
+		return NULL;
+	}
+
+	if (code < 7) {
+		*op++ = (unsigned char) ((code << 5) | (distance >> 8));
+	} else {
+		*op++ = (unsigned char) ((7 << 5) | (distance >> 8));
+		*op++ = (unsigned char) (code - 7);
+	}
+
+	*op++ = (unsigned char) (distance & 0xff);
+
+	return op;
+}
+
+uint16_t rtems_jffs2_compressor_fastlz_compress(
+	rtems_jffs2_compressor_control *super,
+	unsigned char *data_in,
+	unsigned char *cpage_out,
+	uint32_t *sourcelen,
+	uint32_t *dstlen
+)
+{
+	rtems_jffs2_compressor_fastlz_control *self = get_fastlz_control(super);
+	uint16_t *htab = &self->hash_table[0];
+	uint32_t length = *sourcelen;
+	unsigned char *op = cpage_out;
+	const unsigned char *op_end;
+	uint32_t anchor = 0;
+	uint32_t pos = 0;
+
+	if (length < FASTLZ_MIN_INPUT || length > PAGE_SIZE) {
+		return JFFS2_COMPR_NONE;
+	}
+
+	/* Only output smaller than the input is useful */
+	op_end = op + min_t(uint32_t, *dstlen, length - 1);
+
+	/* Hash table entries are positions plus one, zero means empty */
+	memset(htab, 0, sizeof(self->hash_table));
+
+	while (pos + FASTLZ_MIN_LEN <= length) {
+		uint32_t hval = fastlz_hash(&data_in[pos]);
+		uint32_t ref = htab[hval];
+		uint32_t len;
+
+		htab[hval] = (uint16_t) (pos + 1);
+
+		if (
+			ref == 0 ||
+			pos - (ref - 1) > FASTLZ_MAX_DISTANCE ||
+			memcmp(&data_in[ref - 1], &data_in[pos], FASTLZ_MIN_LEN) != 0
+		) {
+			++pos;
+			continue;
+		}
+
+		--ref;
+		len = FASTLZ_MIN_LEN;
+
+		while (
+			len < FASTLZ_MAX_LEN && pos + len < length &&
+			data_in[ref + len] == data_in[pos + len]
+		) {
+			++len;
+		}
+
+		op = fastlz_emit_literals(op, op_end, &data_in[anchor], pos - anchor);
+		if (op == NULL) {
+			return JFFS2_COMPR_NONE;
+		}
+
+		op = fastlz_emit_match(op, op_end, len, pos - ref - 1);
+		if (op == NULL) {
+			return JFFS2_COMPR_NONE;
+		}
+
+		pos += len;
+		anchor = pos;
+	}
+
+	op = fastlz_emit_literals(op, op_end, &data_in[anchor], length - anchor);
+	if (op == NULL) {
+		return JFFS2_COMPR_NONE;
+	}
+
+	*dstlen = (uint32_t) (op - cpage_out);
+
+	return JFFS2_COMPR_FASTLZ;
+}
+
+int rtems_jffs2_compressor_fastlz_decompress(
+	rtems_jffs2_compressor_control *self,
+	uint16_t comprtype,
+	unsigned char *data_in,
+	unsigned char *cpage_out,
+	uint32_t srclen,
+	uint32_t destlen
+)
+{
+	const unsigned char *ip = data_in;
+	const unsigned char *ip_end = data_in + srclen;
+	unsigned char *op = cpage_out;
+	const unsigned char *op_end = cpage_out + destlen;
+	uint32_t ctrl;
+
+	(void) self;
+
+	if (comprtype != JFFS2_COMPR_FASTLZ || srclen == 0) {
+		return -EIO;
+	}
+
+	/* The upper three bits of the first byte indicate the level */
+	ctrl = *ip++;
+	if ((ctrl >> 5) != 0) {
+		return -EIO;
+	}
+
+	for (;;) {
+		if (ctrl < 32) {
+			uint32_t run = ctrl + 1;
+
+			if ((uint32_t) (ip_end - ip) < run || (uint32_t) (op_end - op) < run) {
+				return -EIO;
+			}
+
+			memcpy(op, ip, run);
+			op += run;
+			ip += run;
+		} else {
+			uint32_t len = (ctrl >> 5) + 2;
+			uint32_t distance = (ctrl & 31) << 8;
+			const unsigned char *ref;
+
+			if ((ctrl >> 5) == 7) {
+				if (ip == ip_end) {
+					return -EIO;
+				}
+
+				len += *ip++;
+			}
+
+			if (ip == ip_end) {
+				return -EIO;
+			}
+
+			distance += *ip++;
+
+			if ((uint32_t) (op - cpage_out) <= distance || (uint32_t) (op_end - op) < len) {
+				return -EIO;
+			}
+
+			/* The source may overlap the destination */
+			ref = op - distance - 1;
+			while (len > 0) {
+				*op++ = *ref++;
+				--len;
+			}
+		}
+
+		if (ip == ip_end) {
+			break;
+		}
+
+		ctrl = *ip++;
+	}
+
+	if (op != op_end) {
+		return -EIO;
+	}
+
+	return 0;
+}
@@ -64,6 +64,12 @@ jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 	size_t totlen = 0, thislen;
 	int ret = 0;
 
+	if (!jffs2_is_writebuffered(c) && jffs2_sum_active()) {
+		ret = jffs2_sum_add_kvec(c, vecs, count, (uint32_t) to);
+		if (ret)
+			return ret;
+	}
+
 	for (i = 0; i < count; i++) {
 		// writes need to be aligned but the data we're passed may not be
 		// Observation suggests most unaligned writes are small, so we
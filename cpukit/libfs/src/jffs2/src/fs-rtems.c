@@ -30,6 +30,7 @@
 #include <assert.h>
 #include <rtems/libio.h>
 #include <rtems/libio_.h>
+#include <rtems/counter.h>
 #include <rtems/sysinit.h>
 
 /* Ensure that the JFFS2 values are identical to the POSIX defines */
@@ -583,6 +584,10 @@ static int rtems_jffs2_ioctl(
 			  eno = -jffs2_flush_wbuf_pad(&inode->i_sb->jffs2_sb);
 			}
 			break;
+		case RTEMS_JFFS2_GET_GC_STATS:
+			memcpy(buffer, &inode->i_sb->s_gc_stats, sizeof(inode->i_sb->s_gc_stats));
+			eno = 0;
+			break;
 		default:
 			eno = EINVAL;
 			break;
@@ -607,6 +612,7 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_directory_handlers = {
 	.fcntl_h = rtems_filesystem_default_fcntl,
 	.kqfilter_h = rtems_filesystem_default_kqfilter,
 	.mmap_h = rtems_filesystem_default_mmap,
+	.munmap_h = rtems_filesystem_default_munmap,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
 	.writev_h = rtems_filesystem_default_writev
@@ -750,6 +756,7 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_file_handlers = {
 	.fcntl_h = rtems_filesystem_default_fcntl,
 	.kqfilter_h = rtems_filesystem_default_kqfilter,
 	.mmap_h = rtems_filesystem_default_mmap,
+	.munmap_h = rtems_filesystem_default_munmap,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
 	.writev_h = rtems_filesystem_default_writev
@@ -769,6 +776,7 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_link_handlers = {
 	.fcntl_h = rtems_filesystem_default_fcntl,
 	.kqfilter_h = rtems_filesystem_default_kqfilter,
 	.mmap_h = rtems_filesystem_default_mmap,
+	.munmap_h = rtems_filesystem_default_munmap,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
 	.writev_h = rtems_filesystem_default_writev
@@ -1056,13 +1064,17 @@ static void rtems_jffs2_freenode(const rtems_filesystem_location_info_t *loc)
 
 static void jffs2_remove_delayed_work(struct delayed_work *dwork);
 
+static void rtems_jffs2_stop_gc_task(struct super_block *sb);
+
 static void rtems_jffs2_fsunmount(rtems_filesystem_mount_table_entry_t *mt_entry)
 {
 	rtems_jffs2_fs_info *fs_info = mt_entry->fs_info;
 	struct _inode *root_i = mt_entry->mt_fs_root->location.node_access;
-#ifdef CONFIG_JFFS2_FS_WRITEBUFFER
 	struct jffs2_sb_info *c = JFFS2_SB_INFO(&fs_info->sb);
 
+	rtems_jffs2_stop_gc_task(&fs_info->sb);
+
+#ifdef CONFIG_JFFS2_FS_WRITEBUFFER
 	/* Remove wbuf delayed work */
 	jffs2_remove_delayed_work(&c->wbuf_dwork);
 
@@ -1360,6 +1372,182 @@ RTEMS_SYSINIT_ITEM(
   RTEMS_SYSINIT_ORDER_MIDDLE
 );
 
+#define RTEMS_JFFS2_GC_EVENT_TRIGGER RTEMS_EVENT_0
+
+#define RTEMS_JFFS2_GC_EVENT_STOP RTEMS_EVENT_1
+
+static uint64_t rtems_jffs2_nanoseconds_since(rtems_counter_ticks begin)
+{
+	rtems_counter_ticks end = rtems_counter_read();
+
+	return rtems_counter_ticks_to_nanoseconds(
+		rtems_counter_difference(end, begin)
+	);
+}
+
+void jffs2_garbage_collect_trigger(struct jffs2_sb_info *c)
+{
+	const struct super_block *sb = OFNI_BS_2SFFJ(c);
+	rtems_jffs2_flash_control *fc = sb->s_flash_control;
+
+	if (sb->s_gc_task != 0) {
+		(void) rtems_event_send(sb->s_gc_task, RTEMS_JFFS2_GC_EVENT_TRIGGER);
+	} else if (fc->trigger_garbage_collection != NULL) {
+		(*fc->trigger_garbage_collection)(fc);
+	}
+}
+
+int jffs2_garbage_collect_pass_for_write(struct jffs2_sb_info *c)
+{
+	rtems_jffs2_gc_stats *stats = &OFNI_BS_2SFFJ(c)->s_gc_stats;
+	rtems_counter_ticks begin = rtems_counter_read();
+	uint64_t duration;
+	int ret;
+
+	ret = jffs2_garbage_collect_pass(c);
+	duration = rtems_jffs2_nanoseconds_since(begin);
+
+	++stats->write_stalls;
+	stats->write_stall_time += duration;
+
+	if (duration > stats->write_stall_time_max) {
+		stats->write_stall_time_max = duration;
+	}
+
+	return ret;
+}
+
+static bool rtems_jffs2_gc_task_should_work(
+	struct jffs2_sb_info *c,
+	uint32_t watermark
+)
+{
+	uint32_t dirty;
+
+	if (jffs2_thread_should_wake(c)) {
+		return true;
+	}
+
+	dirty = c->dirty_size + c->erasing_size - c->nr_erasing_blocks * c->sector_size;
+
+	return c->nr_free_blocks + c->nr_erasing_blocks < watermark &&
+		dirty > c->nospc_dirty_size;
+}
+
+static void rtems_jffs2_gc_task_work(struct super_block *sb)
+{
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	rtems_jffs2_gc_stats *stats = &sb->s_gc_stats;
+	uint32_t passes = 0;
+
+	rtems_jffs2_do_lock(sb);
+
+	if (rtems_jffs2_gc_task_should_work(c, sb->s_gc_low_watermark)) {
+		/*
+		 * Limit the passes per trigger, since the garbage collection may
+		 * not be able to satisfy the trigger conditions.
+		 */
+		while (
+			passes < c->nr_blocks &&
+			rtems_jffs2_gc_task_should_work(c, sb->s_gc_high_watermark)
+		) {
+			rtems_counter_ticks begin = rtems_counter_read();
+			int ret;
+
+			ret = jffs2_garbage_collect_pass(c);
+			++passes;
+			++stats->background_passes;
+			stats->background_time += rtems_jffs2_nanoseconds_since(begin);
+
+			if (ret != 0) {
+				break;
+			}
+
+			/* Let waiting writers in between the passes */
+			rtems_jffs2_do_unlock(sb);
+			rtems_jffs2_do_lock(sb);
+		}
+	}
+
+	rtems_jffs2_do_unlock(sb);
+}
+
+static rtems_task rtems_jffs2_gc_task(rtems_task_argument arg)
+{
+	struct super_block *sb = (struct super_block *) arg;
+
+	while (true) {
+		rtems_event_set events;
+
+		(void) rtems_event_receive(
+			RTEMS_JFFS2_GC_EVENT_TRIGGER | RTEMS_JFFS2_GC_EVENT_STOP,
+			RTEMS_EVENT_ANY | RTEMS_WAIT,
+			RTEMS_NO_TIMEOUT,
+			&events
+		);
+
+		if ((events & RTEMS_JFFS2_GC_EVENT_STOP) != 0) {
+			break;
+		}
+
+		rtems_jffs2_gc_task_work(sb);
+	}
+
+	(void) rtems_event_transient_send(sb->s_gc_task_stopper);
+	rtems_task_exit();
+}
+
+static int rtems_jffs2_create_gc_task(
+	struct super_block *sb,
+	const rtems_jffs2_mount_data *jffs2_mount_data,
+	rtems_id *gc_task
+)
+{
+	struct jffs2_sb_info *c = JFFS2_SB_INFO(sb);
+	rtems_status_code sc;
+	uint32_t low;
+	uint32_t high;
+
+	low = jffs2_mount_data->gc_free_blocks_low_watermark;
+	if (low == 0) {
+		low = c->resv_blocks_write + 1;
+	}
+
+	high = jffs2_mount_data->gc_free_blocks_high_watermark;
+	if (high < low) {
+		high = low;
+	}
+
+	sb->s_gc_low_watermark = low;
+	sb->s_gc_high_watermark = high;
+
+	sc = rtems_task_create(
+		rtems_build_name('J', 'F', 'G', 'C'),
+		jffs2_mount_data->gc_task_priority,
+		2 * RTEMS_MINIMUM_STACK_SIZE,
+		RTEMS_DEFAULT_MODES,
+		RTEMS_DEFAULT_ATTRIBUTES,
+		gc_task
+	);
+	if (sc != RTEMS_SUCCESSFUL) {
+		return -rtems_status_code_to_errno(sc);
+	}
+
+	return 0;
+}
+
+static void rtems_jffs2_stop_gc_task(struct super_block *sb)
+{
+	if (sb->s_gc_task != 0) {
+		rtems_id gc_task = sb->s_gc_task;
+
+		sb->s_gc_task = 0;
+		sb->s_gc_task_stopper = rtems_task_self();
+		(void) rtems_event_send(gc_task, RTEMS_JFFS2_GC_EVENT_STOP);
+		(void) rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+	}
+}
+
 int rtems_jffs2_initialize(
 	rtems_filesystem_mount_table_entry_t *mt_entry,
 	const void *data
@@ -1373,6 +1561,7 @@ int rtems_jffs2_initialize(
 		sizeof(*fs_info) + (size_t) inocache_hashsize * sizeof(fs_info->inode_cache[0])
 	);
 	bool do_mount_fs_was_successful = false;
+	rtems_id gc_task = 0;
 	struct super_block *sb;
 	struct jffs2_sb_info *c;
 	int err;
@@ -1426,6 +1615,7 @@ int rtems_jffs2_initialize(
 		sb->s_is_readonly = !mt_entry->writeable;
 		sb->s_flash_control = fc;
 		sb->s_compressor_control = jffs2_mount_data->compressor_control;
+		sb->s_summary = jffs2_mount_data->enable_summary;
 
 #ifdef CONFIG_JFFS2_FS_WRITEBUFFER
 		c->mtd = malloc(sizeof(struct mtd_info));
@@ -1458,6 +1648,12 @@ int rtems_jffs2_initialize(
 	if (err == 0) {
 		do_mount_fs_was_successful = true;
 
+		if (jffs2_mount_data->gc_task_priority != 0 && !jffs2_is_readonly(c)) {
+			err = rtems_jffs2_create_gc_task(sb, jffs2_mount_data, &gc_task);
+		}
+	}
+
+	if (err == 0) {
 		sb->s_root = jffs2_iget(sb, 1);
 		if (IS_ERR(sb->s_root)) {
 			err = PTR_ERR(sb->s_root);
@@ -1476,8 +1672,18 @@ int rtems_jffs2_initialize(
 		mt_entry->mt_fs_root->location.node_access = sb->s_root;
 		mt_entry->mt_fs_root->location.handlers = &rtems_jffs2_directory_handlers;
 
+		if (gc_task != 0) {
+			sb->s_gc_task = gc_task;
+			(void) rtems_task_start(gc_task, rtems_jffs2_gc_task, (rtems_task_argument) sb);
+			jffs2_garbage_collect_trigger(c);
+		}
+
 		return 0;
 	} else {
+		if (gc_task != 0) {
+			(void) rtems_task_delete(gc_task);
+		}
+
 		if (fs_info != NULL) {
 #ifdef CONFIG_JFFS2_FS_WRITEBUFFER
 			jffs2_remove_delayed_work(&c->wbuf_dwork);
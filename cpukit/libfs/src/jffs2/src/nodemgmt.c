@@ -166,7 +166,11 @@ int jffs2_reserve_space(struct jffs2_sb_info *c, uint32_t minsize,
 				  c->flash_size);
 			spin_unlock(&c->erase_completion_lock);
 
+#ifndef __rtems__
 			ret = jffs2_garbage_collect_pass(c);
+#else /* __rtems__ */
+			ret = jffs2_garbage_collect_pass_for_write(c);
+#endif /* __rtems__ */
 
 			if (ret == -EAGAIN) {
 				spin_lock(&c->erase_completion_lock);
@@ -108,10 +108,16 @@ struct super_block {
 	rtems_jffs2_flash_control	*s_flash_control;
 	rtems_jffs2_compressor_control	*s_compressor_control;
 	bool			s_is_readonly;
+	bool			s_summary;
 	unsigned char		s_gc_buffer[PAGE_CACHE_SIZE]; // Avoids malloc when user may be under memory pressure
 	rtems_recursive_mutex	s_mutex;
 	char			s_name_buf[JFFS2_MAX_NAME_LEN];
 	uint32_t		s_flags;
+	rtems_id		s_gc_task;
+	rtems_id		s_gc_task_stopper;
+	uint32_t		s_gc_low_watermark;
+	uint32_t		s_gc_high_watermark;
+	rtems_jffs2_gc_stats	s_gc_stats;
 };
 
 #define sleep_on_spinunlock(wq, sl) spin_unlock(sl)
@@ -124,17 +130,9 @@ static inline bool jffs2_is_readonly(struct jffs2_sb_info *c)
 	return sb->s_is_readonly;
 }
 
-static inline void jffs2_garbage_collect_trigger(struct jffs2_sb_info *c)
-{
-	const struct super_block *sb = OFNI_BS_2SFFJ(c);
-	rtems_jffs2_flash_control *fc = sb->s_flash_control;
-
-	if (fc->trigger_garbage_collection != NULL) {
-		(*fc->trigger_garbage_collection)(fc);
-	}
-}
-
 /* fs-rtems.c */
+void jffs2_garbage_collect_trigger(struct jffs2_sb_info *c);
+int jffs2_garbage_collect_pass_for_write(struct jffs2_sb_info *c);
 struct _inode *jffs2_new_inode (struct _inode *dir_i, int mode, struct jffs2_raw_inode *ri);
 struct _inode *jffs2_iget(struct super_block *sb, cyg_uint32 ino);
 void jffs2_iput(struct _inode * i);
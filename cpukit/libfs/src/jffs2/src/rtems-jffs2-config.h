@@ -35,3 +35,4 @@
 #define KBUILD_MODNAME "JFFS2"
 #define fallthrough __attribute__((__fallthrough__))
 #define CONFIG_JFFS2_FS_WRITEBUFFER
+#define CONFIG_JFFS2_SUMMARY
@@ -56,6 +56,9 @@ static rtems_mutex pipe_mutex = RTEMS_MUTEX_INITIALIZER("Pipes");
 #define PIPE_WAKEUPWRITERS(_pipe) \
   rtems_condition_variable_broadcast(&(_pipe)->writeBarrier)
 
+#define PIPE_IS_SPSC(_pipe) \
+  (_Atomic_Load_uint(&(_pipe)->Spsc, ATOMIC_ORDER_ACQUIRE) != 0)
+
 /*
  * Alloc pipe control structure, buffer, and resources.
  * Called with pipe_semaphore held.
@@ -83,6 +86,11 @@ static int pipe_alloc(
   rtems_condition_variable_init(&pipe->readBarrier, "Pipe Read");
   rtems_condition_variable_init(&pipe->writeBarrier, "Pipe Write");
   rtems_mutex_init(&pipe->Mutex, "Pipe");
+  _Atomic_Init_uint(&pipe->Spsc, 0);
+  _Atomic_Init_uint(&pipe->Head, 0);
+  _Atomic_Init_uint(&pipe->Tail, 0);
+  _Atomic_Init_uint(&pipe->spscWaitingReader, 0);
+  _Atomic_Init_uint(&pipe->spscWaitingWriter, 0);
 
   *pipep = pipe;
   if (c ++ == 'z')
@@ -210,6 +218,17 @@ int fifo_open(
     return err;
   pipe = *pipep;
 
+  if (PIPE_IS_SPSC(pipe)) {
+    uint32_t mode = LIBIO_ACCMODE(iop);
+
+    /* Only one reader and one writer may use a pipe in SPSC mode */
+    if (((mode & LIBIO_FLAGS_READ) != 0 && pipe->Readers > 0) ||
+        ((mode & LIBIO_FLAGS_WRITE) != 0 && pipe->Writers > 0)) {
+      PIPE_UNLOCK(pipe);
+      return -EBUSY;
+    }
+  }
+
   switch (LIBIO_ACCMODE(iop)) {
     case LIBIO_FLAGS_READ:
       pipe->readerCounter ++;
@@ -269,6 +288,168 @@ out_error:
   return err;
 }
 
+/*
+ * Lock-free transfer in SPSC mode.  The Head index is only written by the
+ * writer and the Tail index is only written by the reader.  Both indices run
+ * freely, the buffer size is a power of two.  A task which has to wait
+ * announces this through its waiting flag with the pipe mutex held and
+ * checks the indices again.  The peer tests the waiting flag after it moved
+ * its index and takes the pipe mutex only to wake up the waiting task.  Thus
+ * wake-ups happen only for transitions from empty or full.
+ */
+static ssize_t pipe_spsc_read(
+  pipe_control_t *pipe,
+  void           *buffer,
+  size_t          count,
+  rtems_libio_t  *iop
+)
+{
+  unsigned int head;
+  unsigned int tail;
+  unsigned int start;
+  size_t chunk;
+  size_t chunk1;
+
+  tail = _Atomic_Load_uint(&pipe->Tail, ATOMIC_ORDER_RELAXED);
+  head = _Atomic_Load_uint(&pipe->Head, ATOMIC_ORDER_ACQUIRE);
+
+  if (head == tail) {
+    PIPE_LOCK(pipe);
+
+    while (true) {
+      _Atomic_Store_uint(&pipe->spscWaitingReader, 1, ATOMIC_ORDER_RELAXED);
+      _Atomic_Fence(ATOMIC_ORDER_SEQ_CST);
+      head = _Atomic_Load_uint(&pipe->Head, ATOMIC_ORDER_ACQUIRE);
+
+      if (head != tail)
+        break;
+
+      /* Not an error */
+      if (pipe->Writers == 0 || LIBIO_NODELAY(iop)) {
+        _Atomic_Store_uint(&pipe->spscWaitingReader, 0, ATOMIC_ORDER_RELAXED);
+        PIPE_UNLOCK(pipe);
+        return pipe->Writers == 0 ? 0 : -EAGAIN;
+      }
+
+      /* Wait until pipe is no more empty or no writer exists */
+      PIPE_READWAIT(pipe);
+    }
+
+    _Atomic_Store_uint(&pipe->spscWaitingReader, 0, ATOMIC_ORDER_RELAXED);
+    PIPE_UNLOCK(pipe);
+  }
+
+  chunk = MIN(count, head - tail);
+  start = tail & (pipe->Size - 1);
+  chunk1 = pipe->Size - start;
+  if (chunk > chunk1) {
+    memcpy(buffer, pipe->Buffer + start, chunk1);
+    memcpy((char *) buffer + chunk1, pipe->Buffer, chunk - chunk1);
+  }
+  else
+    memcpy(buffer, pipe->Buffer + start, chunk);
+
+  _Atomic_Store_uint(&pipe->Tail, tail + chunk, ATOMIC_ORDER_RELEASE);
+  _Atomic_Fence(ATOMIC_ORDER_SEQ_CST);
+
+  if (_Atomic_Load_uint(&pipe->spscWaitingWriter, ATOMIC_ORDER_RELAXED) != 0) {
+    PIPE_LOCK(pipe);
+    PIPE_WAKEUPWRITERS(pipe);
+    PIPE_UNLOCK(pipe);
+  }
+
+  return chunk;
+}
+
+static ssize_t pipe_spsc_write(
+  pipe_control_t *pipe,
+  const void     *buffer,
+  size_t          count,
+  rtems_libio_t  *iop
+)
+{
+  size_t chunk, chunk1, written = 0;
+  ssize_t ret = 0;
+  unsigned int head;
+  unsigned int tail;
+  unsigned int start;
+
+  head = _Atomic_Load_uint(&pipe->Head, ATOMIC_ORDER_RELAXED);
+
+  /* Write of PIPE_BUF bytes or less shall not be partial */
+  chunk = count <= pipe->Size ? count : 1;
+
+  while (written < count) {
+    tail = _Atomic_Load_uint(&pipe->Tail, ATOMIC_ORDER_ACQUIRE);
+
+    if (pipe->Size - (head - tail) < chunk) {
+      PIPE_LOCK(pipe);
+
+      while (true) {
+        _Atomic_Store_uint(&pipe->spscWaitingWriter, 1, ATOMIC_ORDER_RELAXED);
+        _Atomic_Fence(ATOMIC_ORDER_SEQ_CST);
+        tail = _Atomic_Load_uint(&pipe->Tail, ATOMIC_ORDER_ACQUIRE);
+
+        if (pipe->Readers == 0) {
+          ret = -EPIPE;
+          break;
+        }
+
+        if (pipe->Size - (head - tail) >= chunk)
+          break;
+
+        if (LIBIO_NODELAY(iop)) {
+          ret = -EAGAIN;
+          break;
+        }
+
+        /* Wait until there is chunk bytes space or no reader exists */
+        PIPE_WRITEWAIT(pipe);
+      }
+
+      _Atomic_Store_uint(&pipe->spscWaitingWriter, 0, ATOMIC_ORDER_RELAXED);
+      PIPE_UNLOCK(pipe);
+
+      if (ret != 0)
+        break;
+    }
+
+    chunk = MIN(count - written, pipe->Size - (head - tail));
+    start = head & (pipe->Size - 1);
+    chunk1 = pipe->Size - start;
+    if (chunk > chunk1) {
+      memcpy(pipe->Buffer + start, (const char *) buffer + written, chunk1);
+      memcpy(pipe->Buffer, (const char *) buffer + written + chunk1,
+        chunk - chunk1);
+    }
+    else
+      memcpy(pipe->Buffer + start, (const char *) buffer + written, chunk);
+
+    head += chunk;
+    _Atomic_Store_uint(&pipe->Head, head, ATOMIC_ORDER_RELEASE);
+    _Atomic_Fence(ATOMIC_ORDER_SEQ_CST);
+
+    if (_Atomic_Load_uint(&pipe->spscWaitingReader, ATOMIC_ORDER_RELAXED) != 0) {
+      PIPE_LOCK(pipe);
+      PIPE_WAKEUPREADERS(pipe);
+      PIPE_UNLOCK(pipe);
+    }
+
+    written += chunk;
+    chunk = 1;
+  }
+
+#ifdef RTEMS_POSIX_API
+  /* Signal SIGPIPE */
+  if (ret == -EPIPE)
+    kill(getpid(), SIGPIPE);
+#endif
+
+  if (written > 0)
+    return written;
+  return ret;
+}
+
 ssize_t pipe_read(
   pipe_control_t *pipe,
   void           *buffer,
@@ -281,8 +462,17 @@ ssize_t pipe_read(
   if (!pipe)
     return -EPIPE;
 
+  if (PIPE_IS_SPSC(pipe))
+    return pipe_spsc_read(pipe, buffer, count, iop);
+
   PIPE_LOCK(pipe);
 
+  /* The peer may have enabled the SPSC mode in the meantime */
+  if (PIPE_IS_SPSC(pipe)) {
+    PIPE_UNLOCK(pipe);
+    return pipe_spsc_read(pipe, buffer, count, iop);
+  }
+
   while (PIPE_EMPTY(pipe)) {
     /* Not an error */
     if (pipe->Writers == 0)
@@ -344,8 +534,17 @@ ssize_t pipe_write(
   if (count == 0)
     return 0;
 
+  if (PIPE_IS_SPSC(pipe))
+    return pipe_spsc_write(pipe, buffer, count, iop);
+
   PIPE_LOCK(pipe);
 
+  /* The peer may have enabled the SPSC mode in the meantime */
+  if (PIPE_IS_SPSC(pipe)) {
+    PIPE_UNLOCK(pipe);
+    return pipe_spsc_write(pipe, buffer, count, iop);
+  }
+
   if (pipe->Readers == 0) {
     ret = -EPIPE;
     goto out_locked;
@@ -403,6 +602,74 @@ out_locked:
   return ret;
 }
 
+static int pipe_set_buffer_size(
+  pipe_control_t *pipe,
+  unsigned int    size
+)
+{
+  unsigned int new_size;
+  char *new_buffer;
+  int err = 0;
+
+  if (size > PIPE_BUFFER_SIZE_MAX)
+    return -EINVAL;
+
+  /* The SPSC mode uses free-running indices and needs a power of two */
+  new_size = PIPE_BUF;
+  while (new_size < size)
+    new_size <<= 1;
+
+  new_buffer = malloc(new_size);
+  if (new_buffer == NULL)
+    return -ENOMEM;
+
+  PIPE_LOCK(pipe);
+
+  if (PIPE_IS_SPSC(pipe) || !PIPE_EMPTY(pipe) || pipe->waitingWriters > 0) {
+    err = -EBUSY;
+  } else {
+    char *old_buffer = pipe->Buffer;
+
+    pipe->Buffer = new_buffer;
+    pipe->Size = new_size;
+    pipe->Start = 0;
+    new_buffer = old_buffer;
+  }
+
+  PIPE_UNLOCK(pipe);
+
+  free(new_buffer);
+  return err;
+}
+
+static int pipe_enable_spsc(
+  pipe_control_t *pipe
+)
+{
+  int err = 0;
+
+  PIPE_LOCK(pipe);
+
+  if (PIPE_IS_SPSC(pipe)) {
+    /* Nothing to do */
+  } else if (pipe->Readers > 1 || pipe->Writers > 1 ||
+      pipe->waitingReaders > 0 || pipe->waitingWriters > 0) {
+    err = -EBUSY;
+  } else {
+    _Assert((pipe->Size & (pipe->Size - 1)) == 0);
+    _Atomic_Store_uint(&pipe->Tail, pipe->Start, ATOMIC_ORDER_RELAXED);
+    _Atomic_Store_uint(
+      &pipe->Head,
+      pipe->Start + pipe->Length,
+      ATOMIC_ORDER_RELAXED
+    );
+    _Atomic_Store_uint(&pipe->Spsc, 1, ATOMIC_ORDER_RELEASE);
+  }
+
+  PIPE_UNLOCK(pipe);
+  return err;
+}
+
 int pipe_ioctl(
   pipe_control_t  *pipe,
   ioctl_command_t  cmd,
@@ -421,10 +688,38 @@ int pipe_ioctl(
     PIPE_LOCK(pipe);
 
     /* Return length of pipe */
-    *(unsigned int *)buffer = pipe->Length;
+    if (PIPE_IS_SPSC(pipe))
+      *(unsigned int *)buffer =
+        _Atomic_Load_uint(&pipe->Head, ATOMIC_ORDER_ACQUIRE) -
+        _Atomic_Load_uint(&pipe->Tail, ATOMIC_ORDER_ACQUIRE);
+    else
+      *(unsigned int *)buffer = pipe->Length;
     PIPE_UNLOCK(pipe);
     return 0;
   }
 
+  switch (cmd) {
+    case PIPE_SET_BUFFER_SIZE:
+      if (buffer == NULL)
+        return -EFAULT;
+
+      return pipe_set_buffer_size(pipe, *(unsigned int *)buffer);
+
+    case PIPE_GET_BUFFER_SIZE:
+      if (buffer == NULL)
+        return -EFAULT;
+
+      PIPE_LOCK(pipe);
+      *(unsigned int *)buffer = pipe->Size;
+      PIPE_UNLOCK(pipe);
+      return 0;
+
+    case PIPE_ENABLE_SPSC:
+      return pipe_enable_spsc(pipe);
+
+    default:
+      break;
+  }
+
   return -EINVAL;
 }
@@ -51,6 +51,7 @@
 #include <stdio.h>
 #endif
 #include <stdlib.h>
+#include <sys/param.h>
 #include <rtems/rfs/rtems-rfs-bitmaps.h>
 
 #define rtems_rfs_bitmap_check(_c, _sm) \
@@ -139,6 +140,23 @@ rtems_rfs_bitmap_match (rtems_rfs_bitmap_element bits1,
   return bits1 ^ bits2 ? false : true;
 }
 
+/**
+ * Return the clear bits of an element as a mask. A mask always has a 1 for set
+ * so the clear bits of the element are the set bits of the mask.
+ *
+ * @param target The element.
+ * @return rtems_rfs_bitmap_element The mask of the clear bits.
+ */
+static rtems_rfs_bitmap_element
+rtems_rfs_bitmap_clear_bits (rtems_rfs_bitmap_element target)
+{
+#if RTEMS_RFS_BITMAP_CLEAR_ZERO
+  return RTEMS_RFS_BITMAP_INVERT_MASK (target);
+#else
+  return target;
+#endif
+}
+
 #if RTEMS_NOT_USED_BUT_KEPT
 /**
  * Match the bits of 2 elements within the mask and return true if they match
@@ -608,6 +626,224 @@ rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
   return 0;
 }
 
+/**
+ * Find the first clear bit from the bit up to but not including the end bit.
+ * Elements with no clear bits are skipped using the search map and the
+ * elements are tested a word at a time.
+ *
+ * @param control The bitmap control.
+ * @param map The bitmap map data.
+ * @param bit The bit to start the search at.
+ * @param end The bit to end the search at.
+ * @return rtems_rfs_bitmap_bit The clear bit or the end bit if not found.
+ */
+static rtems_rfs_bitmap_bit
+rtems_rfs_bitmap_find_clear (rtems_rfs_bitmap_control* control,
+                             rtems_rfs_bitmap_map      map,
+                             rtems_rfs_bitmap_bit      bit,
+                             rtems_rfs_bitmap_bit      end)
+{
+  while (bit < end)
+  {
+    int                      index = rtems_rfs_bitmap_map_index (bit);
+    int                      search_index = rtems_rfs_bitmap_map_index (index);
+    rtems_rfs_bitmap_element search_bits = control->search_bits[search_index];
+    rtems_rfs_bitmap_element clear;
+
+    if (rtems_rfs_bitmap_match (search_bits, RTEMS_RFS_BITMAP_ELEMENT_SET))
+    {
+      bit = (search_index + 1) * rtems_rfs_bitmap_search_element_bits ();
+      continue;
+    }
+
+    if (rtems_rfs_bitmap_test (search_bits,
+                               rtems_rfs_bitmap_map_offset (index)))
+    {
+      bit = (index + 1) * rtems_rfs_bitmap_element_bits ();
+      continue;
+    }
+
+    clear = rtems_rfs_bitmap_clear_bits (map[index]) &
+      (RTEMS_RFS_BITMAP_ELEMENT_FULL_MASK << rtems_rfs_bitmap_map_offset (bit));
+
+    if (clear)
+    {
+      bit = (index * rtems_rfs_bitmap_element_bits ()) + __builtin_ctz (clear);
+      return bit < end ? bit : end;
+    }
+
+    bit = (index + 1) * rtems_rfs_bitmap_element_bits ();
+  }
+
+  return end;
+}
+
+/**
+ * Count the clear bits from the bit up to a maximum number of bits.
+ *
+ * @param map The bitmap map data.
+ * @param bit The first bit, which is clear.
+ * @param max The maximum number of bits to count.
+ * @return size_t The number of consecutive clear bits.
+ */
+static size_t
+rtems_rfs_bitmap_clear_run (rtems_rfs_bitmap_map map,
+                            rtems_rfs_bitmap_bit bit,
+                            size_t               max)
+{
+  size_t run = 0;
+
+  while (run < max)
+  {
+    int                      index = rtems_rfs_bitmap_map_index (bit + run);
+    int                      offset = rtems_rfs_bitmap_map_offset (bit + run);
+    rtems_rfs_bitmap_element set;
+
+    set = RTEMS_RFS_BITMAP_INVERT_MASK (rtems_rfs_bitmap_clear_bits (map[index]))
+      & (RTEMS_RFS_BITMAP_ELEMENT_FULL_MASK << offset);
+
+    if (set)
+    {
+      run += __builtin_ctz (set) - offset;
+      break;
+    }
+
+    run += rtems_rfs_bitmap_element_bits () - offset;
+  }
+
+  return run < max ? run : max;
+}
+
+/**
+ * Set a run of clear bits and update the search map.
+ *
+ * @param control The bitmap control.
+ * @param map The bitmap map data.
+ * @param bit The first bit to set.
+ * @param count The number of bits to set.
+ */
+static void
+rtems_rfs_bitmap_set_run (rtems_rfs_bitmap_control* control,
+                          rtems_rfs_bitmap_map      map,
+                          rtems_rfs_bitmap_bit      bit,
+                          size_t                    count)
+{
+  control->free -= count;
+
+  while (count)
+  {
+    int    index = rtems_rfs_bitmap_map_index (bit);
+    int    offset = rtems_rfs_bitmap_map_offset (bit);
+    size_t bits = rtems_rfs_bitmap_element_bits () - offset;
+
+    if (bits > count)
+      bits = count;
+
+    map[index] = rtems_rfs_bitmap_set (map[index],
+                                       rtems_rfs_bitmap_mask_section (offset,
+                                                                      offset + bits));
+
+    if (rtems_rfs_bitmap_match (map[index], RTEMS_RFS_BITMAP_ELEMENT_SET))
+    {
+      rtems_rfs_bitmap_element* search_bits;
+      search_bits = &control->search_bits[rtems_rfs_bitmap_map_index (index)];
+      rtems_rfs_bitmap_check (control, search_bits);
+      *search_bits = rtems_rfs_bitmap_set (*search_bits,
+                                           1 << rtems_rfs_bitmap_map_offset (index));
+    }
+
+    bit   += bits;
+    count -= bits;
+  }
+
+  rtems_rfs_buffer_mark_dirty (control->buffer);
+}
+
+int
+rtems_rfs_bitmap_map_alloc_extent (rtems_rfs_bitmap_control* control,
+                                   rtems_rfs_bitmap_bit      seed,
+                                   size_t                    count,
+                                   rtems_rfs_bitmap_bit*     bit,
+                                   size_t*                   allocated)
+{
+  rtems_rfs_bitmap_map map;
+  rtems_rfs_bitmap_bit start;
+  rtems_rfs_bitmap_bit end;
+  rtems_rfs_bitmap_bit first = 0;
+  size_t               first_run = 0;
+  int                  pass;
+  int                  rc;
+
+  *allocated = 0;
+
+  if (count == 0)
+    return 0;
+
+  rc = rtems_rfs_bitmap_load_map (control, &map);
+  if (rc > 0)
+    return rc;
+
+  if ((seed < 0) || (seed >= control->size))
+    seed = 0;
+
+  /*
+   * Search up from the seed to the end of the map then from the start of the
+   * map to the seed. The first run of clear bits is taken if it starts at the
+   * seed or is long enough. Otherwise the search continues for a window of
+   * bits for a long enough run and takes the first run if none is found.
+   */
+  start = seed;
+  end = control->size;
+
+  for (pass = 0; pass < 2; pass++)
+  {
+    while (start < end)
+    {
+      size_t run;
+
+      start = rtems_rfs_bitmap_find_clear (control, map, start, end);
+      if (start >= end)
+        break;
+
+      run = rtems_rfs_bitmap_clear_run (map, start, MIN (count, end - start));
+
+      if (first_run == 0)
+      {
+        first = start;
+        first_run = run;
+        if ((run == count) || (start == seed))
+          break;
+      }
+      else if (run == count)
+      {
+        first = start;
+        first_run = run;
+        break;
+      }
+
+      if ((start - first) >= RTEMS_RFS_BITMAP_SEARCH_WINDOW)
+        break;
+
+      start += run;
+    }
+
+    if (first_run)
+      break;
+
+    start = 0;
+    end = seed;
+  }
+
+  if (first_run)
+  {
+    rtems_rfs_bitmap_set_run (control, map, first, first_run);
+    *bit = first;
+    *allocated = first_run;
+  }
+
+  return 0;
+}
+
 int
 rtems_rfs_bitmap_create_search (rtems_rfs_bitmap_control* control)
 {
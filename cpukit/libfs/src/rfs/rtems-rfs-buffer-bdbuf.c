@@ -109,4 +109,27 @@ rtems_rfs_buffer_bdbuf_release (rtems_rfs_buffer* buffer,
   return rc;
 }
 
+int
+rtems_rfs_buffer_bdbuf_read_blocks (rtems_rfs_file_system* fs,
+                                    rtems_rfs_buffer_block block,
+                                    size_t                 count,
+                                    void*                  data)
+{
+  rtems_status_code sc;
+  int               rc = 0;
+
+  sc = rtems_bdbuf_read_blocks (rtems_rfs_fs_device (fs), block, count, data);
+
+  if (sc != RTEMS_SUCCESSFUL)
+  {
+#if RTEMS_RFS_BUFFER_ERRORS
+    printf ("rtems-rfs: buffer-bdbuf-read-blocks: block=%lu count=%zu: %d: %s\n",
+            block, count, sc, rtems_status_text (sc));
+#endif
+    rc = EIO;
+  }
+
+  return rc;
+}
+
 #endif
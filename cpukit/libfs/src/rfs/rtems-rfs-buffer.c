@@ -41,57 +41,285 @@
 #include <inttypes.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <rtems/rfs/rtems-rfs-buffer.h>
 #include <rtems/rfs/rtems-rfs-file-system.h>
 
 /**
- * Scan the chain for a buffer that matches the block number.
+ * Return the first index entry to probe for a block.
  *
- * @param chain The chain to scan.
- * @param count The number of items on the chain.
+ * @param fs The file system data.
+ * @param block The block number.
+ * @return uint32_t The index entry.
+ */
+static uint32_t
+rtems_rfs_buffer_index_hash (rtems_rfs_file_system* fs,
+                             rtems_rfs_buffer_block block)
+{
+  uint32_t hash = ((uint32_t) block) * UINT32_C (0x9e3779b1);
+  return (hash ^ (hash >> 16)) & (fs->buffer_index_size - 1);
+}
+
+/**
+ * Find the index entry of a block.
+ *
+ * @param fs The file system data.
+ * @param block The block number to find.
+ * @return rtems_rfs_buffer_index_entry* The entry if found else NULL.
+ */
+static rtems_rfs_buffer_index_entry*
+rtems_rfs_buffer_index_find (rtems_rfs_file_system* fs,
+                             rtems_rfs_buffer_block block)
+{
+  uint32_t slot;
+
+  if (fs->buffer_index_count == 0)
+    return NULL;
+
+  slot = rtems_rfs_buffer_index_hash (fs, block);
+
+  while (fs->buffer_index[slot].buffer)
+  {
+    if (fs->buffer_index[slot].block == block)
+      return &fs->buffer_index[slot];
+    slot = (slot + 1) & (fs->buffer_index_size - 1);
+  }
+
+  return NULL;
+}
+
+/**
+ * Place an entry in the index. There must be a free entry.
+ *
+ * @param fs The file system data.
+ * @param entry The entry to place.
+ * @return rtems_rfs_buffer_index_entry* The entry in the index.
+ */
+static rtems_rfs_buffer_index_entry*
+rtems_rfs_buffer_index_place (rtems_rfs_file_system*              fs,
+                              const rtems_rfs_buffer_index_entry* entry)
+{
+  uint32_t slot;
+
+  slot = rtems_rfs_buffer_index_hash (fs, entry->block);
+
+  while (fs->buffer_index[slot].buffer)
+    slot = (slot + 1) & (fs->buffer_index_size - 1);
+
+  fs->buffer_index[slot] = *entry;
+  return &fs->buffer_index[slot];
+}
+
+/**
+ * Resize the index.
+ *
+ * @param fs The file system data.
+ * @param size The new number of entries. Must be a power of 2.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_buffer_index_resize (rtems_rfs_file_system* fs, uint32_t size)
+{
+  rtems_rfs_buffer_index_entry* index = fs->buffer_index;
+  uint32_t                      index_size = fs->buffer_index_size;
+  uint32_t                      slot;
+
+  fs->buffer_index = calloc (size, sizeof (rtems_rfs_buffer_index_entry));
+  if (!fs->buffer_index)
+  {
+    fs->buffer_index = index;
+    return ENOMEM;
+  }
+
+  fs->buffer_index_size = size;
+
+  for (slot = 0; slot < index_size; slot++)
+    if (index[slot].buffer)
+      rtems_rfs_buffer_index_place (fs, &index[slot]);
+
+  free (index);
+  return 0;
+}
+
+/**
+ * Add a buffer to the index. The index is kept at most half full. If the
+ * index cannot grow it is used until it is full.
+ *
+ * @param fs The file system data.
+ * @param buffer The buffer to add.
+ * @param block The block number of the buffer.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_buffer_index_insert (rtems_rfs_file_system* fs,
+                               rtems_rfs_buffer*      buffer,
+                               rtems_rfs_buffer_block block)
+{
+  rtems_rfs_buffer_index_entry entry;
+
+  if (((fs->buffer_index_count + 1) * 2) > fs->buffer_index_size)
+  {
+    uint32_t size = fs->buffer_index_size;
+    int      rc;
+
+    if (size == 0)
+    {
+      size = RTEMS_RFS_BUFFER_INDEX_MIN_SIZE;
+      while (size < (fs->max_held_buffers * 2))
+        size *= 2;
+    }
+    else
+      size *= 2;
+
+    rc = rtems_rfs_buffer_index_resize (fs, size);
+    if ((rc > 0) && ((fs->buffer_index_count + 1) >= fs->buffer_index_size))
+      return rc;
+  }
+
+  entry.buffer = buffer;
+  entry.block = block;
+  entry.released = 0;
+  entry.modified = false;
+
+  rtems_rfs_buffer_index_place (fs, &entry);
+  fs->buffer_index_count++;
+  return 0;
+}
+
+/**
+ * Remove a block from the index. The entries that follow in the probe
+ * sequence are moved back so the index does not need deleted markers.
+ *
+ * @param fs The file system data.
+ * @param block The block number to remove.
+ */
+static void
+rtems_rfs_buffer_index_remove (rtems_rfs_file_system* fs,
+                               rtems_rfs_buffer_block block)
+{
+  rtems_rfs_buffer_index_entry* entry;
+  uint32_t                      mask = fs->buffer_index_size - 1;
+  uint32_t                      hole;
+  uint32_t                      slot;
+
+  entry = rtems_rfs_buffer_index_find (fs, block);
+  if (!entry)
+    return;
+
+  hole = entry - fs->buffer_index;
+  slot = (hole + 1) & mask;
+
+  while (fs->buffer_index[slot].buffer)
+  {
+    uint32_t home = rtems_rfs_buffer_index_hash (fs,
+                                                 fs->buffer_index[slot].block);
+
+    /*
+     * Move the entry into the hole if the hole is between the entry's home
+     * and the entry in the probe sequence.
+     */
+    if (((slot - home) & mask) >= ((slot - hole) & mask))
+    {
+      fs->buffer_index[hole] = fs->buffer_index[slot];
+      hole = slot;
+    }
+
+    slot = (slot + 1) & mask;
+  }
+
+  fs->buffer_index[hole].buffer = NULL;
+  fs->buffer_index_count--;
+}
+
+/**
+ * Find a buffer of the block held by a handle or in the local cache of
+ * released buffers.
+ *
+ * @param fs The file system data.
  * @param block The block number to find.
  * @return  rtems_rfs_buffer* The buffer if found else NULL.
  */
 static rtems_rfs_buffer*
-rtems_rfs_scan_chain (rtems_chain_control*   chain,
-                      uint32_t*              count,
-                      rtems_rfs_buffer_block block)
+rtems_rfs_buffer_find_held (rtems_rfs_file_system* fs,
+                            rtems_rfs_buffer_block block)
 {
-  rtems_rfs_buffer* buffer;
-  rtems_chain_node* node;
+  rtems_rfs_buffer_index_entry* entry;
 
-  node = rtems_chain_last (chain);
+  entry = rtems_rfs_buffer_index_find (fs, block);
 
-  if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_CHAINS))
-    printf ("rtems-rfs: buffer-scan: count=%" PRIu32 ", block=%" PRIu32 ": ", *count, block);
+  return entry ? entry->buffer : NULL;
+}
 
-  while (!rtems_chain_is_head (chain, node))
+int
+rtems_rfs_buffer_read_blocks (rtems_rfs_file_system* fs,
+                              rtems_rfs_buffer_block block,
+                              size_t                 count,
+                              void*                  data)
+{
+  size_t   block_size = rtems_rfs_fs_block_size (fs);
+  uint8_t* dest = data;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
+    printf ("rtems-rfs: buffer-read-blocks: block=%" PRIu32 " count=%zu\n",
+            block, count);
+
+  while (count)
   {
-    buffer = (rtems_rfs_buffer*) node;
+    rtems_rfs_buffer* buffer = NULL;
+    size_t            run = 0;
+    int               rc;
 
-    if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_CHAINS))
-      printf ("%" PRIiPTR " ", ((intptr_t) buffer->user));
+    /*
+     * The held buffers cannot be read through the I/O layer as they are with
+     * us and may have been modified.
+     */
+    while (run < count)
+    {
+      buffer = rtems_rfs_buffer_find_held (fs, block + run);
+      if (buffer)
+        break;
+      run++;
+    }
 
-    if (((rtems_rfs_buffer_block) ((intptr_t)(buffer->user))) == block)
+    if (run)
     {
-      if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_CHAINS))
-        printf (": found block=%" PRIiPTR "\n",
-                ((intptr_t)(buffer->user)));
-
-      (*count)--;
-      rtems_chain_extract_unprotected (node);
-      rtems_chain_set_off_chain (node);
-      return buffer;
+#if RTEMS_RFS_USE_LIBBLOCK
+      rc = rtems_rfs_buffer_io_read_blocks (fs, block, run, dest);
+      if (rc > 0)
+        return rc;
+#else
+      size_t b;
+
+      for (b = 0; b < run; b++)
+      {
+        rtems_rfs_buffer* io_buffer;
+
+        rc = rtems_rfs_buffer_io_request (fs, block + b, true, &io_buffer);
+        if (rc > 0)
+          return rc;
+
+        memcpy (dest + (b * block_size), io_buffer->buffer, block_size);
+
+        rc = rtems_rfs_buffer_io_release (io_buffer, false);
+        if (rc > 0)
+          return rc;
+      }
+#endif
+    }
+    else
+    {
+      memcpy (dest, buffer->buffer, block_size);
+      run = 1;
     }
-    node = rtems_chain_previous (node);
-  }
 
-  if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_CHAINS))
-    printf (": not found\n");
+    block += run;
+    count -= run;
+    dest  += run * block_size;
+  }
 
-  return NULL;
+  return 0;
 }
 
 int
@@ -100,7 +328,8 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
                                  rtems_rfs_buffer_block   block,
                                  bool                     read)
 {
-  int rc;
+  rtems_rfs_buffer_index_entry* entry;
+  int                           rc;
 
   /*
    * If the handle has a buffer release it. This allows a handle to be reused
@@ -134,49 +363,35 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
    * be shared where different parts of the block have separate functions. An
    * example is an inode block and the file system needs to handle 2 inodes in
    * the same block at the same time.
+   *
+   * If the buffer is not attached to a handle it can be in the local cache of
+   * released buffers. There are release and released modified lists to
+   * preserve the state.
    */
-  if (fs->buffers_count)
-  {
-    /*
-     * Check the active buffer list for shared buffers.
-     */
-    handle->buffer = rtems_rfs_scan_chain (&fs->buffers,
-                                           &fs->buffers_count,
-                                           block);
-    if (rtems_rfs_buffer_handle_has_block (handle) &&
-        rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
-      printf ("rtems-rfs: buffer-request: buffer shared: refs: %d\n",
-              rtems_rfs_buffer_refs (handle) + 1);
-  }
-
-  /*
-   * If the buffer has not been found check the local cache of released
-   * buffers. There are release and released modified lists to preserve the
-   * state.
-   */
-  if (!rtems_rfs_fs_no_local_cache (fs) &&
-      !rtems_rfs_buffer_handle_has_block (handle))
+  entry = rtems_rfs_buffer_index_find (fs, block);
+  if (entry)
   {
-    /*
-     * Check the local cache of released buffers.
-     */
-    if (fs->release_count)
-      handle->buffer = rtems_rfs_scan_chain (&fs->release,
-                                             &fs->release_count,
-                                             block);
+    handle->buffer = entry->buffer;
+    rtems_chain_extract_unprotected (rtems_rfs_buffer_link (handle));
+    rtems_chain_set_off_chain (rtems_rfs_buffer_link (handle));
 
-    if (!rtems_rfs_buffer_handle_has_block (handle) &&
-        fs->release_modified_count)
+    if (rtems_rfs_buffer_refs (handle) > 0)
     {
-      handle->buffer = rtems_rfs_scan_chain (&fs->release_modified,
-                                             &fs->release_modified_count,
-                                             block);
+      fs->buffers_count--;
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
+        printf ("rtems-rfs: buffer-request: buffer shared: refs: %d\n",
+                rtems_rfs_buffer_refs (handle) + 1);
+    }
+    else if (entry->modified)
+    {
+      fs->release_modified_count--;
       /*
        * If we found a buffer retain the dirty buffer state.
        */
-      if (rtems_rfs_buffer_handle_has_block (handle))
-        rtems_rfs_buffer_mark_dirty (handle);
+      rtems_rfs_buffer_mark_dirty (handle);
     }
+    else
+      fs->release_count--;
   }
 
   /*
@@ -194,6 +409,14 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
       return rc;
     }
 
+    rc = rtems_rfs_buffer_index_insert (fs, handle->buffer, block);
+    if (rc > 0)
+    {
+      rtems_rfs_buffer_io_release (handle->buffer, false);
+      handle->buffer = NULL;
+      return rc;
+    }
+
     rtems_chain_set_off_chain (rtems_rfs_buffer_link(handle));
   }
 
@@ -216,6 +439,37 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
   return 0;
 }
 
+/**
+ * Is the least recently used buffer of the local cache on the release
+ * modified list ? The local cache must not be empty.
+ *
+ * @param fs The file system data.
+ * @return bool True if the buffer is on the release modified list.
+ */
+static bool
+rtems_rfs_buffer_release_lru_modified (rtems_rfs_file_system* fs)
+{
+  rtems_rfs_buffer*             clean;
+  rtems_rfs_buffer*             modified;
+  rtems_rfs_buffer_index_entry* clean_entry;
+  rtems_rfs_buffer_index_entry* modified_entry;
+
+  if (rtems_chain_is_empty (&fs->release))
+    return true;
+  if (rtems_chain_is_empty (&fs->release_modified))
+    return false;
+
+  clean = (rtems_rfs_buffer*) rtems_chain_first (&fs->release);
+  modified = (rtems_rfs_buffer*) rtems_chain_first (&fs->release_modified);
+
+  clean_entry = rtems_rfs_buffer_index_find (
+    fs, (rtems_rfs_buffer_block) ((intptr_t) clean->user));
+  modified_entry = rtems_rfs_buffer_index_find (
+    fs, (rtems_rfs_buffer_block) ((intptr_t) modified->user));
+
+  return ((int32_t) (modified_entry->released - clean_entry->released)) < 0;
+}
+
 int
 rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
                                  rtems_rfs_buffer_handle* handle)
@@ -241,17 +495,20 @@ rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
 
       if (rtems_rfs_fs_no_local_cache (fs))
       {
+        rtems_rfs_buffer_index_remove (fs, rtems_rfs_buffer_bnum (handle));
         handle->buffer->user = (void*) 0;
         rc = rtems_rfs_buffer_io_release (handle->buffer,
                                           rtems_rfs_buffer_dirty (handle));
       }
       else
       {
+        rtems_rfs_buffer_index_entry* entry;
+
         /*
          * If the total number of held buffers is higher than the configured
-         * value remove a buffer from the queue with the most buffers and
-         * release. The buffers are held on the queues with the newest at the
-         * head.
+         * value release the least recently used buffer. The buffers are held
+         * on the queues with the oldest at the head so the least recently
+         * used buffer is the older of the two heads.
          *
          * This code stops a large series of transactions causing all the
          * buffers in the cache being held in queues of this file system.
@@ -266,24 +523,29 @@ rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
             printf ("rtems-rfs: buffer-release: local cache overflow:"
                     " %" PRIu32 "\n", fs->release_count + fs->release_modified_count);
 
-          if (fs->release_count > fs->release_modified_count)
+          modified = rtems_rfs_buffer_release_lru_modified (fs);
+          if (!modified)
           {
             buffer = (rtems_rfs_buffer*)
               rtems_chain_get_unprotected (&fs->release);
             fs->release_count--;
-            modified = false;
           }
           else
           {
             buffer = (rtems_rfs_buffer*)
               rtems_chain_get_unprotected (&fs->release_modified);
             fs->release_modified_count--;
-            modified = true;
           }
+          rtems_rfs_buffer_index_remove (fs, (rtems_rfs_buffer_block)
+                                         ((intptr_t) buffer->user));
           buffer->user = (void*) 0;
           rc = rtems_rfs_buffer_io_release (buffer, modified);
         }
 
+        entry = rtems_rfs_buffer_index_find (fs, rtems_rfs_buffer_bnum (handle));
+        entry->modified = rtems_rfs_buffer_dirty (handle);
+        entry->released = ++fs->buffer_release_seq;
+
         if (rtems_rfs_buffer_dirty (handle))
         {
           rtems_chain_append_unprotected (&fs->release_modified,
@@ -383,6 +645,11 @@ rtems_rfs_buffer_close (rtems_rfs_file_system* fs)
     printf ("rtems-rfs: buffer-close: set media block size failed: %d: %s\n",
             rc, strerror (rc));
 
+  free (fs->buffer_index);
+  fs->buffer_index = NULL;
+  fs->buffer_index_size = 0;
+  fs->buffer_index_count = 0;
+
   if (close (fs->device) < 0)
   {
     rc = errno;
@@ -456,9 +723,10 @@ rtems_rfs_buffer_setblksize (rtems_rfs_file_system* fs, uint32_t size)
 }
 
 static int
-rtems_rfs_release_chain (rtems_chain_control* chain,
-                         uint32_t*            count,
-                         bool                 modified)
+rtems_rfs_release_chain (rtems_rfs_file_system* fs,
+                         rtems_chain_control*   chain,
+                         uint32_t*              count,
+                         bool                   modified)
 {
   rtems_rfs_buffer* buffer;
   int               rrc = 0;
@@ -472,6 +740,8 @@ rtems_rfs_release_chain (rtems_chain_control* chain,
     buffer = (rtems_rfs_buffer*) rtems_chain_get_unprotected (chain);
     (*count)--;
 
+    rtems_rfs_buffer_index_remove (fs, (rtems_rfs_buffer_block)
+                                   ((intptr_t) buffer->user));
     buffer->user = (void*) 0;
 
     rc = rtems_rfs_buffer_io_release (buffer, modified);
@@ -492,12 +762,12 @@ rtems_rfs_buffers_release (rtems_rfs_file_system* fs)
             "release:%" PRIu32 " release-modified:%" PRIu32 "\n",
             fs->buffers_count, fs->release_count, fs->release_modified_count);
 
-  rc = rtems_rfs_release_chain (&fs->release,
+  rc = rtems_rfs_release_chain (fs, &fs->release,
                                 &fs->release_count,
                                 false);
   if ((rc > 0) && (rrc == 0))
     rrc = rc;
-  rc = rtems_rfs_release_chain (&fs->release_modified,
+  rc = rtems_rfs_release_chain (fs, &fs->release_modified,
                                 &fs->release_modified_count,
                                 true);
   if ((rc > 0) && (rrc == 0))
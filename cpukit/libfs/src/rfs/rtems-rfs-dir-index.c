@@ -0,0 +1,489 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup rtems_rfs
+ *
+ * @brief RTEMS File Systems Directory Index Routines
+ *
+ * These functions manage the in-memory index of large directories. The index
+ * is a hash table of the directory entries keyed by the hash held in each
+ * entry. An index entry holds the block in the directory of the entry and not
+ * the offset in the block because removing an entry compacts the block and
+ * moves the entries that follow.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/rfs/rtems-rfs-buffer.h>
+#include <rtems/rfs/rtems-rfs-dir.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
+
+/**
+ * Return the bucket of a hash.
+ */
+#define rtems_rfs_dir_index_bucket(_i, _h) ((_h) & ((_i)->bucket_count - 1))
+
+static void
+rtems_rfs_dir_index_destroy (rtems_rfs_dir_index* index)
+{
+  free (index->buckets);
+  free (index->entries);
+  free (index->block_free);
+  free (index);
+}
+
+static int
+rtems_rfs_dir_index_rehash (rtems_rfs_dir_index* index)
+{
+  uint32_t* buckets;
+  uint32_t  bucket_count;
+  uint32_t  b;
+
+  bucket_count = index->bucket_count * 2;
+  buckets = malloc (bucket_count * sizeof (uint32_t));
+  if (!buckets)
+    return ENOMEM;
+
+  for (b = 0; b < bucket_count; b++)
+    buckets[b] = RTEMS_RFS_DIR_INDEX_NONE;
+
+  for (b = 0; b < index->bucket_count; b++)
+  {
+    uint32_t slot = index->buckets[b];
+    while (slot != RTEMS_RFS_DIR_INDEX_NONE)
+    {
+      rtems_rfs_dir_index_entry* entry = &index->entries[slot];
+      uint32_t                   next = entry->next;
+      uint32_t                   bucket;
+      bucket = entry->hash & (bucket_count - 1);
+      entry->next = buckets[bucket];
+      buckets[bucket] = slot;
+      slot = next;
+    }
+  }
+
+  free (index->buckets);
+  index->buckets = buckets;
+  index->bucket_count = bucket_count;
+  return 0;
+}
+
+static int
+rtems_rfs_dir_index_grow_entries (rtems_rfs_dir_index* index)
+{
+  rtems_rfs_dir_index_entry* entries;
+  uint32_t                   entry_size;
+  uint32_t                   slot;
+
+  entry_size = index->entry_size ? index->entry_size * 2 : index->bucket_count;
+  entries = realloc (index->entries,
+                     entry_size * sizeof (rtems_rfs_dir_index_entry));
+  if (!entries)
+    return ENOMEM;
+
+  /*
+   * Place the new entries on the free list.
+   */
+  for (slot = entry_size; slot > index->entry_size; slot--)
+  {
+    entries[slot - 1].next = index->entry_free;
+    index->entry_free = slot - 1;
+  }
+
+  index->entries = entries;
+  index->entry_size = entry_size;
+  return 0;
+}
+
+static int
+rtems_rfs_dir_index_grow_blocks (rtems_rfs_dir_index* index,
+                                 uint32_t             block_count)
+{
+  if (block_count > index->block_size)
+  {
+    uint32_t* block_free;
+    uint32_t  block_size;
+
+    block_size = index->block_size ? index->block_size : 1;
+    while (block_size < block_count)
+      block_size *= 2;
+
+    block_free = realloc (index->block_free, block_size * sizeof (uint32_t));
+    if (!block_free)
+      return ENOMEM;
+
+    index->block_free = block_free;
+    index->block_size = block_size;
+  }
+
+  return 0;
+}
+
+static int
+rtems_rfs_dir_index_insert (rtems_rfs_dir_index* index,
+                            uint32_t             hash,
+                            rtems_rfs_ino        ino,
+                            rtems_rfs_block_no   bno)
+{
+  rtems_rfs_dir_index_entry* entry;
+  uint32_t                   bucket;
+  uint32_t                   slot;
+  int                        rc;
+
+  if (index->entry_count >= index->bucket_count)
+  {
+    rc = rtems_rfs_dir_index_rehash (index);
+    if (rc > 0)
+      return rc;
+  }
+
+  if (index->entry_free == RTEMS_RFS_DIR_INDEX_NONE)
+  {
+    rc = rtems_rfs_dir_index_grow_entries (index);
+    if (rc > 0)
+      return rc;
+  }
+
+  slot = index->entry_free;
+  entry = &index->entries[slot];
+  index->entry_free = entry->next;
+
+  bucket = rtems_rfs_dir_index_bucket (index, hash);
+  entry->hash = hash;
+  entry->ino = ino;
+  entry->bno = bno;
+  entry->next = index->buckets[bucket];
+  index->buckets[bucket] = slot;
+  index->entry_count++;
+
+  return 0;
+}
+
+static void
+rtems_rfs_dir_index_remove (rtems_rfs_file_system* fs,
+                            rtems_rfs_dir_index*   index)
+{
+  rtems_chain_extract_unprotected (&index->link);
+  fs->dir_index_count--;
+  rtems_rfs_dir_index_destroy (index);
+}
+
+static int
+rtems_rfs_dir_index_build (rtems_rfs_file_system* fs,
+                           rtems_rfs_block_map*   map,
+                           rtems_rfs_dir_index*   index)
+{
+  rtems_rfs_buffer_handle buffer;
+  rtems_rfs_block_pos     bpos;
+  uint32_t                b;
+  int                     rc;
+
+  for (b = 0; b < index->bucket_count; b++)
+    index->buckets[b] = RTEMS_RFS_DIR_INDEX_NONE;
+
+  rc = rtems_rfs_dir_index_grow_blocks (index, rtems_rfs_block_map_count (map));
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_buffer_handle_open (fs, &buffer);
+  if (rc > 0)
+    return rc;
+
+  rtems_rfs_block_set_bpos_zero (&bpos);
+
+  while (bpos.bno < rtems_rfs_block_map_count (map))
+  {
+    rtems_rfs_block_no block;
+    uint8_t*           entry;
+    int                offset;
+
+    rc = rtems_rfs_block_map_find (fs, map, &bpos, &block);
+    if (rc > 0)
+      break;
+
+    rc = rtems_rfs_buffer_handle_request (fs, &buffer, block, true);
+    if (rc > 0)
+      break;
+
+    entry = rtems_rfs_buffer_data (&buffer);
+    offset = 0;
+
+    while (offset < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+    {
+      rtems_rfs_ino eino;
+      int           elength;
+
+      elength = rtems_rfs_dir_entry_length (entry);
+      eino    = rtems_rfs_dir_entry_ino (entry);
+
+      if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+        break;
+
+      if (rtems_rfs_dir_entry_valid (fs, elength, eino))
+      {
+        rc = EIO;
+        break;
+      }
+
+      rc = rtems_rfs_dir_index_insert (index,
+                                       rtems_rfs_dir_entry_hash (entry),
+                                       eino, bpos.bno);
+      if (rc > 0)
+        break;
+
+      entry  += elength;
+      offset += elength;
+    }
+
+    if (rc > 0)
+      break;
+
+    index->block_free[bpos.bno] = rtems_rfs_fs_block_size (fs) - offset;
+    bpos.bno++;
+  }
+
+  index->block_count = bpos.bno;
+
+  rtems_rfs_buffer_handle_close (fs, &buffer);
+  return rc;
+}
+
+rtems_rfs_dir_index*
+rtems_rfs_dir_index_find (rtems_rfs_file_system* fs,
+                          rtems_rfs_ino          ino)
+{
+  rtems_chain_node* node;
+
+  node = rtems_chain_first (&fs->dir_indexes);
+
+  while (!rtems_chain_is_tail (&fs->dir_indexes, node))
+  {
+    rtems_rfs_dir_index* index = (rtems_rfs_dir_index*) node;
+
+    if (index->ino == ino)
+    {
+      /*
+       * Keep the most recently used index at the head of the list.
+       */
+      if (!rtems_chain_is_first (node))
+      {
+        rtems_chain_extract_unprotected (node);
+        rtems_chain_prepend_unprotected (&fs->dir_indexes, node);
+      }
+      return index;
+    }
+
+    node = rtems_chain_next (node);
+  }
+
+  return NULL;
+}
+
+int
+rtems_rfs_dir_index_get (rtems_rfs_file_system* fs,
+                         rtems_rfs_block_map*   map,
+                         rtems_rfs_dir_index**  index)
+{
+  rtems_rfs_ino ino = rtems_rfs_inode_ino (map->inode);
+  int           rc;
+
+  *index = rtems_rfs_dir_index_find (fs, ino);
+  if (*index)
+    return 0;
+
+  if (rtems_rfs_block_map_count (map) < RTEMS_RFS_DIR_INDEX_MIN_BLOCKS)
+    return 0;
+
+  if (fs->dir_index_count >= RTEMS_RFS_DIR_INDEX_MAX)
+    rtems_rfs_dir_index_remove (fs, (rtems_rfs_dir_index*)
+                                rtems_chain_last (&fs->dir_indexes));
+
+  *index = calloc (1, sizeof (rtems_rfs_dir_index));
+  if (!*index)
+    return 0;
+
+  (*index)->ino = ino;
+  (*index)->bucket_count = RTEMS_RFS_DIR_INDEX_BUCKETS;
+  (*index)->entry_free = RTEMS_RFS_DIR_INDEX_NONE;
+  (*index)->buckets = malloc (RTEMS_RFS_DIR_INDEX_BUCKETS * sizeof (uint32_t));
+  if (!(*index)->buckets)
+  {
+    rtems_rfs_dir_index_destroy (*index);
+    *index = NULL;
+    return 0;
+  }
+
+  rc = rtems_rfs_dir_index_build (fs, map, *index);
+  if (rc > 0)
+  {
+    rtems_rfs_dir_index_destroy (*index);
+    *index = NULL;
+
+    /*
+     * Running out of memory is not an error. The directory is searched
+     * without an index.
+     */
+    if (rc == ENOMEM)
+      rc = 0;
+    return rc;
+  }
+
+  rtems_chain_prepend_unprotected (&fs->dir_indexes, &(*index)->link);
+  fs->dir_index_count++;
+
+  return 0;
+}
+
+bool
+rtems_rfs_dir_index_next (rtems_rfs_dir_index* index,
+                          uint32_t             hash,
+                          uint32_t*            slot,
+                          rtems_rfs_block_no*  bno)
+{
+  if (*slot == RTEMS_RFS_DIR_INDEX_NONE)
+    *slot = index->buckets[rtems_rfs_dir_index_bucket (index, hash)];
+  else
+    *slot = index->entries[*slot].next;
+
+  while (*slot != RTEMS_RFS_DIR_INDEX_NONE)
+  {
+    const rtems_rfs_dir_index_entry* entry = &index->entries[*slot];
+    if (entry->hash == hash)
+    {
+      *bno = entry->bno;
+      return true;
+    }
+    *slot = entry->next;
+  }
+
+  return false;
+}
+
+rtems_rfs_block_no
+rtems_rfs_dir_index_space (rtems_rfs_dir_index* index,
+                           size_t               length)
+{
+  rtems_rfs_block_no bno;
+
+  for (bno = 0; bno < index->block_count; bno++)
+    if (index->block_free[bno] > length)
+      break;
+
+  return bno;
+}
+
+int
+rtems_rfs_dir_index_add (rtems_rfs_file_system* fs,
+                         rtems_rfs_dir_index*   index,
+                         uint32_t               hash,
+                         rtems_rfs_ino          ino,
+                         rtems_rfs_block_no     bno,
+                         size_t                 length)
+{
+  int rc;
+
+  if (bno >= index->block_count)
+  {
+    rc = rtems_rfs_dir_index_grow_blocks (index, bno + 1);
+    if (rc > 0)
+      return rc;
+    index->block_free[bno] = rtems_rfs_fs_block_size (fs);
+    index->block_count = bno + 1;
+  }
+
+  rc = rtems_rfs_dir_index_insert (index, hash, ino, bno);
+  if (rc > 0)
+    return rc;
+
+  index->block_free[bno] -= length;
+  return 0;
+}
+
+void
+rtems_rfs_dir_index_del (rtems_rfs_dir_index* index,
+                         uint32_t             hash,
+                         rtems_rfs_ino        ino,
+                         rtems_rfs_block_no   bno,
+                         size_t               length,
+                         bool                 shrunk)
+{
+  uint32_t* slot;
+
+  slot = &index->buckets[rtems_rfs_dir_index_bucket (index, hash)];
+
+  while (*slot != RTEMS_RFS_DIR_INDEX_NONE)
+  {
+    rtems_rfs_dir_index_entry* entry = &index->entries[*slot];
+
+    if ((entry->hash == hash) && (entry->ino == ino) && (entry->bno == bno))
+    {
+      uint32_t next = entry->next;
+      entry->next = index->entry_free;
+      index->entry_free = *slot;
+      *slot = next;
+      index->entry_count--;
+      break;
+    }
+
+    slot = &entry->next;
+  }
+
+  if (bno < index->block_count)
+  {
+    index->block_free[bno] += length;
+    if (shrunk && ((bno + 1) == index->block_count))
+      index->block_count--;
+  }
+}
+
+void
+rtems_rfs_dir_index_drop (rtems_rfs_file_system* fs,
+                          rtems_rfs_ino          ino)
+{
+  rtems_rfs_dir_index* index;
+
+  index = rtems_rfs_dir_index_find (fs, ino);
+  if (index)
+    rtems_rfs_dir_index_remove (fs, index);
+}
+
+void
+rtems_rfs_dir_index_drop_all (rtems_rfs_file_system* fs)
+{
+  while (!rtems_chain_is_empty (&fs->dir_indexes))
+    rtems_rfs_dir_index_remove (fs, (rtems_rfs_dir_index*)
+                                rtems_chain_first (&fs->dir_indexes));
+}
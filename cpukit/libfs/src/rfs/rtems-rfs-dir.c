@@ -57,13 +57,90 @@
 #include <rtems/rfs/rtems-rfs-trace.h>
 #include <rtems/rfs/rtems-rfs-dir.h>
 #include <rtems/rfs/rtems-rfs-dir-hash.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
 
 /**
- * Validate the directory entry data.
+ * Look up the name in the blocks of the directory the index holds for the
+ * hash.
  */
-#define rtems_rfs_dir_entry_valid(_f, _l, _i) \
-  (((_l) <= RTEMS_RFS_DIR_ENTRY_SIZE) || ((_l) >= rtems_rfs_fs_max_name (_f)) \
-   || (_i < RTEMS_RFS_ROOT_INO) || (_i > rtems_rfs_fs_inodes (_f)))
+static int
+rtems_rfs_dir_lookup_ino_indexed (rtems_rfs_file_system*   fs,
+                                  rtems_rfs_block_map*     map,
+                                  rtems_rfs_buffer_handle* entries,
+                                  rtems_rfs_dir_index*     index,
+                                  const char*              name,
+                                  int                      length,
+                                  uint32_t                 hash,
+                                  rtems_rfs_ino*           ino,
+                                  uint32_t*                offset)
+{
+  rtems_rfs_block_no bno;
+  uint32_t           slot = RTEMS_RFS_DIR_INDEX_NONE;
+  int                rc = 0;
+
+  while (rtems_rfs_dir_index_next (index, hash, &slot, &bno))
+  {
+    rtems_rfs_block_pos bpos;
+    rtems_rfs_block_no  block;
+    uint8_t*            entry;
+
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
+      printf ("rtems-rfs: dir-lookup-ino: index block, ino=%" PRIu32 " bno=%" PRId32 "\n",
+              index->ino, bno);
+
+    bpos.bno = bno;
+    bpos.boff = 0;
+
+    rc = rtems_rfs_block_map_find (fs, map, &bpos, &block);
+    if (rc > 0)
+    {
+      if (rc == ENXIO)
+        rc = EIO;
+      return rc;
+    }
+
+    rc = rtems_rfs_buffer_handle_request (fs, entries, block, true);
+    if (rc > 0)
+      return rc;
+
+    entry = rtems_rfs_buffer_data (entries);
+
+    bpos.boff = 0;
+
+    while (bpos.boff < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+    {
+      int elength;
+
+      elength = rtems_rfs_dir_entry_length (entry);
+      *ino = rtems_rfs_dir_entry_ino (entry);
+
+      if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+        break;
+
+      if (rtems_rfs_dir_entry_valid (fs, elength, *ino))
+        return EIO;
+
+      if ((rtems_rfs_dir_entry_hash (entry) == hash) &&
+          (memcmp (entry + RTEMS_RFS_DIR_ENTRY_SIZE, name, length) == 0))
+      {
+        *offset = (bno * rtems_rfs_fs_block_size (fs)) + bpos.boff;
+
+        if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO_FOUND))
+          printf ("rtems-rfs: dir-lookup-ino: "
+                  "entry found in ino %" PRIu32 ", ino=%" PRIu32 " offset=%" PRIu32 "\n",
+                  index->ino, *ino, *offset);
+
+        return 0;
+      }
+
+      bpos.boff += elength;
+      entry += elength;
+    }
+  }
+
+  *ino = RTEMS_RFS_EMPTY_INO;
+  return ENOENT;
+}
 
 int
 rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
@@ -75,6 +152,7 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
 {
   rtems_rfs_block_map     map;
   rtems_rfs_buffer_handle entries;
+  rtems_rfs_dir_index*    index = NULL;
   int                     rc;
 
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
@@ -99,6 +177,16 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
     return rc;
   }
 
+  if (rtems_rfs_fs_dir_index (fs))
+  {
+    rc = rtems_rfs_dir_index_get (fs, &map, &index);
+    if (rc > 0)
+    {
+      rtems_rfs_block_map_close (fs, &map);
+      return rc;
+    }
+  }
+
   rc = rtems_rfs_buffer_handle_open (fs, &entries);
   if (rc > 0)
   {
@@ -118,6 +206,18 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
      */
     hash = rtems_rfs_dir_hash (name, length);
 
+    /*
+     * An indexed directory only searches the blocks holding the hash.
+     */
+    if (index)
+    {
+      rc = rtems_rfs_dir_lookup_ino_indexed (fs, &map, &entries, index,
+                                             name, length, hash, ino, offset);
+      rtems_rfs_buffer_handle_close (fs, &entries);
+      rtems_rfs_block_map_close (fs, &map);
+      return rc;
+    }
+
     /*
      * Locate the first block. The map points to the start after open so just
      * seek 0. If an error the block will be 0.
@@ -250,6 +350,7 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
   rtems_rfs_block_map     map;
   rtems_rfs_block_pos     bpos;
   rtems_rfs_buffer_handle buffer;
+  rtems_rfs_dir_index*    index = NULL;
   int                     rc;
 
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
@@ -266,6 +367,16 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
   if (rc > 0)
     return rc;
 
+  if (rtems_rfs_fs_dir_index (fs))
+  {
+    rc = rtems_rfs_dir_index_get (fs, &map, &index);
+    if (rc > 0)
+    {
+      rtems_rfs_block_map_close (fs, &map);
+      return rc;
+    }
+  }
+
   rc = rtems_rfs_buffer_handle_open (fs, &buffer);
   if (rc > 0)
   {
@@ -274,10 +385,15 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
   }
 
   /*
-   * Search the map from the beginning to find any empty space.
+   * Search the map from the beginning to find any empty space. An indexed
+   * directory starts at the first block with enough space.
    */
   rtems_rfs_block_set_bpos_zero (&bpos);
 
+  if (index)
+    bpos.bno = rtems_rfs_dir_index_space (index,
+                                          length + RTEMS_RFS_DIR_ENTRY_SIZE);
+
   while (true)
   {
     rtems_rfs_block_no block;
@@ -358,6 +474,13 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
                                           RTEMS_RFS_DIR_ENTRY_SIZE + length);
           memcpy (entry + RTEMS_RFS_DIR_ENTRY_SIZE, name, length);
           rtems_rfs_buffer_mark_dirty (&buffer);
+          if (index)
+          {
+            rc = rtems_rfs_dir_index_add (fs, index, hash, ino, bpos.bno - 1,
+                                          RTEMS_RFS_DIR_ENTRY_SIZE + length);
+            if (rc > 0)
+              rtems_rfs_dir_index_drop (fs, rtems_rfs_inode_ino (dir));
+          }
           rtems_rfs_buffer_handle_close (fs, &buffer);
           rtems_rfs_block_map_close (fs, &map);
           return 0;
@@ -478,7 +601,12 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
 
       if (ino == rtems_rfs_dir_entry_ino (entry))
       {
-        uint32_t remaining;
+        rtems_rfs_dir_index* index;
+        rtems_rfs_block_no   bno = rtems_rfs_block_map_block (&map);
+        uint32_t             ehash = rtems_rfs_dir_entry_hash (entry);
+        int                  dlength = elength;
+        bool                 shrunk = false;
+        uint32_t             remaining;
         remaining = rtems_rfs_fs_block_size (fs) - (eoffset + elength);
         memmove (entry, entry + elength, remaining);
         memset (entry + remaining, 0xff, elength);
@@ -510,8 +638,14 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
                       "block map shrink failed for ino %" PRIu32 ": %d: %s\n",
                       rtems_rfs_inode_ino (dir), rc, strerror (rc));
           }
+          else
+            shrunk = true;
         }
 
+        index = rtems_rfs_dir_index_find (fs, rtems_rfs_inode_ino (dir));
+        if (index)
+          rtems_rfs_dir_index_del (index, ehash, ino, bno, dlength, shrunk);
+
         rtems_rfs_buffer_mark_dirty (&buffer);
         rtems_rfs_buffer_handle_close (fs, &buffer);
         rtems_rfs_block_map_close (fs, &map);
@@ -43,6 +43,7 @@
 #include <string.h>
 
 #include <rtems/rfs/rtems-rfs-data.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
 #include <rtems/rfs/rtems-rfs-file-system.h>
 #include <rtems/rfs/rtems-rfs-inode.h>
 #include <rtems/rfs/rtems-rfs-trace.h>
@@ -245,11 +246,13 @@ rtems_rfs_fs_open (const char*             name,
   rtems_chain_initialize_empty (&(*fs)->release);
   rtems_chain_initialize_empty (&(*fs)->release_modified);
   rtems_chain_initialize_empty (&(*fs)->file_shares);
+  rtems_chain_initialize_empty (&(*fs)->dir_indexes);
 
   (*fs)->max_held_buffers = max_held_buffers;
   (*fs)->buffers_count = 0;
   (*fs)->release_count = 0;
   (*fs)->release_modified_count = 0;
+  (*fs)->dir_index_count = 0;
   (*fs)->flags = flags;
 
 #if UNUSED
@@ -336,6 +339,8 @@ rtems_rfs_fs_close (rtems_rfs_file_system* fs)
   for (group = 0; group < fs->group_count; group++)
     rtems_rfs_group_close (fs, &fs->groups[group]);
 
+  rtems_rfs_dir_index_drop_all (fs);
+
   rtems_rfs_buffer_close (fs);
 
   free (fs);
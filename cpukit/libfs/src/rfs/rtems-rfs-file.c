@@ -73,6 +73,7 @@ rtems_rfs_file_open (rtems_rfs_file_system*  fs,
     return ENOMEM;
 
   memset (handle, 0, sizeof (rtems_rfs_file_handle));
+  rtems_chain_initialize_empty (&handle->borrows);
 
   rc = rtems_rfs_buffer_handle_open (fs, &handle->buffer);
   if (rc > 0)
@@ -173,6 +174,19 @@ rtems_rfs_file_close (rtems_rfs_file_system* fs,
     printf ("rtems-rfs: file-close: entry: ino=%" PRId32 "\n",
             handle->shared->inode.ino);
 
+  /*
+   * Release the data still borrowed through this handle.
+   */
+  while (!rtems_chain_is_empty (&handle->borrows))
+  {
+    rtems_rfs_file_borrow* borrow;
+
+    borrow = (rtems_rfs_file_borrow*) rtems_chain_first (&handle->borrows);
+    rc = rtems_rfs_file_io_release_borrow (handle, borrow);
+    if ((rrc == 0) && (rc > 0))
+      rrc = rc;
+  }
+
   if (handle->shared->references > 0)
     handle->shared->references--;
 
@@ -192,6 +206,18 @@ rtems_rfs_file_close (rtems_rfs_file_system* fs,
                                  handle->shared->mtime);
       rtems_rfs_inode_set_ctime (&handle->shared->inode,
                                  handle->shared->ctime);
+      /*
+       * A write which failed part way can leave blocks in the map past the
+       * end of the file. Free them.
+       */
+      if (handle->shared->map.size.count > handle->shared->size.count)
+      {
+        rc = rtems_rfs_block_map_shrink (fs, &handle->shared->map,
+                                         handle->shared->map.size.count -
+                                         handle->shared->size.count);
+        if ((rrc == 0) && (rc > 0))
+          rrc = rc;
+      }
       if (!rtems_rfs_block_size_equal (&handle->shared->size,
                                        &handle->shared->map.size))
         rtems_rfs_block_map_set_size (&handle->shared->map,
@@ -251,6 +277,8 @@ rtems_rfs_file_io_start (rtems_rfs_file_handle* handle,
   if (!rtems_rfs_buffer_handle_has_block (&handle->buffer))
   {
     rtems_rfs_buffer_block block;
+    rtems_rfs_block_no     count;
+    size_t                 blocks;
     bool                   request_read;
     int                    rc;
 
@@ -274,13 +302,31 @@ rtems_rfs_file_io_start (rtems_rfs_file_handle* handle,
       if (rc != ENXIO)
         return rc;
 
+      /*
+       * Grow the map by the blocks the rest of the write covers so the blocks
+       * are allocated as runs. The following calls find the blocks in the
+       * map. If only some of the blocks could be allocated write to those.
+       */
+      count = rtems_rfs_block_map_count (rtems_rfs_file_map (handle));
+      blocks = (rtems_rfs_file_block_offset (handle) + *available +
+                rtems_rfs_fs_block_size (rtems_rfs_file_fs (handle)) - 1) /
+        rtems_rfs_fs_block_size (rtems_rfs_file_fs (handle));
+      if ((count + blocks) >=
+          rtems_rfs_fs_max_block_map_blocks (rtems_rfs_file_fs (handle)))
+        blocks =
+          rtems_rfs_fs_max_block_map_blocks (rtems_rfs_file_fs (handle)) -
+          count - 1;
+      if (blocks == 0)
+        blocks = 1;
+
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_FILE_IO))
-        printf ("rtems-rfs: file-io: start: grow\n");
+        printf ("rtems-rfs: file-io: start: grow: blocks=%zu\n", blocks);
 
       rc = rtems_rfs_block_map_grow (rtems_rfs_file_fs (handle),
                                      rtems_rfs_file_map (handle),
-                                     1, &block);
-      if (rc > 0)
+                                     blocks, &block);
+      if ((rc > 0) &&
+          (rtems_rfs_block_map_count (rtems_rfs_file_map (handle)) == count))
         return rc;
 
       request_read = false;
@@ -412,6 +458,183 @@ rtems_rfs_file_io_end (rtems_rfs_file_handle* handle,
   return rc;
 }
 
+int
+rtems_rfs_file_io_read_blocks (rtems_rfs_file_handle* handle,
+                               void*                  data,
+                               size_t                 count,
+                               size_t*                read)
+{
+  rtems_rfs_file_system* fs = rtems_rfs_file_fs (handle);
+  size_t                 block_size = rtems_rfs_fs_block_size (fs);
+  rtems_rfs_pos          pos;
+  rtems_rfs_pos          size;
+  rtems_rfs_block_pos    bpos;
+  rtems_rfs_buffer_block block;
+  size_t                 blocks;
+  size_t                 b;
+  int                    rc;
+
+  *read = 0;
+
+  if (rtems_rfs_buffer_handle_has_block (&handle->buffer) ||
+      rtems_rfs_file_block_offset (handle))
+    return 0;
+
+  pos = rtems_rfs_block_get_pos (fs, rtems_rfs_file_bpos (handle));
+  size = rtems_rfs_file_size (handle);
+  if (pos >= size)
+    return 0;
+
+  if ((size - pos) < count)
+    count = size - pos;
+
+  blocks = count / block_size;
+  if (blocks < 2)
+    return 0;
+
+  rc = rtems_rfs_block_map_find (fs, rtems_rfs_file_map (handle),
+                                 rtems_rfs_file_bpos (handle), &block);
+  if (rc > 0)
+    return rc == ENXIO ? 0 : rc;
+
+  /*
+   * Only the blocks consecutive on the media can be read with one request.
+   */
+  rtems_rfs_block_copy_bpos (&bpos, rtems_rfs_file_bpos (handle));
+  for (b = 1; b < blocks; b++)
+  {
+    rtems_rfs_buffer_block next;
+
+    bpos.bno++;
+    rc = rtems_rfs_block_map_find (fs, rtems_rfs_file_map (handle),
+                                   &bpos, &next);
+    if (rc > 0)
+      return rc;
+
+    if (next != (block + b))
+      break;
+  }
+
+  if (b < 2)
+    return 0;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_FILE_IO))
+    printf ("rtems-rfs: file-io: read-blocks: block=%" PRIu32 " blocks=%zu\n",
+            block, b);
+
+  rc = rtems_rfs_buffer_read_blocks (fs, block, b, data);
+  if (rc > 0)
+    return rc;
+
+  handle->bpos.bno += b;
+  *read = b * block_size;
+
+  if (rtems_rfs_file_update_atime (handle))
+    handle->shared->atime = time (NULL);
+
+  return 0;
+}
+
+int
+rtems_rfs_file_io_borrow (rtems_rfs_file_handle*  handle,
+                          size_t*                 size,
+                          const void**            data,
+                          rtems_rfs_file_borrow** borrow)
+{
+  rtems_rfs_file_system* fs = rtems_rfs_file_fs (handle);
+  rtems_rfs_file_borrow* b;
+  size_t                 available;
+  int                    rc;
+
+  *borrow = NULL;
+
+  rc = rtems_rfs_file_io_start (handle, &available, true);
+  if (rc > 0)
+    return rc;
+
+  if (available == 0)
+  {
+    *size = 0;
+    return 0;
+  }
+
+  if ((*size > 0) && (available > *size))
+    available = *size;
+
+  b = malloc (sizeof (rtems_rfs_file_borrow));
+  if (!b)
+    return ENOMEM;
+
+  rc = rtems_rfs_buffer_handle_open (fs, &b->buffer);
+  if (rc > 0)
+  {
+    free (b);
+    return rc;
+  }
+
+  /*
+   * The request shares the buffer held by the file handle and takes a
+   * reference of its own.
+   */
+  rc = rtems_rfs_buffer_handle_request (fs, &b->buffer,
+                                        rtems_rfs_buffer_bnum (&handle->buffer),
+                                        true);
+  if (rc > 0)
+  {
+    free (b);
+    return rc;
+  }
+
+  *data = rtems_rfs_file_data (handle);
+
+  rc = rtems_rfs_file_io_end (handle, available, true);
+  if (rc > 0)
+  {
+    rtems_rfs_buffer_handle_close (fs, &b->buffer);
+    free (b);
+    return rc;
+  }
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_FILE_IO))
+    printf ("rtems-rfs: file-io: borrow: block=%" PRIu32 " size=%zu\n",
+            rtems_rfs_buffer_bnum (&b->buffer), available);
+
+  rtems_chain_append_unprotected (&handle->borrows, &b->link);
+  *size = available;
+  *borrow = b;
+
+  return 0;
+}
+
+int
+rtems_rfs_file_io_release_borrow (rtems_rfs_file_handle* handle,
+                                  rtems_rfs_file_borrow* borrow)
+{
+  rtems_chain_node* node;
+  int               rc;
+
+  /*
+   * The borrow is provided by the user so check it belongs to the handle.
+   */
+  node = rtems_chain_first (&handle->borrows);
+  while (node != rtems_chain_tail (&handle->borrows))
+  {
+    if (node == &borrow->link)
+      break;
+    node = rtems_chain_next (node);
+  }
+
+  if (node != &borrow->link)
+    return EINVAL;
+
+  rtems_chain_extract_unprotected (&borrow->link);
+  rc = rtems_rfs_buffer_handle_close (rtems_rfs_file_fs (handle),
+                                      &borrow->buffer);
+  free (borrow);
+
+  return rc;
+}
+
 int
 rtems_rfs_file_io_release (rtems_rfs_file_handle* handle)
 {
@@ -522,26 +745,29 @@ rtems_rfs_file_set_size (rtems_rfs_file_handle* handle,
         /*
          * Grow. Fill with 0's.
          */
-        rtems_rfs_pos count;
-        uint32_t      length;
-        bool          read_block;
+        rtems_rfs_pos       count;
+        rtems_rfs_block_pos bpos;
+        uint32_t            length;
+        bool                read_block;
 
         count = new_size - size;
         length = rtems_rfs_fs_block_size (rtems_rfs_file_fs (handle));
         read_block = false;
 
+        /*
+         * Start at the current end of the file as seen by the map.
+         */
+        rtems_rfs_block_size_get_bpos (rtems_rfs_block_map_size (map), &bpos);
+
         while (count)
         {
           rtems_rfs_buffer_block block;
-          rtems_rfs_block_pos    bpos;
           uint8_t*               dst;
 
           /*
-           * Get the block position for the current end of the file as seen by
-           * the map. If not found and the EOF grow the map then fill the block
-           * with 0.
+           * If not found and the EOF grow the map by the blocks left to fill
+           * then fill the block with 0.
            */
-          rtems_rfs_block_size_get_bpos (rtems_rfs_block_map_size (map), &bpos);
           rc = rtems_rfs_block_map_find (rtems_rfs_file_fs (handle),
                                          map, &bpos, &block);
           if (rc > 0)
@@ -553,7 +779,10 @@ rtems_rfs_file_set_size (rtems_rfs_file_handle* handle,
               return rc;
 
             rc = rtems_rfs_block_map_grow (rtems_rfs_file_fs (handle),
-                                           map, 1, &block);
+                                           map,
+                                           (bpos.boff + count + length - 1) /
+                                           length,
+                                           &block);
             if (rc > 0)
               return rc;
           }
@@ -589,6 +818,8 @@ rtems_rfs_file_set_size (rtems_rfs_file_handle* handle,
             return rc;
 
           count -= length - bpos.boff;
+          bpos.bno++;
+          bpos.boff = 0;
         }
       }
       else
@@ -288,6 +288,73 @@ rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
   return ENOSPC;
 }
 
+int
+rtems_rfs_group_bitmap_alloc_extent (rtems_rfs_file_system* fs,
+                                     rtems_rfs_bitmap_bit   goal,
+                                     size_t                 count,
+                                     rtems_rfs_bitmap_bit*  result,
+                                     size_t*                allocated)
+{
+  rtems_rfs_bitmap_control* bitmap;
+  rtems_rfs_bitmap_bit      bit;
+  int                       group;
+  int                       rc;
+
+  *allocated = 0;
+
+  /*
+   * A single block is allocated as before, searching out from the goal in both
+   * directions.
+   */
+  if (count == 1)
+  {
+    rc = rtems_rfs_group_bitmap_alloc (fs, goal, false, result);
+    if (rc > 0)
+      return rc;
+    *allocated = 1;
+    return 0;
+  }
+
+  /*
+   * The goal is the last block allocated and the bit of a block is the block
+   * less RTEMS_RFS_ROOT_INO so the goal is the bit of the block after it.
+   */
+  group = goal / fs->group_blocks;
+  bit = (rtems_rfs_bitmap_bit) (goal % fs->group_blocks);
+
+  if (group < fs->group_count)
+  {
+    bitmap = &fs->groups[group].block_bitmap;
+
+    rc = rtems_rfs_bitmap_map_alloc_extent (bitmap, bit, count,
+                                            &bit, allocated);
+    if (rc > 0)
+      return rc;
+
+    if (rtems_rfs_fs_release_bitmaps (fs))
+      rtems_rfs_bitmap_release_buffer (fs, bitmap);
+
+    if (*allocated)
+    {
+      *result = rtems_rfs_group_block (&fs->groups[group], bit);
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_GROUP_BITMAPS))
+        printf ("rtems-rfs: group-bitmap-alloc-extent: allocated: %" PRId32
+                " count=%zu\n", *result, *allocated);
+      return 0;
+    }
+  }
+
+  /*
+   * The goal group is full. Search the other groups for a single block.
+   */
+  rc = rtems_rfs_group_bitmap_alloc (fs, goal, false, result);
+  if (rc > 0)
+    return rc;
+
+  *allocated = 1;
+  return 0;
+}
+
 int
 rtems_rfs_group_bitmap_free (rtems_rfs_file_system* fs,
                              bool                   inode,
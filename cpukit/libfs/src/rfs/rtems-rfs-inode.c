@@ -46,6 +46,7 @@
 #include <rtems/rfs/rtems-rfs-file-system.h>
 #include <rtems/rfs/rtems-rfs-inode.h>
 #include <rtems/rfs/rtems-rfs-dir.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
 
 int
 rtems_rfs_inode_alloc (rtems_rfs_file_system* fs,
@@ -357,6 +358,11 @@ rtems_rfs_inode_delete (rtems_rfs_file_system*  fs,
     if (rc > 0)
       return rc;
 
+    /*
+     * The ino can be reused so drop any index of the directory.
+     */
+    rtems_rfs_dir_index_drop (fs, handle->ino);
+
     /*
      * Free the blocks the inode may have attached.
      */
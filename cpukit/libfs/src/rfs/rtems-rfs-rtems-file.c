@@ -117,6 +117,64 @@ rtems_rfs_rtems_file_close (rtems_libio_t* iop)
   return rc;
 }
 
+/**
+ * Read from the file at the current file position with the file system
+ * locked.
+ *
+ * @param file
+ * @param buffer
+ * @param count
+ * @return ssize_t
+ */
+static ssize_t
+rtems_rfs_rtems_file_read_locked (rtems_rfs_file_handle* file,
+                                  void*                  buffer,
+                                  size_t                 count)
+{
+  uint8_t* data = buffer;
+  ssize_t  read = 0;
+  int      rc;
+
+  while (count)
+  {
+    size_t size;
+
+    rc = rtems_rfs_file_io_read_blocks (file, data, count, &size);
+    if (rc > 0)
+      return rtems_rfs_rtems_error ("file-read: read: read-blocks", rc);
+
+    if (size > 0)
+    {
+      data  += size;
+      count -= size;
+      read  += size;
+      continue;
+    }
+
+    rc = rtems_rfs_file_io_start (file, &size, true);
+    if (rc > 0)
+      return rtems_rfs_rtems_error ("file-read: read: io-start", rc);
+
+    if (size == 0)
+      break;
+
+    if (size > count)
+      size = count;
+
+    memcpy (data, rtems_rfs_file_data (file), size);
+
+    data  += size;
+    count -= size;
+    read  += size;
+
+    rc = rtems_rfs_file_io_end (file, size, true);
+    if (rc > 0)
+      return rtems_rfs_rtems_error ("file-read: read: io-end", rc);
+  }
+
+  return read;
+}
+
 /**
  * This routine processes the read() system call.
  *
@@ -132,9 +190,7 @@ rtems_rfs_rtems_file_read (rtems_libio_t* iop,
 {
   rtems_rfs_file_handle* file = rtems_rfs_rtems_get_iop_file_handle (iop);
   rtems_rfs_pos          pos;
-  uint8_t*               data = buffer;
   ssize_t                read = 0;
-  int                    rc;
 
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_READ))
     printf("rtems-rfs: file-read: handle:%p count:%zd\n", file, count);
@@ -144,36 +200,64 @@ rtems_rfs_rtems_file_read (rtems_libio_t* iop,
   pos = iop->offset;
 
   if (pos < rtems_rfs_file_size (file))
-  {
-    while (count)
-    {
-      size_t size;
+    read = rtems_rfs_rtems_file_read_locked (file, buffer, count);
 
-      rc = rtems_rfs_file_io_start (file, &size, true);
-      if (rc > 0)
-      {
-        read = rtems_rfs_rtems_error ("file-read: read: io-start", rc);
-        break;
-      }
+  if (read >= 0)
+    iop->offset = pos + read;
 
-      if (size == 0)
-        break;
+  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+
+  return read;
+}
+
+/**
+ * This routine processes the readv() system call. The file system is locked
+ * once for all the vectors.
+ *
+ * @param iop
+ * @param iov
+ * @param iovcnt
+ * @param total
+ * @return ssize_t
+ */
+static ssize_t
+rtems_rfs_rtems_file_readv (rtems_libio_t*      iop,
+                            const struct iovec* iov,
+                            int                 iovcnt,
+                            ssize_t             total)
+{
+  rtems_rfs_file_handle* file = rtems_rfs_rtems_get_iop_file_handle (iop);
+  rtems_rfs_pos          pos;
+  ssize_t                read = 0;
+  int                    v;
 
-      if (size > count)
-        size = count;
+  if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_READ))
+    printf("rtems-rfs: file-readv: handle:%p iovcnt:%d total:%zd\n",
+           file, iovcnt, total);
 
-      memcpy (data, rtems_rfs_file_data (file), size);
+  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
 
-      data  += size;
-      count -= size;
-      read  += size;
+  pos = iop->offset;
 
-      rc = rtems_rfs_file_io_end (file, size, true);
-      if (rc > 0)
+  if (pos < rtems_rfs_file_size (file))
+  {
+    for (v = 0; v < iovcnt; ++v)
+    {
+      ssize_t size;
+
+      size = rtems_rfs_rtems_file_read_locked (file,
+                                               iov[v].iov_base,
+                                               iov[v].iov_len);
+      if (size < 0)
       {
-        read = rtems_rfs_rtems_error ("file-read: read: io-end", rc);
+        read = size;
         break;
       }
+
+      read += size;
+
+      if ((size_t) size != iov[v].iov_len)
+        break;
     }
   }
 
@@ -186,59 +270,66 @@ rtems_rfs_rtems_file_read (rtems_libio_t* iop,
 }
 
 /**
- * This routine processes the write() system call.
+ * Position the file for a write at the iop position with the file system
+ * locked.
  *
  * @param iop
- * @param buffer
- * @param count
- * @return ssize_t
+ * @param file
+ * @param pos
+ * @return int
  */
-static ssize_t
-rtems_rfs_rtems_file_write (rtems_libio_t* iop,
-                            const void*    buffer,
-                            size_t         count)
+static int
+rtems_rfs_rtems_file_write_start (rtems_libio_t*         iop,
+                                  rtems_rfs_file_handle* file,
+                                  rtems_rfs_pos*         pos)
 {
-  rtems_rfs_file_handle* file = rtems_rfs_rtems_get_iop_file_handle (iop);
-  rtems_rfs_pos          pos;
-  rtems_rfs_pos          file_size;
-  const uint8_t*         data = buffer;
-  ssize_t                write = 0;
-  int                    rc;
-
-  if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_WRITE))
-    printf("rtems-rfs: file-write: handle:%p count:%zd\n", file, count);
-
-  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+  rtems_rfs_pos file_size;
+  int           rc;
 
-  pos = iop->offset;
+  *pos = iop->offset;
   file_size = rtems_rfs_file_size (file);
-  if (pos > file_size)
+  if (*pos > file_size)
   {
     /*
      * If the iop position is past the physical end of the file we need to set
      * the file size to the new length before writing.  The
      * rtems_rfs_file_io_end() will grow the file subsequently.
      */
-    rc = rtems_rfs_file_set_size (file, pos);
+    rc = rtems_rfs_file_set_size (file, *pos);
     if (rc)
-    {
-      rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
       return rtems_rfs_rtems_error ("file-write: write extend", rc);
-    }
 
-    rtems_rfs_file_set_bpos (file, pos);
+    rtems_rfs_file_set_bpos (file, *pos);
   }
-  else if (pos < file_size && rtems_libio_iop_is_append(iop))
+  else if (*pos < file_size && rtems_libio_iop_is_append(iop))
   {
-    pos = file_size;
-    rc = rtems_rfs_file_seek (file, pos, &pos);
+    *pos = file_size;
+    rc = rtems_rfs_file_seek (file, *pos, pos);
     if (rc)
-    {
-      rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
       return rtems_rfs_rtems_error ("file-write: write append seek", rc);
-    }
   }
 
+  return 0;
+}
+
+/**
+ * Write to the file at the current file position with the file system
+ * locked.
+ *
+ * @param file
+ * @param buffer
+ * @param count
+ * @return ssize_t
+ */
+static ssize_t
+rtems_rfs_rtems_file_write_locked (rtems_rfs_file_handle* file,
+                                   const void*            buffer,
+                                   size_t                 count)
+{
+  const uint8_t* data = buffer;
+  ssize_t        write = 0;
+  int            rc;
+
   while (count)
   {
     size_t size = count;
@@ -267,10 +358,110 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
 
     rc = rtems_rfs_file_io_end (file, size, false);
     if (rc)
+      return rtems_rfs_rtems_error ("file-write: write close", rc);
+  }
+
+  return write;
+}
+
+/**
+ * This routine processes the write() system call.
+ *
+ * @param iop
+ * @param buffer
+ * @param count
+ * @return ssize_t
+ */
+static ssize_t
+rtems_rfs_rtems_file_write (rtems_libio_t* iop,
+                            const void*    buffer,
+                            size_t         count)
+{
+  rtems_rfs_file_handle* file = rtems_rfs_rtems_get_iop_file_handle (iop);
+  rtems_rfs_pos          pos;
+  ssize_t                write;
+  int                    rc;
+
+  if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_WRITE))
+    printf("rtems-rfs: file-write: handle:%p count:%zd\n", file, count);
+
+  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+
+  rc = rtems_rfs_rtems_file_write_start (iop, file, &pos);
+  if (rc)
+  {
+    rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+    return rc;
+  }
+
+  write = rtems_rfs_rtems_file_write_locked (file, buffer, count);
+
+  if (write >= 0)
+    iop->offset = pos + write;
+
+  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+
+  return write;
+}
+
+/**
+ * This routine processes the writev() system call. The file system is locked
+ * once for all the vectors.
+ *
+ * @param iop
+ * @param iov
+ * @param iovcnt
+ * @param total
+ * @return ssize_t
+ */
+static ssize_t
+rtems_rfs_rtems_file_writev (rtems_libio_t*      iop,
+                             const struct iovec* iov,
+                             int                 iovcnt,
+                             ssize_t             total)
+{
+  rtems_rfs_file_handle* file = rtems_rfs_rtems_get_iop_file_handle (iop);
+  rtems_rfs_pos          pos;
+  ssize_t                write = 0;
+  int                    v;
+  int                    rc;
+
+  if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_WRITE))
+    printf("rtems-rfs: file-writev: handle:%p iovcnt:%d total:%zd\n",
+           file, iovcnt, total);
+
+  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+
+  rc = rtems_rfs_rtems_file_write_start (iop, file, &pos);
+  if (rc)
+  {
+    rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+    return rc;
+  }
+
+  for (v = 0; v < iovcnt; ++v)
+  {
+    ssize_t size;
+
+    size = rtems_rfs_rtems_file_write_locked (file,
+                                              iov[v].iov_base,
+                                              iov[v].iov_len);
+    if (size < 0)
     {
-      write = rtems_rfs_rtems_error ("file-write: write close", rc);
+      /*
+       * Unlike a single write, which discards the amount written before an
+       * error, return the amount written by the previous vectors.  Only
+       * report the error if nothing was written.
+       */
+      if (!write)
+        write = size;
       break;
     }
+
+    write += size;
+
+    if ((size_t) size != iov[v].iov_len)
+      break;
   }
 
   if (write >= 0)
@@ -281,6 +472,82 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
   return write;
 }
 
+/**
+ * This routine processes the ioctl() system call. The file data can be
+ * borrowed from the block buffers.
+ *
+ * @param iop
+ * @param request
+ * @param buffer
+ * @return int
+ */
+static int
+rtems_rfs_rtems_file_ioctl (rtems_libio_t*    iop,
+                            ioctl_command_t   request,
+                            void*             buffer)
+{
+  rtems_rfs_file_handle* file = rtems_rfs_rtems_get_iop_file_handle (iop);
+  rtems_filio_borrow*    borrow = buffer;
+  rtems_rfs_file_borrow* handle;
+  rtems_rfs_pos          pos;
+  int                    rc;
+
+  switch (request)
+  {
+    case RTEMS_FILIO_BORROW:
+      if (!rtems_libio_iop_is_readable (iop))
+        return rtems_rfs_rtems_error ("file-ioctl: borrow", EBADF);
+
+      rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+
+      pos = iop->offset;
+
+      if (pos >= rtems_rfs_file_size (file))
+      {
+        borrow->data = NULL;
+        borrow->size = 0;
+        borrow->handle = NULL;
+        rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+        return 0;
+      }
+
+      /*
+       * The file position can differ from the iop offset after a write
+       * extended the file so seek to be sure.
+       */
+      rc = rtems_rfs_file_seek (file, pos, &pos);
+      if (rc == 0)
+        rc = rtems_rfs_file_io_borrow (file, &borrow->size, &borrow->data,
+                                       &handle);
+      if (rc > 0)
+      {
+        rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+        return rtems_rfs_rtems_error ("file-ioctl: borrow", rc);
+      }
+
+      borrow->handle = handle;
+      iop->offset = pos + borrow->size;
+
+      rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+      return 0;
+
+    case RTEMS_FILIO_RELEASE:
+      rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+
+      rc = rtems_rfs_file_io_release_borrow (file, borrow->handle);
+      if (rc > 0)
+        rc = rtems_rfs_rtems_error ("file-ioctl: release", rc);
+      else
+        borrow->handle = NULL;
+
+      rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+      return rc;
+
+    default:
+      return rtems_filesystem_default_ioctl (iop, request, buffer);
+  }
+}
+
 /**
  * This routine processes the lseek() system call.
  *
@@ -360,7 +627,7 @@ const rtems_filesystem_file_handlers_r rtems_rfs_rtems_file_handlers = {
   .close_h     = rtems_rfs_rtems_file_close,
   .read_h      = rtems_rfs_rtems_file_read,
   .write_h     = rtems_rfs_rtems_file_write,
-  .ioctl_h     = rtems_filesystem_default_ioctl,
+  .ioctl_h     = rtems_rfs_rtems_file_ioctl,
   .lseek_h     = rtems_rfs_rtems_file_lseek,
   .fstat_h     = rtems_rfs_rtems_fstat,
   .ftruncate_h = rtems_rfs_rtems_file_ftruncate,
@@ -369,7 +636,8 @@ const rtems_filesystem_file_handlers_r rtems_rfs_rtems_file_handlers = {
   .fcntl_h     = rtems_filesystem_default_fcntl,
   .kqfilter_h  = rtems_filesystem_default_kqfilter,
   .mmap_h      = rtems_filesystem_default_mmap,
+  .munmap_h    = rtems_filesystem_default_munmap,
   .poll_h      = rtems_filesystem_default_poll,
-  .readv_h     = rtems_filesystem_default_readv,
-  .writev_h    = rtems_filesystem_default_writev
+  .readv_h     = rtems_rfs_rtems_file_readv,
+  .writev_h    = rtems_rfs_rtems_file_writev
 };
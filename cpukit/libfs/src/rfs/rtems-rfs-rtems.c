@@ -121,6 +121,58 @@ static void rtems_rfs_rtems_follow_link(
   }
 }
 
+/**
+ * Look up a name in a directory. The path lookup cache of the file system
+ * instance is used if present. The directory entry offset is cached with the
+ * ino so that the delete of the entry removes this name and not another hard
+ * link to the ino. The removal of an entry moves the other entries of the
+ * directory, so the cache entries of the directory are invalidated after each
+ * removal.
+ */
+static int
+rtems_rfs_rtems_dir_lookup_ino (rtems_filesystem_mount_table_entry_t* mt_entry,
+                                rtems_rfs_file_system*                fs,
+                                rtems_rfs_inode_handle*               inode,
+                                const char*                           name,
+                                size_t                                length,
+                                rtems_rfs_ino*                        ino,
+                                uint32_t*                             offset)
+{
+  uintptr_t dir_key = rtems_rfs_inode_ino (inode);
+  uintptr_t node;
+  uintptr_t node_2;
+  int       rc;
+
+  switch (rtems_filesystem_lookup_cache_find (mt_entry, dir_key, name, length,
+                                              &node, &node_2))
+  {
+    case RTEMS_FILESYSTEM_LOOKUP_CACHE_POSITIVE:
+      *ino = (rtems_rfs_ino) node;
+      *offset = (uint32_t) node_2;
+      return 0;
+    case RTEMS_FILESYSTEM_LOOKUP_CACHE_NEGATIVE:
+      return ENOENT;
+    default:
+      break;
+  }
+
+  rc = rtems_rfs_dir_lookup_ino (fs, inode, name, length, ino, offset);
+  if (rc == 0)
+    rtems_filesystem_lookup_cache_enter (mt_entry, dir_key, name, length,
+                                         true, *ino, *offset);
+  else if (rc == ENOENT)
+    rtems_filesystem_lookup_cache_enter (mt_entry, dir_key, name, length,
+                                         false, 0, 0);
+
+  return rc;
+}
+
+static uintptr_t
+rtems_rfs_rtems_lookup_cache_key (const rtems_filesystem_location_info_t* loc)
+{
+  return rtems_rfs_rtems_get_pathloc_ino (loc);
+}
+
 static rtems_filesystem_eval_path_generic_status
 rtems_rfs_rtems_eval_token(
   rtems_filesystem_eval_path_context_t *ctx,
@@ -143,7 +195,8 @@ rtems_rfs_rtems_eval_token(
       rtems_rfs_file_system* fs = rtems_rfs_rtems_pathloc_dev (currentloc);
       rtems_rfs_ino entry_ino;
       uint32_t entry_doff;
-      int rc = rtems_rfs_dir_lookup_ino (
+      int rc = rtems_rfs_rtems_dir_lookup_ino (
+        currentloc->mt_entry,
         fs,
         inode,
         token,
@@ -591,6 +644,13 @@ rtems_rfs_rtems_rmnod (const rtems_filesystem_location_info_t* parent_pathloc,
             parent, doff, ino);
 
   rc = rtems_rfs_unlink (fs, parent, ino, doff, rtems_rfs_unlink_dir_if_empty);
+
+  /*
+   * The removal moves the other entries of the directory.  An error may occur
+   * after the removal, so invalidate the cached entries in any case.
+   */
+  rtems_filesystem_lookup_cache_invalidate_dir (parent_pathloc);
+
   if (rc)
   {
     return rtems_rfs_rtems_error ("rmnod: unlinking", rc);
@@ -661,6 +721,13 @@ rtems_rfs_rtems_rename(const rtems_filesystem_location_info_t* old_parent_loc,
    */
   rc = rtems_rfs_unlink (fs, old_parent, ino, doff,
                          rtems_rfs_unlink_dir_allowed);
+
+  /*
+   * The removal moves the other entries of the directory.  An error may occur
+   * after the removal, so invalidate the cached entries in any case.
+   */
+  rtems_filesystem_lookup_cache_invalidate_dir (old_parent_loc);
+
   if (rc)
   {
     return rtems_rfs_rtems_error ("rename: unlinking", rc);
@@ -720,6 +787,7 @@ const rtems_filesystem_file_handlers_r rtems_rfs_rtems_link_handlers =
   .fcntl_h     = rtems_filesystem_default_fcntl,
   .kqfilter_h  = rtems_filesystem_default_kqfilter,
   .mmap_h      = rtems_filesystem_default_mmap,
+  .munmap_h    = rtems_filesystem_default_munmap,
   .poll_h      = rtems_filesystem_default_poll,
   .readv_h     = rtems_filesystem_default_readv,
   .writev_h    = rtems_filesystem_default_writev
@@ -756,7 +824,8 @@ const rtems_filesystem_operations_table rtems_rfs_ops =
   .symlink_h      = rtems_rfs_rtems_symlink,
   .readlink_h     = rtems_rfs_rtems_readlink,
   .rename_h       = rtems_rfs_rtems_rename,
-  .statvfs_h      = rtems_rfs_rtems_statvfs
+  .statvfs_h      = rtems_rfs_rtems_statvfs,
+  .lookup_cache_key_h = rtems_rfs_rtems_lookup_cache_key
 };
 
 /**
@@ -771,6 +840,7 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
   rtems_rfs_file_system*   fs;
   uint32_t                 flags = 0;
   uint32_t                 max_held_buffers = RTEMS_RFS_FS_MAX_HELD_BUFFERS;
+  size_t                   lookup_cache_entries = 0;
   const char*              options = data;
   int                      rc;
 
@@ -786,11 +856,22 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
     else if (strncmp (options, "no-local-cache",
                       sizeof ("no-local-cache") - 1) == 0)
       flags |= RTEMS_RFS_FS_NO_LOCAL_CACHE;
+    else if (strncmp (options, "dir-index",
+                      sizeof ("dir-index") - 1) == 0)
+      flags |= RTEMS_RFS_FS_DIR_INDEX;
     else if (strncmp (options, "max-held-bufs",
                       sizeof ("max-held-bufs") - 1) == 0)
     {
       max_held_buffers = strtoul (options + sizeof ("max-held-bufs"), 0, 0);
     }
+    else if (strncmp (options, "lookup-cache",
+                      sizeof ("lookup-cache") - 1) == 0)
+    {
+      lookup_cache_entries = strtoul (options + sizeof ("lookup-cache"), 0, 0);
+      if (lookup_cache_entries == 0)
+        return rtems_rfs_rtems_error ("initialise: invalid lookup cache size",
+                                      EINVAL);
+    }
     else
       return rtems_rfs_rtems_error ("initialise: invalid option", EINVAL);
 
@@ -838,6 +919,20 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
   mt_entry->mt_fs_root->location.node_access = (void*) RTEMS_RFS_ROOT_INO;
   mt_entry->mt_fs_root->location.handlers    = &rtems_rfs_rtems_dir_handlers;
 
+  if (lookup_cache_entries > 0)
+  {
+    rc = rtems_filesystem_lookup_cache_create (mt_entry, lookup_cache_entries);
+    if (rc != 0)
+    {
+      rc = errno;
+      rtems_rfs_fs_close (fs);
+      rtems_rfs_mutex_unlock (&rtems->access);
+      rtems_rfs_mutex_destroy (&rtems->access);
+      free (rtems);
+      return rtems_rfs_rtems_error ("initialise: lookup cache", rc);
+    }
+  }
+
   rtems_rfs_rtems_unlock (fs);
 
   return 0;
@@ -178,9 +178,7 @@ void *mmap(
 
     /* Check to see if the mapping is valid for a regular file. */
     if ( S_ISREG( sb.st_mode )
-    /* FIXME: Should this be using strict inequality (>) comparisons? It would
-     * be valid to map a region exactly equal to the st_size, e.g. see below. */
-         && (( off >= sb.st_size ) || (( off + len ) >= sb.st_size ))) {
+         && (( off >= sb.st_size ) || (( off + len ) > sb.st_size ))) {
       errno = EOVERFLOW;
       return MAP_FAILED;
     }
@@ -311,6 +309,15 @@ void *mmap(
       free( mapping );
       return MAP_FAILED;
     }
+
+    /*
+     * The mapping refers to the memory of the file, so it keeps a reference
+     * to the file node.  The file descriptor may be closed and the file may
+     * be unlinked before munmap().
+     */
+    if ( !is_shared_shm ) {
+      rtems_filesystem_location_clone( &mapping->location, &iop->pathinfo );
+    }
   }
 
   rtems_chain_append_unprotected( &mmap_mappings, &mapping->node );
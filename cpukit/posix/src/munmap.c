@@ -41,6 +41,7 @@
 int munmap(void *addr, size_t len)
 {
   mmap_mapping     *mapping;
+  mmap_mapping     *removed;
   rtems_chain_node *node;
 
   /*
@@ -62,6 +63,8 @@ int munmap(void *addr, size_t len)
     return -1;
   }
 
+  removed = NULL;
+
   mmap_mappings_lock_obtain();
 
   node = rtems_chain_first (&mmap_mappings);
@@ -86,12 +89,38 @@ int munmap(void *addr, size_t len)
           free( mapping->addr );
         }
       }
-      free( mapping );
+
+      if ( mapping->location.mt_entry != NULL ) {
+        removed = mapping;
+      } else {
+        free( mapping );
+      }
       break;
     }
     node = rtems_chain_next( node );
   }
 
   mmap_mappings_lock_release( );
+
+  /*
+   * Release the file of a shared mapping outside of the mappings lock, since
+   * freeing the location may obtain the file system instance lock.
+   */
+  if ( removed != NULL ) {
+    const rtems_filesystem_file_handlers_r *handlers;
+
+    handlers = removed->location.handlers;
+
+    /* File systems built before the MUNMAP handler existed leave it NULL */
+    if ( handlers->munmap_h != NULL ) {
+      rtems_filesystem_instance_lock( &removed->location );
+      (*handlers->munmap_h)( &removed->location, removed->addr, removed->len );
+      rtems_filesystem_instance_unlock( &removed->location );
+    }
+
+    rtems_filesystem_location_free( &removed->location );
+    free( removed );
+  }
+
   return 0;
 }
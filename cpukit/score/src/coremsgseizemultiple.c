@@ -0,0 +1,141 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMessageQueue
+ *
+ * @brief This source file contains the implementation of
+ *   _CORE_message_queue_Seize_multiple().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/statesimpl.h>
+#include <rtems/score/threadimpl.h>
+
+static uint32_t _CORE_message_queue_Fetch_pending_messages(
+  CORE_message_queue_Control *the_message_queue,
+  char                       *buffer,
+  size_t                     *sizes,
+  uint32_t                    count
+)
+{
+  uint32_t done;
+
+  for ( done = 0; done < count; ++done ) {
+    CORE_message_queue_Buffer *the_message;
+
+    the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+    if ( the_message == NULL ) {
+      break;
+    }
+
+    /* Threads waiting with pending messages would be blocked senders */
+    _Assert( the_message_queue->Wait_queue.Queue.heads == NULL );
+
+    the_message_queue->number_of_pending_messages -= 1;
+    sizes[ done ] = the_message->size;
+    _CORE_message_queue_Copy_buffer(
+      the_message->buffer,
+      &buffer[ done * the_message_queue->maximum_message_size ],
+      the_message->size
+    );
+    _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+  }
+
+  return done;
+}
+
+Status_Control _CORE_message_queue_Seize_multiple(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                       *buffer,
+  size_t                     *sizes,
+  uint32_t                    count,
+  uint32_t                   *received,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+)
+{
+  uint32_t       done;
+  Status_Control status;
+
+  _Assert( count > 0 );
+
+  done = _CORE_message_queue_Fetch_pending_messages(
+    the_message_queue,
+    buffer,
+    sizes,
+    count
+  );
+
+  if ( done > 0 ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    *received = done;
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( !wait ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    *received = 0;
+    return STATUS_UNSATISFIED;
+  }
+
+  /*
+   * The senders copy the messages to the slots before they unblock us and
+   * return the count of copied messages in Wait.option.  The message queue may
+   * be deleted once we are unblocked, so it is not accessed afterwards.
+   */
+  executing->Wait.return_argument_second.mutable_object = buffer;
+  executing->Wait.return_argument = sizes;
+  executing->Wait.option = count;
+
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_MESSAGE
+  );
+  _Thread_queue_Enqueue(
+    &the_message_queue->Wait_queue.Queue,
+    the_message_queue->operations,
+    executing,
+    queue_context
+  );
+  status = _Thread_Wait_get_status( executing );
+
+  if ( status != STATUS_SUCCESSFUL ) {
+    *received = 0;
+    return status;
+  }
+
+  *received = executing->Wait.option;
+  return STATUS_SUCCESSFUL;
+}
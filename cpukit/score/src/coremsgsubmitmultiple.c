@@ -0,0 +1,187 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMessageQueue
+ *
+ * @brief This source file contains the implementation of
+ *   _CORE_message_queue_Submit_multiple().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/threaddispatch.h>
+
+/*
+ * Copies up to the count of messages to the slots offered by the first thread
+ * waiting to receive and unblocks the thread.
+ */
+static uint32_t _CORE_message_queue_Dequeue_receiver_multiple(
+  CORE_message_queue_Control *the_message_queue,
+  const char                 *message,
+  size_t                      size,
+  uint32_t                    count,
+  Thread_queue_Context       *queue_context
+)
+{
+  Thread_queue_Heads *heads;
+  Thread_Control     *the_thread;
+  char               *slots;
+  size_t             *sizes;
+  uint32_t            done;
+
+  /* There are no waiting receivers if there are pending messages */
+  if ( the_message_queue->number_of_pending_messages != 0 ) {
+    return 0;
+  }
+
+  heads = the_message_queue->Wait_queue.Queue.heads;
+  if ( heads == NULL ) {
+    return 0;
+  }
+
+  the_thread = ( *the_message_queue->operations->surrender )(
+    &the_message_queue->Wait_queue.Queue,
+    heads,
+    NULL,
+    queue_context
+  );
+
+  /* The receiver offers the count of its slots in Wait.option */
+  if ( count > the_thread->Wait.option ) {
+    count = the_thread->Wait.option;
+  }
+
+  slots = the_thread->Wait.return_argument_second.mutable_object;
+  sizes = the_thread->Wait.return_argument;
+
+  for ( done = 0; done < count; ++done ) {
+    sizes[ done ] = size;
+    _CORE_message_queue_Copy_buffer(
+      message,
+      &slots[ done * the_message_queue->maximum_message_size ],
+      size
+    );
+    message += size;
+  }
+
+  the_thread->Wait.option = count;
+  the_thread->Wait.count = (uint32_t) CORE_MESSAGE_QUEUE_SEND_REQUEST;
+
+  _Thread_queue_Resume(
+    &the_message_queue->Wait_queue.Queue,
+    the_thread,
+    queue_context
+  );
+
+  return count;
+}
+
+Status_Control _CORE_message_queue_Submit_multiple(
+  CORE_message_queue_Control *the_message_queue,
+  const void                 *buffer,
+  size_t                      size,
+  uint32_t                    count,
+  uint32_t                   *sent,
+  Thread_queue_Context       *queue_context
+)
+{
+  const char      *message;
+  uint32_t         done;
+  Per_CPU_Control *cpu_self;
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    *sent = 0;
+    return STATUS_MESSAGE_INVALID_SIZE;
+  }
+
+  message = buffer;
+  done = 0;
+
+  /*
+   * Defer the thread dispatch until all messages are submitted, so that the
+   * receivers unblocked by the first messages do not preempt the sender.
+   */
+  cpu_self = _Thread_queue_Dispatch_disable( queue_context );
+
+  while ( done < count ) {
+    uint32_t delivered;
+
+    delivered = _CORE_message_queue_Dequeue_receiver_multiple(
+      the_message_queue,
+      message,
+      size,
+      count - done,
+      queue_context
+    );
+    if ( delivered == 0 ) {
+      break;
+    }
+
+    done += delivered;
+    message += delivered * size;
+
+    _CORE_message_queue_Acquire( the_message_queue, queue_context );
+  }
+
+  while ( done < count ) {
+    CORE_message_queue_Buffer *the_message;
+
+    the_message =
+      _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+    if ( the_message == NULL ) {
+      break;
+    }
+
+    _CORE_message_queue_Insert_message(
+      the_message_queue,
+      the_message,
+      message,
+      size,
+      CORE_MESSAGE_QUEUE_SEND_REQUEST
+    );
+    ++done;
+    message += size;
+  }
+
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+  _Thread_Dispatch_enable( cpu_self );
+
+  *sent = done;
+
+  if ( done != count ) {
+    return STATUS_TOO_MANY;
+  }
+
+  return STATUS_SUCCESSFUL;
+}
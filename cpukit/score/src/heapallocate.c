@@ -218,6 +218,59 @@ static uintptr_t _Heap_Check_block(
   return 0;
 }
 
+static uintptr_t _Heap_Search_free_blocks(
+  Heap_Control *heap,
+  Heap_Block **block_ptr,
+  const Heap_Block *end,
+  uintptr_t block_size_floor,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  uint32_t *search_count
+)
+{
+  Heap_Block *block = *block_ptr;
+  uintptr_t alloc_begin = 0;
+
+  while ( block != end ) {
+    _HAssert( _Heap_Is_prev_used( block ) );
+
+    _Heap_Protection_block_check( heap, block );
+
+    /*
+     * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
+     * field.  Thus the value is about one unit larger than the real block
+     * size.  The greater than operator takes this into account.
+     */
+    if ( block->size_and_flag > block_size_floor ) {
+      if ( alignment == 0 ) {
+        alloc_begin = _Heap_Alloc_area_of_block( block );
+      } else {
+        alloc_begin = _Heap_Check_block(
+          heap,
+          block,
+          alloc_size,
+          alignment,
+          boundary
+        );
+      }
+    }
+
+    /* Statistics */
+    ++*search_count;
+
+    if ( alloc_begin != 0 ) {
+      break;
+    }
+
+    block = block->next;
+  }
+
+  *block_ptr = block;
+
+  return alloc_begin;
+}
+
 void *_Heap_Allocate_aligned_with_boundary(
   Heap_Control *heap,
   uintptr_t alloc_size,
@@ -252,39 +305,53 @@ void *_Heap_Allocate_aligned_with_boundary(
   do {
     Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
 
-    block = _Heap_Free_list_first( heap );
-    while ( block != free_list_tail ) {
-      _HAssert( _Heap_Is_prev_used( block ) );
-
-      _Heap_Protection_block_check( heap, block );
+    if ( heap->free_index == NULL ) {
+      block = _Heap_Free_list_first( heap );
+      alloc_begin = _Heap_Search_free_blocks(
+        heap,
+        &block,
+        free_list_tail,
+        block_size_floor,
+        alloc_size,
+        alignment,
+        boundary,
+        &search_count
+      );
+    } else {
+      Heap_Block *good_fit;
+      Heap_Block *first;
 
       /*
-       * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
-       * field.  Thus the value is about one unit larger than the real block
-       * size.  The greater than operator takes this into account.
+       * The blocks of the greater size classes are big enough in any case.
+       * Search the size class of the requested size only if none of them
+       * satisfies the alignment and boundary constraints.
        */
-      if ( block->size_and_flag > block_size_floor ) {
-        if ( alignment == 0 ) {
-          alloc_begin = _Heap_Alloc_area_of_block( block );
-        } else {
-          alloc_begin = _Heap_Check_block(
-            heap,
-            block,
-            alloc_size,
-            alignment,
-            boundary
-          );
-        }
-      }
-
-      /* Statistics */
-      ++search_count;
-
-      if ( alloc_begin != 0 ) {
-        break;
+      first = _Heap_Free_index_search( heap, block_size_floor, &good_fit );
+      block = good_fit;
+      alloc_begin = _Heap_Search_free_blocks(
+        heap,
+        &block,
+        free_list_tail,
+        block_size_floor,
+        alloc_size,
+        alignment,
+        boundary,
+        &search_count
+      );
+
+      if ( alloc_begin == 0 ) {
+        block = first;
+        alloc_begin = _Heap_Search_free_blocks(
+          heap,
+          &block,
+          good_fit,
+          block_size_floor,
+          alloc_size,
+          alignment,
+          boundary,
+          &search_count
+        );
       }
-
-      block = block->next;
     }
 
     search_again = _Heap_Protection_free_delayed_blocks( heap, alloc_begin );
@@ -0,0 +1,209 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreHeap
+ *
+ * @brief This source file contains the implementation of
+ *   _Heap_Free_index_enable(), _Heap_Free_index_insert(),
+ *   _Heap_Free_index_remove(), and _Heap_Free_index_search().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/heapimpl.h>
+
+#include <string.h>
+
+static uint32_t _Heap_Free_index_first_bit( unsigned long map )
+{
+  return (uint32_t) __builtin_ctzl( map );
+}
+
+/*
+ * Returns the first block of the smallest non-empty size class greater than
+ * the size class ( fl, sl ), otherwise the free list tail.
+ */
+static Heap_Block *_Heap_Free_index_next_first(
+  const Heap_Free_index *index,
+  uint32_t fl,
+  uint32_t sl,
+  Heap_Block *free_list_tail
+)
+{
+  uint32_t sl_map;
+  uintptr_t fl_map;
+
+  sl_map = index->second_level_map[ fl ] & ( UINT32_MAX << ( sl + 1 ) );
+
+  if ( sl_map != 0 ) {
+    return index->first[ fl ][ _Heap_Free_index_first_bit( sl_map ) ];
+  }
+
+  if ( fl + 1 >= HEAP_FREE_INDEX_FIRST_LEVEL_COUNT ) {
+    return free_list_tail;
+  }
+
+  fl_map = index->first_level_map & ( UINTPTR_MAX << ( fl + 1 ) );
+
+  if ( fl_map == 0 ) {
+    return free_list_tail;
+  }
+
+  fl = _Heap_Free_index_first_bit( fl_map );
+  sl = _Heap_Free_index_first_bit( index->second_level_map[ fl ] );
+
+  return index->first[ fl ][ sl ];
+}
+
+void _Heap_Free_index_insert(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t block_size
+)
+{
+  Heap_Free_index *const index = heap->free_index;
+  Heap_Block *next;
+  uint32_t fl;
+  uint32_t sl;
+
+  _HAssert( block_size >= heap->min_block_size );
+
+  _Heap_Free_index_mapping( block_size, &fl, &sl );
+  next = index->first[ fl ][ sl ];
+
+  if ( next == NULL ) {
+    /*
+     * The size class is empty.  Insert the block in front of the next greater
+     * non-empty size class to keep the free list sorted by size class.
+     */
+    next = _Heap_Free_index_next_first(
+      index,
+      fl,
+      sl,
+      _Heap_Free_list_tail( heap )
+    );
+    index->first_level_map |= (uintptr_t) 1 << fl;
+    index->second_level_map[ fl ] |= UINT32_C( 1 ) << sl;
+  }
+
+  index->first[ fl ][ sl ] = block;
+  _Heap_Free_list_insert_before( next, block );
+}
+
+void _Heap_Free_index_remove( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Free_index *const index = heap->free_index;
+  uint32_t fl;
+  uint32_t sl;
+
+  _Heap_Free_index_mapping( _Heap_Block_size( block ), &fl, &sl );
+
+  if ( index->first[ fl ][ sl ] == block ) {
+    Heap_Block *const next = block->next;
+    bool next_is_in_class = false;
+
+    if ( next != _Heap_Free_list_tail( heap ) ) {
+      uint32_t next_fl;
+      uint32_t next_sl;
+
+      _Heap_Free_index_mapping( _Heap_Block_size( next ), &next_fl, &next_sl );
+      next_is_in_class = ( next_fl == fl && next_sl == sl );
+    }
+
+    if ( next_is_in_class ) {
+      index->first[ fl ][ sl ] = next;
+    } else {
+      index->first[ fl ][ sl ] = NULL;
+      index->second_level_map[ fl ] &= ~( UINT32_C( 1 ) << sl );
+
+      if ( index->second_level_map[ fl ] == 0 ) {
+        index->first_level_map &= ~( (uintptr_t) 1 << fl );
+      }
+    }
+  }
+
+  _Heap_Free_list_remove( block );
+}
+
+Heap_Block *_Heap_Free_index_search(
+  Heap_Control *heap,
+  uintptr_t block_size,
+  Heap_Block **good_fit
+)
+{
+  Heap_Free_index *const index = heap->free_index;
+  Heap_Block *first;
+  uint32_t fl;
+  uint32_t sl;
+
+  /* All blocks are at least of the minimum block size */
+  block_size = _Heap_Max( block_size, heap->min_block_size );
+
+  _Heap_Free_index_mapping( block_size, &fl, &sl );
+  *good_fit = _Heap_Free_index_next_first(
+    index,
+    fl,
+    sl,
+    _Heap_Free_list_tail( heap )
+  );
+  first = index->first[ fl ][ sl ];
+
+  if ( first == NULL ) {
+    first = *good_fit;
+  }
+
+  return first;
+}
+
+void _Heap_Free_index_enable( Heap_Control *heap, Heap_Free_index *index )
+{
+  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  Heap_Block *block;
+
+  if ( heap->free_index != NULL ) {
+    return;
+  }
+
+  memset( index, 0, sizeof( *index ) );
+
+  block = _Heap_Free_list_first( heap );
+  _Heap_Free_list_head( heap )->next = free_list_tail;
+  free_list_tail->prev = _Heap_Free_list_head( heap );
+  heap->free_index = index;
+
+  while ( block != free_list_tail ) {
+    Heap_Block *const next = block->next;
+
+    _Heap_Free_index_insert( heap, block, _Heap_Block_size( block ) );
+    block = next;
+  }
+}
@@ -139,6 +139,80 @@ static bool _Heap_Walk_check_free_list(
   return true;
 }
 
+static bool _Heap_Walk_check_free_index(
+  int source,
+  Heap_Walk_printer printer,
+  Heap_Control *heap
+)
+{
+  const Heap_Free_index *const index = heap->free_index;
+  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  const Heap_Block *free_block = _Heap_Free_list_first( heap );
+  uint32_t prev_fl = 0;
+  uint32_t prev_sl = 0;
+  uint32_t class_count = 0;
+  uint32_t map_count = 0;
+  uint32_t fl;
+
+  while ( free_block != free_list_tail ) {
+    uint32_t sl;
+
+    _Heap_Free_index_mapping( _Heap_Block_size( free_block ), &fl, &sl );
+
+    if ( fl < prev_fl || ( fl == prev_fl && sl < prev_sl ) ) {
+      (*printer)(
+        source,
+        true,
+        "free block 0x%08x: not sorted by size class\n",
+        free_block
+      );
+
+      return false;
+    }
+
+    if ( class_count == 0 || fl != prev_fl || sl != prev_sl ) {
+      if (
+        index->first[ fl ][ sl ] != free_block
+          || ( index->second_level_map[ fl ] & ( UINT32_C( 1 ) << sl ) ) == 0
+          || ( index->first_level_map & ( (uintptr_t) 1 << fl ) ) == 0
+      ) {
+        (*printer)(
+          source,
+          true,
+          "free block 0x%08x: not first block of size class in index\n",
+          free_block
+        );
+
+        return false;
+      }
+
+      ++class_count;
+    }
+
+    prev_fl = fl;
+    prev_sl = sl;
+    free_block = free_block->next;
+  }
+
+  for ( fl = 0; fl < HEAP_FREE_INDEX_FIRST_LEVEL_COUNT; ++fl ) {
+    map_count += (uint32_t) __builtin_popcount( index->second_level_map[ fl ] );
+  }
+
+  if ( map_count != class_count ) {
+    (*printer)(
+      source,
+      true,
+      "free index: %u non-empty size classes expected, %u found\n",
+      map_count,
+      class_count
+    );
+
+    return false;
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_is_in_free_list(
   Heap_Control *heap,
   Heap_Block *block
@@ -256,7 +330,15 @@ static bool _Heap_Walk_check_control(
     return false;
   }
 
-  return _Heap_Walk_check_free_list( source, printer, heap );
+  if ( !_Heap_Walk_check_free_list( source, printer, heap ) ) {
+    return false;
+  }
+
+  if ( heap->free_index != NULL ) {
+    return _Heap_Walk_check_free_index( source, printer, heap );
+  }
+
+  return true;
 }
 
 static bool _Heap_Walk_check_free_block(
@@ -2341,6 +2341,22 @@ _Timecounter_Tick(void)
 	_Watchdog_Tick(cpu_self);
 }
 
+void
+_Timecounter_Tick_multiple(uint32_t ticks)
+{
+	Per_CPU_Control *cpu_self = _Per_CPU_Get();
+
+#if defined(RTEMS_SMP)
+	if (_Per_CPU_Is_boot_processor(cpu_self)) {
+#endif
+		tc_windup(NULL);
+#if defined(RTEMS_SMP)
+	}
+#endif
+
+	_Watchdog_Tick_multiple(cpu_self, ticks);
+}
+
 void
 _Timecounter_Tick_simple(uint32_t delta, uint32_t offset,
     ISR_lock_Context *lock_context)
@@ -68,6 +68,7 @@
 
 #include <rtems/score/schedulerstrongapa.h>
 #include <rtems/score/schedulersmpimpl.h>
+#include <rtems/score/prioritybitmapimpl.h>
 #include <rtems/score/assert.h>
 
 #define STRONG_SCHEDULER_NODE_OF_CHAIN( node ) \
@@ -91,50 +92,179 @@ _Scheduler_strong_APA_Node_downcast( Scheduler_Node *node )
   return (Scheduler_strong_APA_Node *) node;
 }
 
+static inline unsigned int _Scheduler_strong_APA_Ready_index(
+  Scheduler_strong_APA_Node *node
+)
+{
+  Priority_Control priority;
+
+  priority = _Scheduler_SMP_Node_priority( &node->Base.Base );
+  priority = SCHEDULER_PRIORITY_UNMAP( priority );
+  _Assert( priority <= SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY );
+
+  return (unsigned int) priority;
+}
+
+/*
+ * Appends the node to the Ready chain of its priority and to the Ready chains
+ * of this priority of the cpus in its affinity set.  The priority and
+ * affinity of the node shall not change while it is on the Ready chain.
+ */
+static inline void _Scheduler_strong_APA_Ready_append(
+  Scheduler_strong_APA_Context *self,
+  Scheduler_strong_APA_Node    *node
+)
+{
+  Scheduler_strong_APA_CPU *CPU;
+  unsigned int              index;
+  uint32_t                  cpu_max;
+  uint32_t                  cpu_index;
+
+  CPU = self->CPU;
+  index = _Scheduler_strong_APA_Ready_index( node );
+  node->ready_index = index;
+  node->ready_order = self->ready_order;
+  ++self->ready_order;
+  ++self->ready_node_count;
+  _Chain_Append_unprotected( &self->Ready[ index ], &node->Ready_node );
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &node->Affinity, cpu_index ) ) {
+      Chain_Control *ready;
+
+      ready = &CPU[ cpu_index ].Ready[ index ];
+
+      if ( _Chain_Is_empty( ready ) ) {
+        Priority_bit_map_Information bit_map_info;
+
+        _Priority_bit_map_Initialize_information(
+          &CPU[ cpu_index ].Bit_map,
+          &bit_map_info,
+          index
+        );
+        _Priority_bit_map_Add( &CPU[ cpu_index ].Bit_map, &bit_map_info );
+      }
+
+      _Chain_Append_unprotected( ready, &node->Affinity_nodes[ cpu_index ] );
+    }
+  }
+}
+
+static inline void _Scheduler_strong_APA_Ready_extract(
+  Scheduler_strong_APA_Context *self,
+  Scheduler_strong_APA_Node    *node
+)
+{
+  Scheduler_strong_APA_CPU *CPU;
+  unsigned int              index;
+  uint32_t                  cpu_max;
+  uint32_t                  cpu_index;
+
+  CPU = self->CPU;
+  index = node->ready_index;
+  _Assert( self->ready_node_count > 0 );
+  --self->ready_node_count;
+  _Chain_Extract_unprotected( &node->Ready_node );
+  _Chain_Set_off_chain( &node->Ready_node );
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &node->Affinity, cpu_index ) ) {
+      Chain_Control *ready;
+
+      ready = &CPU[ cpu_index ].Ready[ index ];
+      _Chain_Extract_unprotected( &node->Affinity_nodes[ cpu_index ] );
+
+      if ( _Chain_Is_empty( ready ) ) {
+        Priority_bit_map_Information bit_map_info;
+
+        _Priority_bit_map_Initialize_information(
+          &CPU[ cpu_index ].Bit_map,
+          &bit_map_info,
+          index
+        );
+        _Priority_bit_map_Remove( &CPU[ cpu_index ].Bit_map, &bit_map_info );
+      }
+    }
+  }
+}
+
 static inline void _Scheduler_strong_APA_Do_update(
   Scheduler_Context *context,
   Scheduler_Node    *node,
   Priority_Control   new_priority
 )
 {
-  Scheduler_SMP_Node *smp_node;
-  (void) context;
+  Scheduler_strong_APA_Context *self;
+  Scheduler_strong_APA_Node    *strong_node;
+  Scheduler_SMP_Node           *smp_node;
 
+  self = _Scheduler_strong_APA_Get_self( context );
+  strong_node = _Scheduler_strong_APA_Node_downcast( node );
   smp_node = _Scheduler_SMP_Node_downcast( node );
-  _Scheduler_SMP_Node_update_priority( smp_node, new_priority );
+
+  if ( _Chain_Is_node_off_chain( &strong_node->Ready_node ) ) {
+    _Scheduler_SMP_Node_update_priority( smp_node, new_priority );
+  } else {
+    /* Move the node to the Ready chain of the new priority */
+    _Scheduler_strong_APA_Ready_extract( self, strong_node );
+    _Scheduler_SMP_Node_update_priority( smp_node, new_priority );
+    _Scheduler_strong_APA_Ready_append( self, strong_node );
+  }
 }
 
 /*
  * Returns true if the Strong APA scheduler has ready nodes
  * available for scheduling.
+ *
+ * The Ready chains contain only ready and scheduled nodes.  The scheduled
+ * nodes on the Ready chains are executing on the processors of the
+ * scheduler, so they can be counted through the executing node of each
+ * processor.
  */
 static inline bool _Scheduler_strong_APA_Has_ready(
   Scheduler_Context *context
 )
 {
   Scheduler_strong_APA_Context *self;
-  const Chain_Node             *tail;
-  Chain_Node                   *next;
-  Scheduler_strong_APA_Node    *node;
+  Scheduler_strong_APA_CPU     *CPU;
+  uint32_t                      scheduled_count;
+  uint32_t                      cpu_max;
+  uint32_t                      cpu_index;
 
   self = _Scheduler_strong_APA_Get_self( context );
-  tail = _Chain_Immutable_tail( &self->Ready );
-  next = _Chain_First( &self->Ready );
+  CPU = self->CPU;
+  scheduled_count = 0;
+  cpu_max = _SMP_Get_processor_maximum();
 
-  while ( next != tail ) {
-    node = (Scheduler_strong_APA_Node *)STRONG_SCHEDULER_NODE_OF_CHAIN( next );
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    Scheduler_Node            *executing;
+    Scheduler_strong_APA_Node *node;
+
+    if ( !_Processor_mask_Is_set( &self->Base.Base.Processors, cpu_index ) ) {
+      continue;
+    }
+
+    executing = CPU[ cpu_index ].executing;
+
+    if ( executing == NULL ) {
+      continue;
+    }
+
+    node = _Scheduler_strong_APA_Node_downcast( executing );
 
     if (
-      _Scheduler_SMP_Node_state( &node->Base.Base ) ==
-      SCHEDULER_SMP_NODE_READY
+      !_Chain_Is_node_off_chain( &node->Ready_node ) &&
+      _Scheduler_SMP_Node_state( executing ) == SCHEDULER_SMP_NODE_SCHEDULED
     ) {
-      return true;
+      ++scheduled_count;
     }
-
-    next = _Chain_Next( next );
   }
 
-  return false;
+  return self->ready_node_count > scheduled_count;
 }
 
 static inline void _Scheduler_strong_APA_Set_scheduled(
@@ -175,9 +305,82 @@ static inline void _Scheduler_strong_APA_Allocate_processor(
   );
 }
 
+/*
+ * Returns the first cpu in the _Strong_APA_Context->CPU queue up to rear which
+ * is in the affinity set of the node, or NULL if no such cpu exists.
+ */
+static inline Per_CPU_Control *_Scheduler_strong_APA_Get_first_reachable(
+  const Scheduler_strong_APA_Context *self,
+  const Scheduler_strong_APA_Node    *node,
+  uint32_t                            rear
+)
+{
+  const Scheduler_strong_APA_CPU *CPU;
+  uint32_t                        queue_index;
+
+  CPU = self->CPU;
+
+  for ( queue_index = 0 ; queue_index <= rear ; ++queue_index ) {
+    Per_CPU_Control *cpu = CPU[ queue_index ].cpu;
+
+    if ( _Processor_mask_Is_set( &node->Affinity, _Per_CPU_Get_index( cpu ) ) ) {
+      return cpu;
+    }
+  }
+
+  return NULL;
+}
+
+/*
+ * Returns the first ready node on the Ready chain of the index of the cpu.
+ * Only the scheduled nodes, at most one for each processor, are skipped.
+ */
+static inline Scheduler_strong_APA_Node *_Scheduler_strong_APA_First_ready(
+  Scheduler_strong_APA_CPU *CPU,
+  uint32_t                  cpu_index,
+  unsigned int              index
+)
+{
+  const Chain_Node *tail;
+  Chain_Node       *next;
+
+  tail = _Chain_Immutable_tail( &CPU[ cpu_index ].Ready[ index ] );
+  next = _Chain_First( &CPU[ cpu_index ].Ready[ index ] );
+
+  while ( next != tail ) {
+    Scheduler_strong_APA_Node *node;
+
+    node = RTEMS_CONTAINER_OF(
+      next - cpu_index,
+      Scheduler_strong_APA_Node,
+      Affinity_nodes[ 0 ]
+    );
+
+    if (
+      _Scheduler_SMP_Node_state( &node->Base.Base ) ==
+      SCHEDULER_SMP_NODE_READY
+    ) {
+      return node;
+    }
+
+    next = _Chain_Next( next );
+  }
+
+  return NULL;
+}
+
 /*
  * Finds and returns the highest ready node present by accessing the
  * _Strong_APA_Context->CPU with front and rear values.
+ *
+ * The queue starts with the cpus from front to rear and is extended by the
+ * cpus of the scheduled nodes which have a queued cpu in their affinity set.
+ * The scheduled nodes are found through the executing node of each cpu, so
+ * this walk depends only on the processor count.  The bit maps of the queued
+ * cpus then yield the highest priority with a ready or scheduled node which
+ * can be reached.  From this priority on, the first ready nodes of the Ready
+ * chains of the queued cpus are compared, and the one which arrived first
+ * is selected.
  */
 static inline Scheduler_Node * _Scheduler_strong_APA_Find_highest_ready(
   Scheduler_strong_APA_Context *self,
@@ -185,75 +388,121 @@ static inline Scheduler_Node * _Scheduler_strong_APA_Find_highest_ready(
   uint32_t                      rear
 )
 {
-  Scheduler_Node              *highest_ready = NULL;
   Scheduler_strong_APA_CPU    *CPU;
-  const Chain_Node            *tail;
-  Chain_Node                  *next;
-  Scheduler_strong_APA_Node   *node;
-  Priority_Control             min_priority_num;
-  Priority_Control             curr_priority;
-  Per_CPU_Control             *assigned_cpu;
-  Scheduler_SMP_Node_state     curr_state;
   Per_CPU_Control             *curr_CPU;
+  uint32_t                     cpu_max;
+  uint32_t                     cpu_index;
+  uint32_t                     queue_index;
+  unsigned int                 index;
+  unsigned int                 highest_index;
 
   CPU = self->CPU;
-  /*
-   * When the first task accessed has nothing to compare its priority against.
-   * So, it is the task with the highest priority witnessed so far.
-   */
-  min_priority_num = UINT64_MAX;
+  cpu_max = _SMP_Get_processor_maximum();
 
   while ( front <= rear ) {
     curr_CPU = CPU[ front++ ].cpu;
 
-    tail = _Chain_Immutable_tail( &self->Ready );
-    next = _Chain_First( &self->Ready );
+    for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+      Scheduler_Node            *executing;
+      Scheduler_strong_APA_Node *node;
+      Per_CPU_Control           *assigned_cpu;
+
+      if (
+        CPU[ cpu_index ].visited ||
+        !_Processor_mask_Is_set( &self->Base.Base.Processors, cpu_index )
+      ) {
+        continue;
+      }
+
+      executing = CPU[ cpu_index ].executing;
+
+      if ( executing == NULL ) {
+        continue;
+      }
+
+      node = _Scheduler_strong_APA_Node_downcast( executing );
+      assigned_cpu = _Per_CPU_Get_by_index( cpu_index );
 
-    while ( next != tail ) {
-      node = (Scheduler_strong_APA_Node*) STRONG_SCHEDULER_NODE_OF_CHAIN( next );
       /*
-       * Check if the curr_CPU is in the affinity set of the node.
+       * Only scheduled nodes on the Ready chains are considered, this
+       * excludes the idle nodes.  Check if the curr_CPU is in the affinity
+       * set of the node.
        */
       if (
-        _Processor_mask_Is_set( &node->Affinity, _Per_CPU_Get_index( curr_CPU ) )
+        !_Chain_Is_node_off_chain( &node->Ready_node ) &&
+        _Scheduler_SMP_Node_state( executing ) ==
+          SCHEDULER_SMP_NODE_SCHEDULED &&
+        _Thread_Get_CPU( executing->user ) == assigned_cpu &&
+        _Processor_mask_Is_set(
+          &node->Affinity,
+          _Per_CPU_Get_index( curr_CPU )
+        )
       ) {
-        curr_state = _Scheduler_SMP_Node_state( &node->Base.Base );
-
-        if ( curr_state == SCHEDULER_SMP_NODE_SCHEDULED ) {
-          assigned_cpu = _Thread_Get_CPU( node->Base.Base.user );
-
-          if ( CPU[ _Per_CPU_Get_index( assigned_cpu ) ].visited == false ) {
-            CPU[ ++rear ].cpu = assigned_cpu;
-            CPU[ _Per_CPU_Get_index( assigned_cpu ) ].visited = true;
-            /*
-             * The curr CPU of the queue invoked this node to add its CPU
-             * that it is executing on to the queue. So this node might get
-             * preempted because of the invoker curr_CPU and this curr_CPU
-             * is the CPU that node should preempt in case this node
-             * gets preempted.
-             */
-            node->cpu_to_preempt = curr_CPU;
-          }
-        } else if ( curr_state == SCHEDULER_SMP_NODE_READY ) {
-          curr_priority = _Scheduler_Node_get_priority( &node->Base.Base );
-          curr_priority = SCHEDULER_PRIORITY_PURIFY( curr_priority );
+        CPU[ ++rear ].cpu = assigned_cpu;
+        CPU[ cpu_index ].visited = true;
+        /*
+         * The curr CPU of the queue invoked this node to add its CPU
+         * that it is executing on to the queue. So this node might get
+         * preempted because of the invoker curr_CPU and this curr_CPU
+         * is the CPU that node should preempt in case this node
+         * gets preempted.
+         */
+        node->cpu_to_preempt = curr_CPU;
+      }
+    }
+  }
 
-          if (
-            min_priority_num == UINT64_MAX ||
-            curr_priority < min_priority_num
-          ) {
-            min_priority_num = curr_priority;
-            highest_ready = &node->Base.Base;
-            /*
-             * In case curr_CPU is filter_CPU, we need to store the
-             * cpu_to_preempt value so that we go back to SMP_*
-             * function, rather than preempting the node ourselves.
-             */
-            node->cpu_to_preempt = curr_CPU;
-          }
-        }
+  highest_index = SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY + 1;
+
+  for ( queue_index = 0 ; queue_index <= rear ; ++queue_index ) {
+    Priority_bit_map_Control *bit_map;
+
+    cpu_index = _Per_CPU_Get_index( CPU[ queue_index ].cpu );
+    bit_map = &CPU[ cpu_index ].Bit_map;
+
+    if ( !_Priority_bit_map_Is_empty( bit_map ) ) {
+      index = _Priority_bit_map_Get_highest( bit_map );
+
+      if ( index < highest_index ) {
+        highest_index = index;
       }
-    next = _Chain_Next( next );
+    }
+  }
+
+  for (
+    index = highest_index ;
+    index <= SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY ;
+    ++index
+  ) {
+    Scheduler_strong_APA_Node *highest_ready;
+
+    highest_ready = NULL;
+
+    for ( queue_index = 0 ; queue_index <= rear ; ++queue_index ) {
+      Scheduler_strong_APA_Node *node;
+
+      cpu_index = _Per_CPU_Get_index( CPU[ queue_index ].cpu );
+      node = _Scheduler_strong_APA_First_ready( CPU, cpu_index, index );
+
+      if (
+        node != NULL &&
+        ( highest_ready == NULL ||
+          (int32_t) ( node->ready_order - highest_ready->ready_order ) < 0 )
+      ) {
+        highest_ready = node;
+      }
+    }
+
+    if ( highest_ready != NULL ) {
+      /*
+       * In case cpu is filter_CPU, we need to store the
+       * cpu_to_preempt value so that we go back to SMP_*
+       * function, rather than preempting the node ourselves.
+       */
+      highest_ready->cpu_to_preempt =
+        _Scheduler_strong_APA_Get_first_reachable( self, highest_ready, rear );
+      _Assert( highest_ready->cpu_to_preempt != NULL );
+      return &highest_ready->Base.Base;
     }
   }
 
@@ -261,50 +510,48 @@ static inline Scheduler_Node * _Scheduler_strong_APA_Find_highest_ready(
    * By definition, the system would always have a ready node,
    * hence highest_ready would not be NULL.
    */
-  _Assert( highest_ready != NULL );
+  _Assert( false );
 
-  return highest_ready;
+  return NULL;
 }
 
 static inline Scheduler_Node *_Scheduler_strong_APA_Get_idle( void *arg )
 {
   Scheduler_strong_APA_Context *self;
-  Scheduler_strong_APA_Node    *lowest_ready = NULL;
-  Priority_Control              max_priority_num;
-  const Chain_Node             *tail;
-  Chain_Node                   *next;
+  unsigned int                  index;
 
   self = _Scheduler_strong_APA_Get_self( arg );
-  tail = _Chain_Immutable_tail( &self->Ready );
-  next = _Chain_First( &self->Ready );
-  max_priority_num = 0;
+  index = SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY + 1;
 
-  while ( next != tail ) {
-    Scheduler_strong_APA_Node *node;
-    Scheduler_SMP_Node_state   curr_state;
+  /* The idle nodes are on the Ready chain of the lowest priority */
+  while ( index > 0 ) {
+    const Chain_Node *tail;
+    Chain_Node       *next;
+
+    --index;
+    tail = _Chain_Immutable_tail( &self->Ready[ index ] );
+    next = _Chain_First( &self->Ready[ index ] );
 
-    node = (Scheduler_strong_APA_Node*) STRONG_SCHEDULER_NODE_OF_CHAIN( next );
-    curr_state = _Scheduler_SMP_Node_state( &node->Base.Base );
+    while ( next != tail ) {
+      Scheduler_strong_APA_Node *node;
+      Scheduler_SMP_Node_state   curr_state;
 
-    if ( curr_state == SCHEDULER_SMP_NODE_READY ) {
-      Priority_Control curr_priority;
+      node = (Scheduler_strong_APA_Node*) STRONG_SCHEDULER_NODE_OF_CHAIN( next );
+      curr_state = _Scheduler_SMP_Node_state( &node->Base.Base );
 
-      curr_priority = _Scheduler_Node_get_priority( &node->Base.Base );
+      if ( curr_state == SCHEDULER_SMP_NODE_READY ) {
+        _Scheduler_strong_APA_Ready_extract( self, node );
 
-      if ( curr_priority > max_priority_num ) {
-        max_priority_num = curr_priority;
-        lowest_ready = node;
+        return &node->Base.Base;
       }
-    }
 
-    next = _Chain_Next( next );
+      next = _Chain_Next( next );
+    }
   }
 
-  _Assert( lowest_ready != NULL );
-  _Chain_Extract_unprotected( &lowest_ready->Ready_node );
-  _Chain_Set_off_chain( &lowest_ready->Ready_node );
+  _Assert( false );
 
-  return &lowest_ready->Base.Base;
+  return NULL;
 }
 
 static inline void _Scheduler_strong_APA_Release_idle(
@@ -319,7 +566,7 @@ static inline void _Scheduler_strong_APA_Release_idle(
   node = _Scheduler_strong_APA_Node_downcast( node_base );
 
   if ( _Chain_Is_node_off_chain( &node->Ready_node ) ) {
-    _Chain_Append_unprotected( &self->Ready, &node->Ready_node );
+    _Scheduler_strong_APA_Ready_append( self, node );
   }
 }
 
@@ -351,13 +598,11 @@ static inline void _Scheduler_strong_APA_Insert_ready(
   self = _Scheduler_strong_APA_Get_self( context );
   node = _Scheduler_strong_APA_Node_downcast( node_base );
 
-  if( _Chain_Is_node_off_chain( &node->Ready_node ) ) {
-    _Chain_Append_unprotected( &self->Ready, &node->Ready_node );
-  }  else {
-    _Chain_Extract_unprotected( &node->Ready_node );
-    _Chain_Set_off_chain( &node->Ready_node );
-    _Chain_Append_unprotected( &self->Ready, &node->Ready_node );
+  if( !_Chain_Is_node_off_chain( &node->Ready_node ) ) {
+    _Scheduler_strong_APA_Ready_extract( self, node );
   }
+
+  _Scheduler_strong_APA_Ready_append( self, node );
 }
 
 static inline void _Scheduler_strong_APA_Move_from_scheduled_to_ready(
@@ -537,7 +782,19 @@ static inline void _Scheduler_strong_APA_Extract_from_scheduled(
   node = _Scheduler_strong_APA_Node_downcast( node_to_extract );
 
   _Scheduler_SMP_Extract_from_scheduled( &self->Base.Base, &node->Base.Base );
-  /* Not removing it from Ready since the node could go in the READY state */
+
+  /*
+   * Not removing it from Ready since the node could go in the READY state,
+   * unless it is blocked.  The Ready chains shall contain only ready and
+   * scheduled nodes.
+   */
+  if (
+    !_Chain_Is_node_off_chain( &node->Ready_node ) &&
+    _Scheduler_SMP_Node_state( node_to_extract ) ==
+      SCHEDULER_SMP_NODE_BLOCKED
+  ) {
+    _Scheduler_strong_APA_Ready_extract( self, node );
+  }
 }
 
 static inline void _Scheduler_strong_APA_Extract_from_ready(
@@ -545,15 +802,15 @@ static inline void _Scheduler_strong_APA_Extract_from_ready(
   Scheduler_Node    *node_to_extract
 )
 {
+  Scheduler_strong_APA_Context *self;
   Scheduler_strong_APA_Node    *node;
 
+  self = _Scheduler_strong_APA_Get_self( context );
   node = _Scheduler_strong_APA_Node_downcast( node_to_extract );
 
   if( !_Chain_Is_node_off_chain( &node->Ready_node ) ) {
-    _Chain_Extract_unprotected( &node->Ready_node );
-    _Chain_Set_off_chain( &node->Ready_node );
+    _Scheduler_strong_APA_Ready_extract( self, node );
   }
-
 }
 
 static inline Scheduler_Node* _Scheduler_strong_APA_Get_lowest_reachable(
@@ -861,19 +1118,49 @@ static inline  void  _Scheduler_strong_APA_Do_set_affinity(
   void              *arg
 )
 {
-  Scheduler_strong_APA_Node *node;
+  Scheduler_strong_APA_Context *self;
+  Scheduler_strong_APA_Node    *node;
 
+  self = _Scheduler_strong_APA_Get_self( context );
   node = _Scheduler_strong_APA_Node_downcast( node_base );
-  node->Affinity = *( (const Processor_mask *) arg );
+
+  if ( _Chain_Is_node_off_chain( &node->Ready_node ) ) {
+    node->Affinity = *( (const Processor_mask *) arg );
+  } else {
+    /* Account for the node in the bit maps of the new affinity set */
+    _Scheduler_strong_APA_Ready_extract( self, node );
+    node->Affinity = *( (const Processor_mask *) arg );
+    _Scheduler_strong_APA_Ready_append( self, node );
+  }
 }
 
 void _Scheduler_strong_APA_Initialize( const Scheduler_Control *scheduler )
 {
   Scheduler_strong_APA_Context *self =
       _Scheduler_strong_APA_Get_context( scheduler );
+  unsigned int                  index;
+  uint32_t                      cpu_index;
 
   _Scheduler_SMP_Initialize( &self->Base );
-  _Chain_Initialize_empty( &self->Ready );
+
+  for ( index = 0 ; index <= SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY ; ++index ) {
+    _Chain_Initialize_empty( &self->Ready[ index ] );
+  }
+
+  /* The bit maps of the cpus are zero initialized */
+  for (
+    cpu_index = 0 ;
+    cpu_index < _SMP_Processor_configured_maximum ;
+    ++cpu_index
+  ) {
+    for (
+      index = 0 ;
+      index <= SCHEDULER_STRONG_APA_MAXIMUM_PRIORITY ;
+      ++index
+    ) {
+      _Chain_Initialize_empty( &self->CPU[ cpu_index ].Ready[ index ] );
+    }
+  }
 }
 
 void _Scheduler_strong_APA_Yield(
@@ -1042,7 +1329,7 @@ void _Scheduler_strong_APA_Clean_sticky(
     scheduler,
     the_thread,
     node,
-    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_strong_APA_Extract_from_scheduled,
     _Scheduler_strong_APA_Extract_from_ready,
     _Scheduler_strong_APA_Get_highest_ready,
     _Scheduler_strong_APA_Move_from_ready_to_scheduled,
@@ -1160,8 +1447,10 @@ Status_Control _Scheduler_strong_APA_Set_affinity(
   if ( _Processor_mask_Is_equal( &node->Affinity, affinity ) )
     return STATUS_SUCCESSFUL;	/* Nothing to do. Return true. */
 
- _Processor_mask_Assign( &node->Affinity, &local_affinity );
-
+ /*
+  * The affinity set is changed by _Scheduler_strong_APA_Do_set_affinity()
+  * since the node may be on a Ready chain.
+  */
  _Scheduler_SMP_Set_affinity(
    context,
    thread,
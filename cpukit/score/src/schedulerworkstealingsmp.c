@@ -0,0 +1,844 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerWorkStealingSMP
+ *
+ * @brief This source file contains the implementation of
+ *   _Scheduler_work_stealing_SMP_Add_processor(),
+ *   _Scheduler_work_stealing_SMP_Ask_for_help(),
+ *   _Scheduler_work_stealing_SMP_Block(),
+ *   _Scheduler_work_stealing_SMP_Clean_sticky(),
+ *   _Scheduler_work_stealing_SMP_Initialize(),
+ *   _Scheduler_work_stealing_SMP_Make_sticky(),
+ *   _Scheduler_work_stealing_SMP_Node_initialize(),
+ *   _Scheduler_work_stealing_SMP_Reconsider_help_request(),
+ *   _Scheduler_work_stealing_SMP_Remove_processor(),
+ *   _Scheduler_work_stealing_SMP_Start_idle(),
+ *   _Scheduler_work_stealing_SMP_Unblock(),
+ *   _Scheduler_work_stealing_SMP_Update_priority(),
+ *   _Scheduler_work_stealing_SMP_Withdraw_node(), and
+ *   _Scheduler_work_stealing_SMP_Yield().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/schedulerworkstealingsmp.h>
+#include <rtems/score/processormaskimpl.h>
+#include <rtems/score/schedulersmpimpl.h>
+
+static inline Scheduler_work_stealing_SMP_Context *
+_Scheduler_work_stealing_SMP_Get_context( const Scheduler_Control *scheduler )
+{
+  return (Scheduler_work_stealing_SMP_Context *)
+    _Scheduler_Get_context( scheduler );
+}
+
+static inline Scheduler_work_stealing_SMP_Context *
+_Scheduler_work_stealing_SMP_Get_self( Scheduler_Context *context )
+{
+  return (Scheduler_work_stealing_SMP_Context *) context;
+}
+
+static inline Scheduler_work_stealing_SMP_Node *
+_Scheduler_work_stealing_SMP_Node_downcast( Scheduler_Node *node )
+{
+  return (Scheduler_work_stealing_SMP_Node *) node;
+}
+
+static inline bool _Scheduler_work_stealing_SMP_Is_idle(
+  const Scheduler_Node *node
+)
+{
+  return _Scheduler_Node_get_owner( node )->is_idle;
+}
+
+static inline bool _Scheduler_work_stealing_SMP_Priority_less_equal(
+  const void        *left,
+  const RBTree_Node *right
+)
+{
+  const Priority_Control   *the_left;
+  const Scheduler_SMP_Node *the_right;
+  Priority_Control          prio_left;
+  Priority_Control          prio_right;
+
+  the_left = left;
+  the_right = RTEMS_CONTAINER_OF( right, Scheduler_SMP_Node, Base.Node.RBTree );
+
+  prio_left = *the_left;
+  prio_right = the_right->priority;
+
+  return prio_left <= prio_right;
+}
+
+void _Scheduler_work_stealing_SMP_Initialize(
+  const Scheduler_Control *scheduler
+)
+{
+  Scheduler_work_stealing_SMP_Context *self =
+    _Scheduler_work_stealing_SMP_Get_context( scheduler );
+
+  _Scheduler_SMP_Initialize( &self->Base );
+  _Chain_Initialize_empty( &self->Idle );
+  /* The ready queues are zero initialized and thus empty */
+}
+
+void _Scheduler_work_stealing_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+)
+{
+  Scheduler_work_stealing_SMP_Node *the_node;
+
+  the_node = _Scheduler_work_stealing_SMP_Node_downcast( node );
+  _Scheduler_SMP_Node_initialize(
+    scheduler,
+    &the_node->Base,
+    the_thread,
+    priority
+  );
+
+  /* The home processor is selected by the first enqueue of the node */
+  the_node->home_index = UINT32_MAX;
+  the_node->ready_queue_index = 0;
+}
+
+static inline void _Scheduler_work_stealing_SMP_Do_update(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   new_priority
+)
+{
+  Scheduler_SMP_Node *smp_node;
+
+  (void) context;
+
+  smp_node = _Scheduler_SMP_Node_downcast( node );
+  _Scheduler_SMP_Node_update_priority( smp_node, new_priority );
+}
+
+static inline bool _Scheduler_work_stealing_SMP_Is_owned(
+  const Scheduler_work_stealing_SMP_Context *self,
+  uint32_t                                   cpu_index
+)
+{
+  return cpu_index < _SMP_Get_processor_maximum() &&
+    _Processor_mask_Is_set( &self->Base.Base.Processors, cpu_index );
+}
+
+static inline uint32_t _Scheduler_work_stealing_SMP_Get_home(
+  Scheduler_work_stealing_SMP_Context *self,
+  Scheduler_work_stealing_SMP_Node    *node
+)
+{
+  uint32_t home_index;
+
+  home_index = node->home_index;
+
+  if (
+    RTEMS_PREDICT_FALSE(
+      !_Scheduler_work_stealing_SMP_Is_owned( self, home_index )
+    )
+  ) {
+    home_index = _Per_CPU_Get_index( _Per_CPU_Get() );
+
+    if ( !_Scheduler_work_stealing_SMP_Is_owned( self, home_index ) ) {
+      _Assert( !_Processor_mask_Is_zero( &self->Base.Base.Processors ) );
+      home_index =
+        _Processor_mask_Find_last_set( &self->Base.Base.Processors ) - 1;
+    }
+
+    node->home_index = home_index;
+  }
+
+  return home_index;
+}
+
+static inline bool _Scheduler_work_stealing_SMP_Has_ready(
+  Scheduler_Context *context
+)
+{
+  Scheduler_work_stealing_SMP_Context *self;
+  uint32_t                             cpu_max;
+  uint32_t                             cpu_index;
+
+  self = _Scheduler_work_stealing_SMP_Get_self( context );
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    if ( !_RBTree_Is_empty( &self->Ready[ cpu_index ].Queue ) ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static inline Scheduler_work_stealing_SMP_Node *
+_Scheduler_work_stealing_SMP_Get_remote_highest_ready(
+  Scheduler_work_stealing_SMP_Context *self,
+  uint32_t                             local_index
+)
+{
+  Scheduler_work_stealing_SMP_Node *highest_ready;
+  uint32_t                          cpu_max;
+  uint32_t                          cpu_index;
+
+  highest_ready = NULL;
+  cpu_max = _SMP_Get_processor_maximum();
+
+  /*
+   * The ready queues of processors not owned by this scheduler instance are
+   * empty, see _Scheduler_work_stealing_SMP_Remove_processor().
+   */
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    Scheduler_work_stealing_SMP_Node *other;
+
+    if (
+      cpu_index == local_index ||
+      _RBTree_Is_empty( &self->Ready[ cpu_index ].Queue )
+    ) {
+      continue;
+    }
+
+    other = (Scheduler_work_stealing_SMP_Node *)
+      _RBTree_Minimum( &self->Ready[ cpu_index ].Queue );
+
+    if (
+      highest_ready == NULL ||
+      other->Base.priority < highest_ready->Base.priority
+    ) {
+      highest_ready = other;
+    }
+  }
+
+  return highest_ready;
+}
+
+static inline Scheduler_Node *_Scheduler_work_stealing_SMP_Get_highest_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter
+)
+{
+  Scheduler_work_stealing_SMP_Context     *self;
+  Scheduler_work_stealing_SMP_Ready_queue *local;
+  Scheduler_work_stealing_SMP_Node        *highest_ready;
+  Scheduler_work_stealing_SMP_Node        *remote;
+  uint32_t                                 local_index;
+
+  /*
+   * The filter node is a scheduled node which is no longer on the scheduled
+   * chain.  Its home processor is the processor which is about to select a
+   * new node.
+   */
+  self = _Scheduler_work_stealing_SMP_Get_self( context );
+  local_index = _Scheduler_work_stealing_SMP_Get_home(
+    self,
+    _Scheduler_work_stealing_SMP_Node_downcast( filter )
+  );
+  local = &self->Ready[ local_index ];
+
+  if ( !_RBTree_Is_empty( &local->Queue ) ) {
+    highest_ready = (Scheduler_work_stealing_SMP_Node *)
+      _RBTree_Minimum( &local->Queue );
+
+    if ( self->steal_period == 0 ) {
+      return &highest_ready->Base.Base;
+    }
+
+    ++local->selections;
+
+    if ( local->selections < self->steal_period ) {
+      return &highest_ready->Base.Base;
+    }
+
+    local->selections = 0;
+  } else {
+    highest_ready = NULL;
+  }
+
+  remote = _Scheduler_work_stealing_SMP_Get_remote_highest_ready(
+    self,
+    local_index
+  );
+
+  if (
+    remote != NULL && (
+      highest_ready == NULL ||
+      remote->Base.priority + SCHEDULER_PRIORITY_MAP( self->migration_cost )
+        < highest_ready->Base.priority
+    )
+  ) {
+    ++local->steals;
+    return &remote->Base.Base;
+  }
+
+  if ( highest_ready != NULL ) {
+    return &highest_ready->Base.Base;
+  }
+
+  _Assert( !_Chain_Is_empty( &self->Idle ) );
+  return (Scheduler_Node *) _Chain_First( &self->Idle );
+}
+
+static inline Scheduler_Node *_Scheduler_work_stealing_SMP_Get_lowest_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter_base
+)
+{
+  Scheduler_work_stealing_SMP_Context *self;
+  Scheduler_work_stealing_SMP_Node    *filter;
+  Scheduler_work_stealing_SMP_Node    *home;
+  Scheduler_Node                      *lowest_scheduled;
+  uint32_t                             home_index;
+  Priority_Control                     priority;
+
+  self = _Scheduler_work_stealing_SMP_Get_self( context );
+  filter = _Scheduler_work_stealing_SMP_Node_downcast( filter_base );
+  home_index = _Scheduler_work_stealing_SMP_Get_home( self, filter );
+  home = self->Ready[ home_index ].allocated;
+  _Assert( home != NULL );
+  _Assert(
+    _Scheduler_SMP_Node_state( &home->Base.Base ) ==
+      SCHEDULER_SMP_NODE_SCHEDULED
+  );
+
+  if ( _Scheduler_work_stealing_SMP_Is_idle( &home->Base.Base ) ) {
+    return &home->Base.Base;
+  }
+
+  /*
+   * The idle threads have the lowest priority, so in case a processor is idle,
+   * then the lowest scheduled node is the node of an idle thread.
+   */
+  lowest_scheduled = _Scheduler_SMP_Get_lowest_scheduled( context, filter_base );
+
+  if ( _Scheduler_work_stealing_SMP_Is_idle( lowest_scheduled ) ) {
+    return lowest_scheduled;
+  }
+
+  priority = filter->Base.priority;
+
+  if ( priority < home->Base.priority ) {
+    return &home->Base.Base;
+  }
+
+  if (
+    priority + SCHEDULER_PRIORITY_MAP( self->migration_cost ) <
+      _Scheduler_SMP_Node_priority( lowest_scheduled )
+  ) {
+    return lowest_scheduled;
+  }
+
+  /*
+   * The node does not preempt the node on its home processor, so it is
+   * inserted into the ready queue of its home processor.
+   */
+  return &home->Base.Base;
+}
+
+static inline void _Scheduler_work_stealing_SMP_Insert_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_base,
+  Priority_Control   insert_priority
+)
+{
+  Scheduler_work_stealing_SMP_Context *self;
+  Scheduler_work_stealing_SMP_Node    *node;
+  uint32_t                             rqi;
+
+  self = _Scheduler_work_stealing_SMP_Get_self( context );
+
+  if ( _Scheduler_work_stealing_SMP_Is_idle( node_base ) ) {
+    _Chain_Append_unprotected( &self->Idle, &node_base->Node.Chain );
+    return;
+  }
+
+  node = _Scheduler_work_stealing_SMP_Node_downcast( node_base );
+  rqi = _Scheduler_work_stealing_SMP_Get_home( self, node );
+  node->ready_queue_index = rqi;
+
+  _RBTree_Initialize_node( &node->Base.Base.Node.RBTree );
+  _RBTree_Insert_inline(
+    &self->Ready[ rqi ].Queue,
+    &node->Base.Base.Node.RBTree,
+    &insert_priority,
+    _Scheduler_work_stealing_SMP_Priority_less_equal
+  );
+}
+
+static inline void _Scheduler_work_stealing_SMP_Extract_from_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_extract
+)
+{
+  Scheduler_work_stealing_SMP_Context *self;
+  Scheduler_work_stealing_SMP_Node    *node;
+
+  self = _Scheduler_work_stealing_SMP_Get_self( context );
+
+  if ( _Scheduler_work_stealing_SMP_Is_idle( node_to_extract ) ) {
+    _Chain_Extract_unprotected( &node_to_extract->Node.Chain );
+  } else {
+    node = _Scheduler_work_stealing_SMP_Node_downcast( node_to_extract );
+    _RBTree_Extract(
+      &self->Ready[ node->ready_queue_index ].Queue,
+      &node->Base.Base.Node.RBTree
+    );
+  }
+
+  _Chain_Initialize_node( &node_to_extract->Node.Chain );
+}
+
+static inline void _Scheduler_work_stealing_SMP_Move_from_scheduled_to_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled_to_ready
+)
+{
+  Priority_Control insert_priority;
+
+  _Scheduler_SMP_Extract_from_scheduled( context, scheduled_to_ready );
+  insert_priority = _Scheduler_SMP_Node_priority( scheduled_to_ready );
+  _Scheduler_work_stealing_SMP_Insert_ready(
+    context,
+    scheduled_to_ready,
+    insert_priority
+  );
+}
+
+static inline void _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *ready_to_scheduled
+)
+{
+  Priority_Control insert_priority;
+
+  _Scheduler_work_stealing_SMP_Extract_from_ready(
+    context,
+    ready_to_scheduled
+  );
+  insert_priority = _Scheduler_SMP_Node_priority( ready_to_scheduled );
+  insert_priority = SCHEDULER_PRIORITY_APPEND( insert_priority );
+  _Scheduler_SMP_Insert_scheduled(
+    context,
+    ready_to_scheduled,
+    insert_priority
+  );
+}
+
+static inline Scheduler_Node *_Scheduler_work_stealing_SMP_Get_idle(
+  void *arg
+)
+{
+  Scheduler_work_stealing_SMP_Context *self;
+  Scheduler_Node                      *idle;
+
+  self = _Scheduler_work_stealing_SMP_Get_self( arg );
+  idle = (Scheduler_Node *) _Chain_Get_first_unprotected( &self->Idle );
+  _Chain_Initialize_node( &idle->Node.Chain );
+
+  return idle;
+}
+
+static inline void _Scheduler_work_stealing_SMP_Release_idle(
+  Scheduler_Node *node,
+  void           *arg
+)
+{
+  Scheduler_work_stealing_SMP_Context *self;
+
+  self = _Scheduler_work_stealing_SMP_Get_self( arg );
+  _Chain_Append_unprotected( &self->Idle, &node->Node.Chain );
+}
+
+static inline void _Scheduler_work_stealing_SMP_Set_allocated(
+  Scheduler_work_stealing_SMP_Context *self,
+  Scheduler_work_stealing_SMP_Node    *allocated,
+  const Per_CPU_Control               *cpu
+)
+{
+  uint32_t cpu_index;
+
+  cpu_index = _Per_CPU_Get_index( cpu );
+  allocated->home_index = cpu_index;
+  self->Ready[ cpu_index ].allocated = allocated;
+}
+
+static inline void _Scheduler_work_stealing_SMP_Allocate_processor(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled_base,
+  Per_CPU_Control   *cpu
+)
+{
+  Scheduler_work_stealing_SMP_Context *self;
+
+  self = _Scheduler_work_stealing_SMP_Get_self( context );
+  _Scheduler_work_stealing_SMP_Set_allocated(
+    self,
+    _Scheduler_work_stealing_SMP_Node_downcast( scheduled_base ),
+    cpu
+  );
+  _Scheduler_SMP_Allocate_processor_exact( context, scheduled_base, cpu );
+}
+
+void _Scheduler_work_stealing_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Block(
+    context,
+    thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Get_highest_ready,
+    _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_work_stealing_SMP_Allocate_processor,
+    _Scheduler_work_stealing_SMP_Get_idle
+  );
+}
+
+static inline bool _Scheduler_work_stealing_SMP_Enqueue(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   insert_priority
+)
+{
+  return _Scheduler_SMP_Enqueue(
+    context,
+    node,
+    insert_priority,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_work_stealing_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_work_stealing_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_work_stealing_SMP_Get_lowest_scheduled,
+    _Scheduler_work_stealing_SMP_Allocate_processor,
+    _Scheduler_work_stealing_SMP_Get_idle,
+    _Scheduler_work_stealing_SMP_Release_idle
+  );
+}
+
+static inline void _Scheduler_work_stealing_SMP_Enqueue_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   insert_priority
+)
+{
+  _Scheduler_SMP_Enqueue_scheduled(
+    context,
+    node,
+    insert_priority,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Get_highest_ready,
+    _Scheduler_work_stealing_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_work_stealing_SMP_Allocate_processor,
+    _Scheduler_work_stealing_SMP_Get_idle,
+    _Scheduler_work_stealing_SMP_Release_idle
+  );
+}
+
+void _Scheduler_work_stealing_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Unblock(
+    context,
+    thread,
+    node,
+    _Scheduler_work_stealing_SMP_Do_update,
+    _Scheduler_work_stealing_SMP_Enqueue,
+    _Scheduler_work_stealing_SMP_Release_idle
+  );
+}
+
+static inline bool _Scheduler_work_stealing_SMP_Do_ask_for_help(
+  Scheduler_Context *context,
+  Thread_Control    *the_thread,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_SMP_Ask_for_help(
+    context,
+    the_thread,
+    node,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_work_stealing_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_work_stealing_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_work_stealing_SMP_Get_lowest_scheduled,
+    _Scheduler_work_stealing_SMP_Allocate_processor,
+    _Scheduler_work_stealing_SMP_Release_idle
+  );
+}
+
+void _Scheduler_work_stealing_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Update_priority(
+    context,
+    thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Do_update,
+    _Scheduler_work_stealing_SMP_Enqueue,
+    _Scheduler_work_stealing_SMP_Enqueue_scheduled,
+    _Scheduler_work_stealing_SMP_Do_ask_for_help
+  );
+}
+
+bool _Scheduler_work_stealing_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  return _Scheduler_work_stealing_SMP_Do_ask_for_help(
+    context,
+    the_thread,
+    node
+  );
+}
+
+void _Scheduler_work_stealing_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Reconsider_help_request(
+    context,
+    the_thread,
+    node,
+    _Scheduler_work_stealing_SMP_Extract_from_ready
+  );
+}
+
+void _Scheduler_work_stealing_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Withdraw_node(
+    context,
+    the_thread,
+    node,
+    next_state,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Get_highest_ready,
+    _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_work_stealing_SMP_Allocate_processor,
+    _Scheduler_work_stealing_SMP_Get_idle
+  );
+}
+
+void _Scheduler_work_stealing_SMP_Make_sticky(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  _Scheduler_SMP_Make_sticky(
+    scheduler,
+    the_thread,
+    node,
+    _Scheduler_work_stealing_SMP_Do_update,
+    _Scheduler_work_stealing_SMP_Enqueue
+  );
+}
+
+void _Scheduler_work_stealing_SMP_Clean_sticky(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  _Scheduler_SMP_Clean_sticky(
+    scheduler,
+    the_thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Get_highest_ready,
+    _Scheduler_work_stealing_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_work_stealing_SMP_Allocate_processor,
+    _Scheduler_work_stealing_SMP_Get_idle,
+    _Scheduler_work_stealing_SMP_Release_idle
+  );
+}
+
+static inline void _Scheduler_work_stealing_SMP_Register_idle(
+  Scheduler_Context *context,
+  Scheduler_Node    *idle_base,
+  Per_CPU_Control   *cpu
+)
+{
+  Scheduler_work_stealing_SMP_Context *self;
+
+  self = _Scheduler_work_stealing_SMP_Get_self( context );
+  _Scheduler_work_stealing_SMP_Set_allocated(
+    self,
+    _Scheduler_work_stealing_SMP_Node_downcast( idle_base ),
+    cpu
+  );
+}
+
+void _Scheduler_work_stealing_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Add_processor(
+    context,
+    idle,
+    _Scheduler_work_stealing_SMP_Has_ready,
+    _Scheduler_work_stealing_SMP_Enqueue_scheduled,
+    _Scheduler_work_stealing_SMP_Register_idle
+  );
+}
+
+Thread_Control *_Scheduler_work_stealing_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_Context                       *context;
+  Scheduler_work_stealing_SMP_Context     *self;
+  Scheduler_work_stealing_SMP_Ready_queue *ready_queue;
+  Thread_Control                          *idle;
+
+  context = _Scheduler_Get_context( scheduler );
+  idle = _Scheduler_SMP_Remove_processor(
+    context,
+    cpu,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Enqueue,
+    _Scheduler_work_stealing_SMP_Get_idle,
+    _Scheduler_work_stealing_SMP_Release_idle
+  );
+
+  /*
+   * The processor is no longer owned by this scheduler instance, so the
+   * insert selects a new home processor for the nodes of its ready queue.
+   */
+  self = _Scheduler_work_stealing_SMP_Get_self( context );
+  ready_queue = &self->Ready[ _Per_CPU_Get_index( cpu ) ];
+
+  while ( !_RBTree_Is_empty( &ready_queue->Queue ) ) {
+    Scheduler_Node   *node;
+    Priority_Control  insert_priority;
+
+    node = (Scheduler_Node *) _RBTree_Minimum( &ready_queue->Queue );
+    _RBTree_Extract( &ready_queue->Queue, &node->Node.RBTree );
+    insert_priority = _Scheduler_SMP_Node_priority( node );
+    insert_priority = SCHEDULER_PRIORITY_APPEND( insert_priority );
+    _Scheduler_work_stealing_SMP_Insert_ready(
+      context,
+      node,
+      insert_priority
+    );
+  }
+
+  ready_queue->allocated = NULL;
+  ready_queue->selections = 0;
+
+  return idle;
+}
+
+void _Scheduler_work_stealing_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Yield(
+    context,
+    thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_work_stealing_SMP_Extract_from_ready,
+    _Scheduler_work_stealing_SMP_Enqueue,
+    _Scheduler_work_stealing_SMP_Enqueue_scheduled
+  );
+}
+
+void _Scheduler_work_stealing_SMP_Start_idle(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_Context *context;
+
+  context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Do_start_idle(
+    context,
+    idle,
+    cpu,
+    _Scheduler_work_stealing_SMP_Register_idle
+  );
+}
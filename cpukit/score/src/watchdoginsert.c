@@ -39,6 +39,39 @@
 #endif
 
 #include <rtems/score/watchdogimpl.h>
+#include <rtems/score/smpimpl.h>
+
+#if defined(RTEMS_SMP)
+static void _Watchdog_Wake_up_skipping_processor(
+  const Watchdog_Header  *header,
+  const Watchdog_Control *the_watchdog,
+  uint64_t                expire
+)
+{
+  Per_CPU_Control *cpu;
+
+  cpu = _Watchdog_Get_CPU( the_watchdog );
+
+  if ( RTEMS_PREDICT_TRUE( cpu->Watchdog.skip_until == 0 ) ) {
+    return;
+  }
+
+  if ( header == &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ] ) {
+    if ( expire >= cpu->Watchdog.skip_until ) {
+      return;
+    }
+  } else if ( header->first != &the_watchdog->Node.RBTree ) {
+    return;
+  }
+
+  /*
+   * The processor skips clock ticks and would perform the watchdog too late.
+   * The inter-processor interrupt ends the skipping, so that the processor
+   * considers this watchdog for its next clock tick interrupt.
+   */
+  _SMP_Send_message( cpu, 0 );
+}
+#endif
 
 void _Watchdog_Insert(
   Watchdog_Header  *header,
@@ -53,6 +86,14 @@ void _Watchdog_Insert(
 
   _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
 
+  if ( header->wheel != NULL ) {
+    _Watchdog_Wheel_insert( header->wheel, the_watchdog, expire );
+#if defined(RTEMS_SMP)
+    _Watchdog_Wake_up_skipping_processor( header, the_watchdog, expire );
+#endif
+    return;
+  }
+
   link = _RBTree_Root_reference( &header->Watchdogs );
   parent = NULL;
   old_first = header->first;
@@ -78,4 +119,8 @@ void _Watchdog_Insert(
   _RBTree_Initialize_node( &the_watchdog->Node.RBTree );
   _RBTree_Add_child( &the_watchdog->Node.RBTree, parent, link );
   _RBTree_Insert_color( &header->Watchdogs, &the_watchdog->Node.RBTree );
+
+#if defined(RTEMS_SMP)
+  _Watchdog_Wake_up_skipping_processor( header, the_watchdog, expire );
+#endif
 }
@@ -6,7 +6,7 @@
  * @ingroup RTEMSScoreWatchdog
  *
  * @brief This source file contains the implementation of
- *   _Watchdog_Do_tickle() and _Watchdog_Tick().
+ *   _Watchdog_Do_tickle(), _Watchdog_Tick(), and _Watchdog_Tick_multiple().
  */
 
 /*
@@ -40,6 +40,7 @@
 
 #include <rtems/score/watchdogimpl.h>
 #include <rtems/score/schedulerimpl.h>
+#include <rtems/score/smp.h>
 #include <rtems/score/threaddispatch.h>
 #include <rtems/score/timecounter.h>
 
@@ -73,7 +74,51 @@ void _Watchdog_Do_tickle(
   } while ( first != NULL );
 }
 
-void _Watchdog_Tick( Per_CPU_Control *cpu )
+#ifdef RTEMS_SMP
+Atomic_Uint _Watchdog_Skipping_processors;
+
+static void _Watchdog_Advance_skipping_processors( Per_CPU_Control *cpu_self )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  /*
+   * The ticks of a skipping processor are recomputed from scratch at each
+   * tick, so a missed tick due to a relaxed load is recovered at the next one.
+   */
+  if (
+    _Atomic_Load_uint( &_Watchdog_Skipping_processors, ATOMIC_ORDER_RELAXED )
+      == 0
+  ) {
+    return;
+  }
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Control  *cpu;
+    ISR_lock_Context  lock_context;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+
+    if ( cpu == cpu_self ) {
+      continue;
+    }
+
+    _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+
+    if ( cpu->Watchdog.skip_until != 0 ) {
+      cpu->Watchdog.ticks = cpu->Watchdog.skip_base +
+        (Watchdog_Interval) ( _Watchdog_Ticks_since_boot -
+          cpu->Watchdog.boot_ticks );
+    }
+
+    _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+  }
+}
+#endif
+
+static inline void _Watchdog_Do_tick( Per_CPU_Control *cpu, uint32_t elapsed )
 {
   ISR_lock_Context                    lock_context;
   Watchdog_Header                    *header;
@@ -86,29 +131,44 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
 #ifdef RTEMS_SMP
   if ( _Per_CPU_Is_boot_processor( cpu ) ) {
 #endif
-    ++_Watchdog_Ticks_since_boot;
+    _Watchdog_Ticks_since_boot += elapsed;
 #ifdef RTEMS_SMP
+    _Watchdog_Advance_skipping_processors( cpu );
   }
 #endif
 
   _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
 
   ticks = cpu->Watchdog.ticks;
-  _Assert( ticks < UINT64_MAX );
-  ++ticks;
+  _Assert( elapsed > 0 );
+  _Assert( ticks < UINT64_MAX - elapsed );
+  ticks += elapsed;
   cpu->Watchdog.ticks = ticks;
+#ifdef RTEMS_SMP
+  cpu->Watchdog.boot_ticks = _Watchdog_Ticks_since_boot;
+#endif
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
-  first = _Watchdog_Header_first( header );
 
-  if ( first != NULL ) {
-    _Watchdog_Tickle(
-      header,
-      first,
+  if ( header->wheel != NULL ) {
+    _Watchdog_Wheel_tickle(
+      header->wheel,
       ticks,
       &cpu->Watchdog.Lock,
       &lock_context
     );
+  } else {
+    first = _Watchdog_Header_first( header );
+
+    if ( first != NULL ) {
+      _Watchdog_Tickle(
+        header,
+        first,
+        ticks,
+        &cpu->Watchdog.Lock,
+        &lock_context
+      );
+    }
   }
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
@@ -154,3 +214,13 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
     ( *cpu_budget_operations->at_tick )( executing );
   }
 }
+
+void _Watchdog_Tick( Per_CPU_Control *cpu )
+{
+  _Watchdog_Do_tick( cpu, 1 );
+}
+
+void _Watchdog_Tick_multiple( Per_CPU_Control *cpu, uint32_t ticks )
+{
+  _Watchdog_Do_tick( cpu, ticks );
+}
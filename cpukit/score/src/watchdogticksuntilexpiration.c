@@ -0,0 +1,225 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief This source file contains the implementation of
+ *   _Watchdog_Ticks_until_expiration(), _Watchdog_Skip_ticks_begin(), and
+ *   _Watchdog_Skip_ticks_end().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/smp.h>
+#include <rtems/score/timecounter.h>
+
+static uint64_t _Watchdog_Minimum( uint64_t a, uint64_t b )
+{
+  return a < b ? a : b;
+}
+
+static uint64_t _Watchdog_Ticks_until_time(
+  uint64_t               expire,
+  const struct timespec *now
+)
+{
+  struct timespec ts;
+  int64_t         delta;
+
+  _Watchdog_Ticks_to_timespec( expire, &ts );
+
+  if ( ts.tv_sec - now->tv_sec >= (int64_t) UINT32_MAX ) {
+    return UINT64_MAX;
+  }
+
+  delta = ( ts.tv_sec - now->tv_sec ) * 1000000000;
+  delta += ts.tv_nsec - now->tv_nsec;
+
+  if ( delta <= 0 ) {
+    return 0;
+  }
+
+  /*
+   * The next clock tick occurs in at most one tick period, so the tick at the
+   * returned count is not later than the expiration time.
+   */
+  return (uint64_t) delta / _Watchdog_Nanoseconds_per_tick;
+}
+
+static uint32_t _Watchdog_Get_ticks_until_expiration(
+  const Per_CPU_Control *cpu,
+  uint32_t               maximum
+)
+{
+  const Watchdog_Header  *header;
+  const Watchdog_Control *first;
+  struct timespec         now;
+  uint64_t                ticks;
+  uint64_t                until;
+
+  _Assert( maximum > 0 );
+  until = maximum;
+
+  ticks = cpu->Watchdog.ticks;
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+
+  if ( header->wheel != NULL ) {
+    uint64_t next_expiration;
+
+    next_expiration = _Watchdog_Wheel_next_expiration( header->wheel );
+    _Assert( next_expiration > ticks );
+    until = _Watchdog_Minimum( until, next_expiration - ticks );
+  } else {
+    first = _Watchdog_Header_first( header );
+
+    if ( first != NULL ) {
+      if ( first->expire > ticks ) {
+        until = _Watchdog_Minimum( until, first->expire - ticks );
+      } else {
+        until = 1;
+      }
+    }
+  }
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
+  first = _Watchdog_Header_first( header );
+
+  if ( first != NULL ) {
+    _Timecounter_Nanouptime( &now );
+    until = _Watchdog_Minimum(
+      until,
+      _Watchdog_Ticks_until_time( first->expire, &now )
+    );
+  }
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ];
+  first = _Watchdog_Header_first( header );
+
+  if ( first != NULL ) {
+    _Timecounter_Nanotime( &now );
+    until = _Watchdog_Minimum(
+      until,
+      _Watchdog_Ticks_until_time( first->expire, &now )
+    );
+  }
+
+  if ( until == 0 ) {
+    until = 1;
+  }
+
+  return (uint32_t) until;
+}
+
+uint32_t _Watchdog_Ticks_until_expiration(
+  Per_CPU_Control *cpu,
+  uint32_t         maximum
+)
+{
+  ISR_lock_Context lock_context;
+  uint32_t         until;
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+  until = _Watchdog_Get_ticks_until_expiration( cpu, maximum );
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+
+  return until;
+}
+
+uint32_t _Watchdog_Skip_ticks_begin(
+  Per_CPU_Control *cpu,
+  uint32_t         maximum
+)
+{
+  ISR_lock_Context lock_context;
+  uint32_t         until;
+
+#if defined(RTEMS_SMP)
+  if (
+    _SMP_Get_processor_maximum() > 1 && _Per_CPU_Is_boot_processor( cpu )
+  ) {
+    return 1;
+  }
+#endif
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+  until = _Watchdog_Get_ticks_until_expiration( cpu, maximum );
+
+#if defined(RTEMS_SMP)
+  if ( until > 1 ) {
+    /*
+     * From now on, remote processors see that this processor skips ticks, see
+     * _Watchdog_Insert().  An inter-processor interrupt issued before the
+     * clock driver waits for an interrupt is pending and ends the wait.
+     */
+    cpu->Watchdog.skip_base = cpu->Watchdog.ticks;
+    cpu->Watchdog.skip_until = cpu->Watchdog.ticks + until;
+    _Atomic_Fetch_add_uint(
+      &_Watchdog_Skipping_processors,
+      1,
+      ATOMIC_ORDER_RELAXED
+    );
+  }
+#endif
+
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+
+  return until;
+}
+
+void _Watchdog_Skip_ticks_end( Per_CPU_Control *cpu )
+{
+#if defined(RTEMS_SMP)
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+  _Assert( cpu->Watchdog.skip_until != 0 );
+
+  /*
+   * The ticks advanced by the boot processor only approximate the ticks of
+   * this processor.  The ticks counted by the clock driver of this processor
+   * are performed by the caller.  Watchdogs inserted relative to the
+   * approximated ticks expire at most one tick later.
+   */
+  cpu->Watchdog.ticks = cpu->Watchdog.skip_base;
+  cpu->Watchdog.skip_until = 0;
+  _Atomic_Fetch_sub_uint(
+    &_Watchdog_Skipping_processors,
+    1,
+    ATOMIC_ORDER_RELAXED
+  );
+
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+#else
+  (void) cpu;
+#endif
+}
@@ -0,0 +1,312 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief This source file contains the implementation of
+ *   _Watchdog_Wheel_initialize(), _Watchdog_Wheel_initialize_per_CPU(),
+ *   _Watchdog_Wheel_insert(), _Watchdog_Wheel_next_expiration(), and
+ *   _Watchdog_Do_wheel_tickle().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/smp.h>
+
+/*
+ * The watchdog state is stored in the color of the red-black tree node.  It
+ * must not overlap with the chain node used for the timer wheel slots.
+ */
+RTEMS_STATIC_ASSERT(
+  offsetof( RBTree_Node, Node.rbe_color ) >= sizeof( Chain_Node ),
+  WATCHDOG_WHEEL_STATE
+);
+
+#define WATCHDOG_WHEEL_SLOT_MASK ( WATCHDOG_WHEEL_SLOTS - 1 )
+
+#define WATCHDOG_WHEEL_MAXIMUM_DELTA \
+  ( ( UINT64_C( 1 ) << \
+    ( WATCHDOG_WHEEL_LEVELS * WATCHDOG_WHEEL_LEVEL_BITS ) ) - 1 )
+
+void _Watchdog_Wheel_initialize( Watchdog_Wheel *wheel, uint64_t now )
+{
+  size_t level;
+  size_t index;
+
+  wheel->next = now + 1;
+  wheel->count = 0;
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVELS; ++level ) {
+    for ( index = 0; index < WATCHDOG_WHEEL_SLOTS; ++index ) {
+      _Chain_Initialize_empty( &wheel->Slots[ level ][ index ] );
+    }
+  }
+}
+
+void _Watchdog_Wheel_initialize_per_CPU( void )
+{
+  uint32_t cpu_index;
+
+  for (
+    cpu_index = 0;
+    cpu_index < _SMP_Processor_configured_maximum;
+    ++cpu_index
+  ) {
+    Per_CPU_Control *cpu;
+    Watchdog_Wheel  *wheel;
+    Watchdog_Header *header;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    wheel = &_Watchdog_Wheels[ cpu_index ];
+    header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+
+    _Assert( header->first == NULL );
+    _Watchdog_Wheel_initialize( wheel, cpu->Watchdog.ticks );
+    header->wheel = wheel;
+  }
+}
+
+static Chain_Control *_Watchdog_Wheel_slot(
+  Watchdog_Wheel *wheel,
+  uint64_t        expire
+)
+{
+  uint64_t next;
+  uint64_t delta;
+  size_t   level;
+  size_t   shift;
+  size_t   index;
+
+  next = wheel->next;
+
+  if ( expire < next ) {
+    expire = next;
+  }
+
+  delta = expire - next;
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVELS - 1; ++level ) {
+    if ( ( delta >> ( ( level + 1 ) * WATCHDOG_WHEEL_LEVEL_BITS ) ) == 0 ) {
+      break;
+    }
+  }
+
+  if ( delta > WATCHDOG_WHEEL_MAXIMUM_DELTA ) {
+    /*
+     * The watchdog is moved to the lower levels once the slot is processed.
+     * It ends up in the last level again if it is still too far away.
+     */
+    expire = next + WATCHDOG_WHEEL_MAXIMUM_DELTA;
+  }
+
+  shift = level * WATCHDOG_WHEEL_LEVEL_BITS;
+  index = (size_t) ( expire >> shift ) & WATCHDOG_WHEEL_SLOT_MASK;
+
+  return &wheel->Slots[ level ][ index ];
+}
+
+static void _Watchdog_Wheel_take_slot(
+  Chain_Control *slot,
+  Chain_Control *pending
+)
+{
+  Chain_Node *head;
+  Chain_Node *tail;
+  Chain_Node *first;
+  Chain_Node *last;
+
+  _Chain_Initialize_empty( pending );
+
+  if ( _Chain_Is_empty( slot ) ) {
+    return;
+  }
+
+  head = _Chain_Head( pending );
+  tail = _Chain_Tail( pending );
+  first = _Chain_First( slot );
+  last = _Chain_Last( slot );
+
+  head->next = first;
+  first->previous = head;
+  tail->previous = last;
+  last->next = tail;
+
+  _Chain_Initialize_empty( slot );
+}
+
+static void _Watchdog_Wheel_cascade( Watchdog_Wheel *wheel, uint64_t tick )
+{
+  size_t level;
+
+  for ( level = 1; level < WATCHDOG_WHEEL_LEVELS; ++level ) {
+    size_t        shift;
+    Chain_Control pending;
+
+    shift = level * WATCHDOG_WHEEL_LEVEL_BITS;
+
+    if ( ( tick & ( ( UINT64_C( 1 ) << shift ) - 1 ) ) != 0 ) {
+      break;
+    }
+
+    _Watchdog_Wheel_take_slot(
+      &wheel->Slots[ level ][ ( tick >> shift ) & WATCHDOG_WHEEL_SLOT_MASK ],
+      &pending
+    );
+
+    while ( !_Chain_Is_empty( &pending ) ) {
+      Watchdog_Control *the_watchdog;
+
+      the_watchdog = (Watchdog_Control *)
+        _Chain_Get_first_unprotected( &pending );
+      _Chain_Append_unprotected(
+        _Watchdog_Wheel_slot( wheel, the_watchdog->expire ),
+        &the_watchdog->Node.Chain
+      );
+    }
+  }
+}
+
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+)
+{
+  the_watchdog->expire = expire;
+  ++wheel->count;
+  _Watchdog_Set_state( the_watchdog, WATCHDOG_SCHEDULED_BLACK );
+  _Chain_Initialize_node( &the_watchdog->Node.Chain );
+  _Chain_Append_unprotected(
+    _Watchdog_Wheel_slot( wheel, expire ),
+    &the_watchdog->Node.Chain
+  );
+}
+
+uint64_t _Watchdog_Wheel_next_expiration( const Watchdog_Wheel *wheel )
+{
+  uint64_t next_expiration;
+  size_t   level;
+
+  if ( wheel->count == 0 ) {
+    return UINT64_MAX;
+  }
+
+  next_expiration = UINT64_MAX;
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVELS; ++level ) {
+    size_t   shift;
+    uint64_t step;
+    uint64_t tick;
+    size_t   i;
+
+    /*
+     * The slots of a higher level are processed only at ticks which are
+     * aligned to the range covered by one slot of this level.
+     */
+    shift = level * WATCHDOG_WHEEL_LEVEL_BITS;
+    step = UINT64_C( 1 ) << shift;
+    tick = ( wheel->next + step - 1 ) & ~( step - 1 );
+
+    for ( i = 0; i < WATCHDOG_WHEEL_SLOTS; ++i ) {
+      size_t index;
+
+      if ( tick >= next_expiration ) {
+        break;
+      }
+
+      index = (size_t) ( tick >> shift ) & WATCHDOG_WHEEL_SLOT_MASK;
+
+      if ( !_Chain_Is_empty( &wheel->Slots[ level ][ index ] ) ) {
+        next_expiration = tick;
+        break;
+      }
+
+      tick += step;
+    }
+  }
+
+  return next_expiration;
+}
+
+void _Watchdog_Do_wheel_tickle(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#ifdef RTEMS_SMP
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+)
+{
+  _Assert( now < UINT64_MAX );
+
+  while ( wheel->next <= now ) {
+    uint64_t      tick;
+    Chain_Control pending;
+
+    if ( wheel->count == 0 ) {
+      wheel->next = now + 1;
+      break;
+    }
+
+    tick = wheel->next;
+    _Watchdog_Wheel_cascade( wheel, tick );
+    _Watchdog_Wheel_take_slot(
+      &wheel->Slots[ 0 ][ tick & WATCHDOG_WHEEL_SLOT_MASK ],
+      &pending
+    );
+
+    /*
+     * Watchdogs inserted by the watchdog routines are placed relative to the
+     * next tick.  Watchdogs of the pending chain may be removed while the lock
+     * is released, see _Watchdog_Wheel_remove().
+     */
+    wheel->next = tick + 1;
+
+    while ( !_Chain_Is_empty( &pending ) ) {
+      Watchdog_Control               *the_watchdog;
+      Watchdog_Service_routine_entry  routine;
+
+      the_watchdog = (Watchdog_Control *)
+        _Chain_Get_first_unprotected( &pending );
+      _Assert( the_watchdog->expire <= tick );
+      _Assert( wheel->count > 0 );
+      --wheel->count;
+      _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+      routine = the_watchdog->routine;
+
+      _ISR_lock_Release_and_ISR_enable( lock, lock_context );
+      ( *routine )( the_watchdog );
+      _ISR_lock_ISR_disable_and_acquire( lock, lock_context );
+    }
+  }
+}
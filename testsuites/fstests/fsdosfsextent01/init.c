@@ -0,0 +1,318 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/dosfs.h>
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "FSDOSFSEXTENT 1";
+
+#define RDA "/dev/rda"
+
+#define MNT "/mnt"
+
+#define FILE_A MNT "/a"
+
+#define FILE_B MNT "/b"
+
+#define CLUSTER_SIZE 512
+
+/* More fragments than FAT_FILE_EXTENT_MAX */
+#define CLUSTER_COUNT 600
+
+#define TRUNCATE_COUNT 400
+
+#define GENERATION_INITIAL 0
+
+#define GENERATION_REWRITTEN 1
+
+static uint8_t cluster_buf [CLUSTER_SIZE];
+
+static uint8_t pattern(uint32_t cluster, uint32_t generation, size_t i)
+{
+  return (uint8_t) (cluster * 7 + generation * 131 + i + (cluster >> 8));
+}
+
+static void fill_cluster(uint32_t cluster, uint32_t generation)
+{
+  size_t i;
+
+  for (i = 0; i < CLUSTER_SIZE; ++i) {
+    cluster_buf [i] = pattern(cluster, generation, i);
+  }
+}
+
+static void mount_disk(void)
+{
+  int rv;
+
+  rv = mount_and_make_target_path(
+    RDA,
+    MNT,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void unmount_disk(void)
+{
+  int rv;
+
+  rv = unmount(MNT);
+  rtems_test_assert(rv == 0);
+}
+
+static void write_cluster(int fd, uint32_t cluster, uint32_t generation)
+{
+  ssize_t n;
+
+  fill_cluster(cluster, generation);
+  n = write(fd, cluster_buf, sizeof(cluster_buf));
+  rtems_test_assert(n == (ssize_t) sizeof(cluster_buf));
+}
+
+/*
+ * Read a part of the file which may cross a cluster boundary at a random
+ * position.
+ */
+static void check_at(
+  int fd,
+  off_t offset,
+  size_t size,
+  uint32_t first_rewritten
+)
+{
+  uint8_t buf [64];
+  off_t pos;
+  ssize_t n;
+  size_t i;
+
+  rtems_test_assert(size <= sizeof(buf));
+
+  pos = lseek(fd, offset, SEEK_SET);
+  rtems_test_assert(pos == offset);
+
+  n = read(fd, buf, size);
+  rtems_test_assert(n == (ssize_t) size);
+
+  for (i = 0; i < size; ++i) {
+    off_t o = offset + (off_t) i;
+    uint32_t cluster = (uint32_t) (o / CLUSTER_SIZE);
+    uint32_t generation = cluster >= first_rewritten ?
+      GENERATION_REWRITTEN : GENERATION_INITIAL;
+
+    rtems_test_assert(
+      buf [i] == pattern(cluster, generation, (size_t) (o % CLUSTER_SIZE))
+    );
+  }
+}
+
+static void check_seek(int fd, uint32_t cluster_count, uint32_t first_rewritten)
+{
+  uint32_t k;
+
+  for (k = 0; k < cluster_count; ++k) {
+    /* Visit the clusters in a scattered order */
+    uint32_t cluster = (k * 337) % cluster_count;
+    off_t offset = (off_t) cluster * CLUSTER_SIZE + CLUSTER_SIZE - 16;
+
+    if (cluster + 1 < cluster_count) {
+      check_at(fd, offset, 32, first_rewritten);
+    } else {
+      check_at(fd, offset, 16, first_rewritten);
+    }
+  }
+}
+
+static void check_file(uint32_t cluster_count, uint32_t first_rewritten)
+{
+  struct stat st;
+  uint32_t cluster;
+  int fd;
+  int rv;
+
+  fd = open(FILE_A, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == (off_t) cluster_count * CLUSTER_SIZE);
+
+  for (cluster = 0; cluster < cluster_count; ++cluster) {
+    uint8_t expected [CLUSTER_SIZE];
+    ssize_t n;
+
+    fill_cluster(
+      cluster,
+      cluster >= first_rewritten ? GENERATION_REWRITTEN : GENERATION_INITIAL
+    );
+    memcpy(expected, cluster_buf, sizeof(expected));
+
+    n = read(fd, cluster_buf, sizeof(cluster_buf));
+    rtems_test_assert(n == (ssize_t) sizeof(cluster_buf));
+    rtems_test_assert(memcmp(cluster_buf, expected, sizeof(expected)) == 0);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+/*
+ * Write two files in turns one cluster at a time, so that the clusters of
+ * the files interleave on the volume.  Remove the second file to leave holes
+ * between the fragments of the first file.
+ */
+static int create_fragmented_file(void)
+{
+  uint32_t cluster;
+  int fd_a;
+  int fd_b;
+  int rv;
+
+  fd_a = open(FILE_A, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd_a >= 0);
+
+  fd_b = open(FILE_B, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd_b >= 0);
+
+  for (cluster = 0; cluster < CLUSTER_COUNT; ++cluster) {
+    write_cluster(fd_a, cluster, GENERATION_INITIAL);
+    write_cluster(fd_b, cluster, GENERATION_REWRITTEN);
+  }
+
+  rv = close(fd_b);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(FILE_B);
+  rtems_test_assert(rv == 0);
+
+  return fd_a;
+}
+
+static void test(void)
+{
+  static const msdos_format_request_param_t rqdata = {
+    .sectors_per_cluster = 1,
+    .quick_format = true,
+    .sync_device = true
+  };
+
+  uint32_t cluster;
+  off_t pos;
+  int fd;
+  int rv;
+
+  rv = msdos_format(RDA, &rqdata);
+  rtems_test_assert(rv == 0);
+
+  mount_disk();
+
+  puts("seek in a fragmented file");
+  fd = create_fragmented_file();
+  check_seek(fd, CLUSTER_COUNT, CLUSTER_COUNT);
+
+  puts("truncate a fragmented file");
+  rv = ftruncate(fd, (off_t) TRUNCATE_COUNT * CLUSTER_SIZE);
+  rtems_test_assert(rv == 0);
+  check_seek(fd, TRUNCATE_COUNT, CLUSTER_COUNT);
+
+  /*
+   * The clusters appended after the truncation come from the holes and the
+   * truncated tail, so they are mapped differently than before
+   */
+  pos = lseek(fd, 0, SEEK_END);
+  rtems_test_assert(pos == (off_t) TRUNCATE_COUNT * CLUSTER_SIZE);
+
+  for (cluster = TRUNCATE_COUNT; cluster < CLUSTER_COUNT; ++cluster) {
+    write_cluster(fd, cluster, GENERATION_REWRITTEN);
+  }
+
+  check_seek(fd, CLUSTER_COUNT, TRUNCATE_COUNT);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  unmount_disk();
+
+  puts("check file after remount");
+  mount_disk();
+  check_file(CLUSTER_COUNT, TRUNCATE_COUNT);
+  unmount_disk();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = CLUSTER_SIZE, .block_num = 2048 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_EXTRA_TASK_STACKS (8 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,287 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/dosfs.h>
+#include <rtems/libio.h>
+#include <rtems/sparse-disk.h>
+
+const char rtems_test_name[] = "FSDOSFSFATCACHE 1";
+
+#define DEV "/dev/rda"
+
+#define MNT "/mnt"
+
+#define FILE_A MNT "/a"
+
+#define FILE_B MNT "/b"
+
+#define FILE_C MNT "/c"
+
+#define SECTOR_SIZE 512
+
+#define FIRST_DATA_CLUSTER 2
+
+/*
+ * The entry of this cluster is the first FAT12 entry which crosses the
+ * boundary of the first two FAT sectors.
+ */
+#define FAT12_BOUNDARY_CLUSTER ((2 * SECTOR_SIZE) / 3)
+
+/* The entry of this cluster is the first one of the second FAT16 sector */
+#define FAT16_BOUNDARY_CLUSTER (SECTOR_SIZE / 2)
+
+/* File B starts this count of clusters before the boundary cluster */
+#define B_OFFSET 4
+
+#define B_CLUSTERS 8
+
+#define B_TRUNCATED_CLUSTERS 2
+
+#define C_CLUSTERS 6
+
+static uint8_t cluster_buf[SECTOR_SIZE];
+
+static void mount_disk(void)
+{
+  int rv;
+
+  rv = mount_and_make_target_path(
+    DEV,
+    MNT,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void unmount_disk(void)
+{
+  int rv;
+
+  rv = unmount(MNT);
+  rtems_test_assert(rv == 0);
+}
+
+static fsblkcnt_t get_free_clusters(void)
+{
+  struct statvfs sb;
+  int rv;
+
+  rv = statvfs(MNT, &sb);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(sb.f_frsize == SECTOR_SIZE);
+
+  return sb.f_bfree;
+}
+
+static void write_file(const char *file, size_t clusters, uint8_t pattern)
+{
+  int fd;
+  size_t i;
+  int rv;
+
+  fd = open(file, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(fd >= 0);
+
+  for (i = 0; i < clusters; ++i) {
+    ssize_t n;
+
+    memset(cluster_buf, (int) (pattern + i), sizeof(cluster_buf));
+    n = write(fd, cluster_buf, sizeof(cluster_buf));
+    rtems_test_assert(n == (ssize_t) sizeof(cluster_buf));
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void check_file(const char *file, size_t clusters, uint8_t pattern)
+{
+  struct stat st;
+  int fd;
+  size_t i;
+  ssize_t n;
+  int rv;
+
+  fd = open(file, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == (off_t) (clusters * SECTOR_SIZE));
+
+  for (i = 0; i < clusters; ++i) {
+    size_t j;
+
+    n = read(fd, cluster_buf, sizeof(cluster_buf));
+    rtems_test_assert(n == (ssize_t) sizeof(cluster_buf));
+
+    for (j = 0; j < sizeof(cluster_buf); ++j) {
+      rtems_test_assert(cluster_buf[j] == (uint8_t) (pattern + i));
+    }
+  }
+
+  n = read(fd, cluster_buf, sizeof(cluster_buf));
+  rtems_test_assert(n == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_boundary(
+  rtems_blkdev_bnum media_block_count,
+  uint32_t boundary_cluster
+)
+{
+  msdos_format_request_param_t rqdata;
+  rtems_status_code sc;
+  fsblkcnt_t free_initial;
+  fsblkcnt_t free_clusters;
+  size_t a_clusters;
+  int rv;
+
+  sc = rtems_sparse_disk_create_and_register(
+    DEV,
+    SECTOR_SIZE,
+    1024,
+    media_block_count,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Use one sector per cluster, so that each cluster is a FAT entry */
+  memset(&rqdata, 0, sizeof(rqdata));
+  rqdata.sectors_per_cluster = 1;
+  rqdata.fat_num = 1;
+  rqdata.files_per_root_dir = 32;
+  rqdata.quick_format = true;
+  rqdata.skip_alignment = true;
+  rv = msdos_format(DEV, &rqdata);
+  rtems_test_assert(rv == 0);
+
+  mount_disk();
+  free_initial = get_free_clusters();
+
+  /*
+   * The clusters are allocated from the first data cluster on.  File A moves
+   * file B in front of the boundary.
+   */
+  a_clusters = boundary_cluster - B_OFFSET - FIRST_DATA_CLUSTER;
+  write_file(FILE_A, a_clusters, 0xa0);
+
+  puts("allocate clusters across the FAT sector boundary");
+  write_file(FILE_B, B_CLUSTERS, 0xb0);
+  free_clusters = get_free_clusters();
+  rtems_test_assert(free_clusters == free_initial - a_clusters - B_CLUSTERS);
+  check_file(FILE_B, B_CLUSTERS, 0xb0);
+
+  puts("free clusters across the FAT sector boundary");
+  rv = truncate(FILE_B, B_TRUNCATED_CLUSTERS * SECTOR_SIZE);
+  rtems_test_assert(rv == 0);
+  free_clusters = get_free_clusters();
+  rtems_test_assert(
+    free_clusters == free_initial - a_clusters - B_TRUNCATED_CLUSTERS
+  );
+  check_file(FILE_B, B_TRUNCATED_CLUSTERS, 0xb0);
+
+  /* The freed clusters are allocated again */
+  write_file(FILE_C, C_CLUSTERS, 0xc0);
+  free_clusters = get_free_clusters();
+  rtems_test_assert(
+    free_clusters ==
+      free_initial - a_clusters - B_TRUNCATED_CLUSTERS - C_CLUSTERS
+  );
+  check_file(FILE_B, B_TRUNCATED_CLUSTERS, 0xb0);
+  check_file(FILE_C, C_CLUSTERS, 0xc0);
+
+  rv = unlink(FILE_A);
+  rtems_test_assert(rv == 0);
+  unmount_disk();
+
+  puts("check the cluster chains after remount");
+  mount_disk();
+  free_clusters = get_free_clusters();
+  rtems_test_assert(
+    free_clusters == free_initial - B_TRUNCATED_CLUSTERS - C_CLUSTERS
+  );
+  check_file(FILE_B, B_TRUNCATED_CLUSTERS, 0xb0);
+  check_file(FILE_C, C_CLUSTERS, 0xc0);
+  unmount_disk();
+
+  rv = unlink(DEV);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  puts("FAT12");
+  test_boundary(2880, FAT12_BOUNDARY_CLUSTER);
+
+  puts("FAT16");
+  test_boundary(32681, FAT16_BOUNDARY_CLUSTER);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
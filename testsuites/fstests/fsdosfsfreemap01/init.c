@@ -0,0 +1,247 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/dosfs.h>
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "FSDOSFSFREEMAP 1";
+
+#define RDA "/dev/rda"
+
+#define MNT "/mnt"
+
+#define FILE_A MNT "/a"
+
+#define FILE_B MNT "/b"
+
+#define FILE_C MNT "/c"
+
+static uint8_t file_buf [16 * 1024];
+
+static void mount_disk(bool free_cluster_map)
+{
+  rtems_dosfs_mount_options mount_opts;
+  int rv;
+
+  memset(&mount_opts, 0, sizeof(mount_opts));
+  mount_opts.version = RTEMS_DOSFS_MOUNT_OPTIONS_VERSION;
+
+  if (free_cluster_map) {
+    mount_opts.flags = RTEMS_DOSFS_FREE_CLUSTER_MAP;
+  }
+
+  rv = mount_and_make_target_path(
+    RDA,
+    MNT,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_opts
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void unmount_disk(void)
+{
+  int rv;
+
+  rv = unmount(MNT);
+  rtems_test_assert(rv == 0);
+}
+
+static fsblkcnt_t get_free_clusters(unsigned long *cluster_size)
+{
+  struct statvfs sb;
+  int rv;
+
+  rv = statvfs(MNT, &sb);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(sb.f_bfree == sb.f_bavail);
+
+  *cluster_size = sb.f_frsize;
+
+  return sb.f_bfree;
+}
+
+static void write_file(const char *file, size_t size, uint8_t pattern)
+{
+  int fd;
+  ssize_t n;
+  int rv;
+
+  rtems_test_assert(size <= sizeof(file_buf));
+  memset(file_buf, pattern, size);
+
+  fd = open(file, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(fd >= 0);
+
+  n = write(fd, file_buf, size);
+  rtems_test_assert(n == (ssize_t) size);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void check_file(const char *file, size_t size, uint8_t pattern)
+{
+  int fd;
+  ssize_t n;
+  size_t i;
+  int rv;
+
+  rtems_test_assert(size <= sizeof(file_buf));
+  memset(file_buf, 0, size);
+
+  fd = open(file, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  n = read(fd, file_buf, size);
+  rtems_test_assert(n == (ssize_t) size);
+
+  for (i = 0; i < size; ++i) {
+    rtems_test_assert(file_buf [i] == pattern);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(void)
+{
+  /*
+   * Use one sector per cluster, so that the map is built in more than one
+   * step
+   */
+  static const msdos_format_request_param_t rqdata = {
+    .sectors_per_cluster = 1,
+    .quick_format = true,
+    .sync_device = true
+  };
+
+  fsblkcnt_t free_initial;
+  fsblkcnt_t free_clusters;
+  unsigned long cluster_size;
+  int rv;
+
+  rv = msdos_format(RDA, &rqdata);
+  rtems_test_assert(rv == 0);
+
+  puts("free clusters without map");
+  mount_disk(false);
+  free_initial = get_free_clusters(&cluster_size);
+  rtems_test_assert(free_initial > 0);
+  unmount_disk();
+
+  puts("allocate clusters while the map is built");
+  mount_disk(true);
+  write_file(FILE_A, 2 * cluster_size, 0xaa);
+  write_file(FILE_B, 3 * cluster_size, 0xbb);
+  free_clusters = get_free_clusters(&cluster_size);
+  rtems_test_assert(free_clusters == free_initial - 5);
+  unmount_disk();
+
+  puts("free clusters with map");
+  mount_disk(true);
+  free_clusters = get_free_clusters(&cluster_size);
+  rtems_test_assert(free_clusters == free_initial - 5);
+
+  puts("allocate and free clusters");
+
+  rv = unlink(FILE_A);
+  rtems_test_assert(rv == 0);
+  free_clusters = get_free_clusters(&cluster_size);
+  rtems_test_assert(free_clusters == free_initial - 3);
+
+  /* The file does not fit into the hole left by the first file */
+  write_file(FILE_C, 4 * cluster_size, 0xcc);
+  free_clusters = get_free_clusters(&cluster_size);
+  rtems_test_assert(free_clusters == free_initial - 7);
+
+  check_file(FILE_B, 3 * cluster_size, 0xbb);
+  check_file(FILE_C, 4 * cluster_size, 0xcc);
+  unmount_disk();
+
+  puts("check file allocation table without map");
+  mount_disk(false);
+  free_clusters = get_free_clusters(&cluster_size);
+  rtems_test_assert(free_clusters == free_initial - 7);
+  check_file(FILE_B, 3 * cluster_size, 0xbb);
+  check_file(FILE_C, 4 * cluster_size, 0xcc);
+  unmount_disk();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = 512, .block_num = 1024 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS (8 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,272 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSIMFSCHUNKFILE 1";
+
+#define FILE_SIZE ( 2 * 1024 * 1024 )
+
+#define BUFFER_SIZE ( 3 * IMFS_CHUNKFILE_CHUNK_SIZE / 2 )
+
+static unsigned char buffer[ BUFFER_SIZE ];
+
+static unsigned char pattern( off_t offset )
+{
+  return (unsigned char) ( ( offset * 7 ) + ( offset >> 12 ) );
+}
+
+static void fill( off_t offset, size_t n )
+{
+  size_t i;
+
+  for ( i = 0; i < n; ++i ) {
+    buffer[ i ] = pattern( offset + (off_t) i );
+  }
+}
+
+static void check( off_t offset, size_t n )
+{
+  size_t i;
+
+  for ( i = 0; i < n; ++i ) {
+    rtems_test_assert( buffer[ i ] == pattern( offset + (off_t) i ) );
+  }
+}
+
+static void check_zero( size_t n )
+{
+  size_t i;
+
+  for ( i = 0; i < n; ++i ) {
+    rtems_test_assert( buffer[ i ] == 0 );
+  }
+}
+
+static void test_sequential( const char *path )
+{
+  struct stat st;
+  ssize_t n;
+  off_t offset;
+  int fd;
+  int rv;
+
+  fd = open( path, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  for ( offset = 0; offset < FILE_SIZE; offset += n ) {
+    fill( offset, sizeof( buffer ) );
+    n = write( fd, buffer, sizeof( buffer ) );
+    rtems_test_assert( n == (ssize_t) sizeof( buffer ) );
+  }
+
+  rv = fstat( fd, &st );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( st.st_size == offset );
+  rtems_test_assert( st.st_blksize == IMFS_CHUNKFILE_CHUNK_SIZE );
+
+  offset = lseek( fd, 0, SEEK_SET );
+  rtems_test_assert( offset == 0 );
+
+  while ( ( n = read( fd, buffer, sizeof( buffer ) ) ) > 0 ) {
+    check( offset, (size_t) n );
+    offset += n;
+  }
+
+  rtems_test_assert( n == 0 );
+  rtems_test_assert( offset == st.st_size );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_sparse_and_truncate( const char *path )
+{
+  off_t hole = 10 * IMFS_CHUNKFILE_CHUNK_SIZE + 100;
+  ssize_t n;
+  off_t offset;
+  int fd;
+  int rv;
+
+  fd = open( path, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  /* Write past the end of the file and read the hole back as zeros */
+  fill( hole, 10 );
+  n = pwrite( fd, buffer, 10, hole );
+  rtems_test_assert( n == 10 );
+
+  memset( buffer, 0xff, sizeof( buffer ) );
+  n = pread( fd, buffer, sizeof( buffer ), 0 );
+  rtems_test_assert( n == (ssize_t) sizeof( buffer ) );
+  check_zero( sizeof( buffer ) );
+
+  n = pread( fd, buffer, sizeof( buffer ), hole );
+  rtems_test_assert( n == 10 );
+  check( hole, 10 );
+
+  /* Shrink into the last chunk and extend again, the tail reads as zeros */
+  rv = ftruncate( fd, hole + 5 );
+  rtems_test_assert( rv == 0 );
+
+  rv = ftruncate( fd, hole + 10 );
+  rtems_test_assert( rv == 0 );
+
+  n = pread( fd, buffer, sizeof( buffer ), hole );
+  rtems_test_assert( n == 10 );
+  check( hole, 5 );
+  rtems_test_assert( buffer[ 5 ] == 0 && buffer[ 9 ] == 0 );
+
+  /* Truncate to zero and reuse the released chunks */
+  rv = ftruncate( fd, 0 );
+  rtems_test_assert( rv == 0 );
+
+  offset = lseek( fd, 0, SEEK_END );
+  rtems_test_assert( offset == 0 );
+
+  fill( 0, sizeof( buffer ) );
+  n = write( fd, buffer, sizeof( buffer ) );
+  rtems_test_assert( n == (ssize_t) sizeof( buffer ) );
+
+  memset( buffer, 0, sizeof( buffer ) );
+  n = pread( fd, buffer, sizeof( buffer ), 0 );
+  rtems_test_assert( n == (ssize_t) sizeof( buffer ) );
+  check( 0, sizeof( buffer ) );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( path );
+  rtems_test_assert( rv == 0 );
+}
+
+/*
+ * The mount data of the IMFS is opaque and does not select chunk files.
+ */
+static void test_imfs_mount_data( const char *mnt )
+{
+  static const uint32_t data[] = { 0xffffffff, 0xffffffff };
+  struct stat st;
+  char path[ 32 ];
+  int fd;
+  int rv;
+
+  rv = mkdir( mnt, S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  rv = mount(
+    "",
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_IMFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    data
+  );
+  rtems_test_assert( rv == 0 );
+
+  snprintf( path, sizeof( path ), "%s/file", mnt );
+  fd = open( path, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  rv = fstat( fd, &st );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( st.st_blksize != IMFS_CHUNKFILE_CHUNK_SIZE );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( path );
+  rtems_test_assert( rv == 0 );
+
+  rv = unmount( mnt );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  const char *mnt = "/chunk";
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = mkdir( mnt, S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  rv = mount(
+    "",
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_IMFS_CHUNKFILE,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert( rv == 0 );
+
+  test_sequential( "/chunk/seq" );
+  test_sparse_and_truncate( "/chunk/sparse" );
+
+  rv = unlink( "/chunk/seq" );
+  rtems_test_assert( rv == 0 );
+
+  rv = unmount( mnt );
+  rtems_test_assert( rv == 0 );
+
+  test_imfs_mount_data( "/imfs" );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_IMFS
+#define CONFIGURE_FILESYSTEM_IMFS_CHUNKFILE
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
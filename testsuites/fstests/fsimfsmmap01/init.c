@@ -0,0 +1,191 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSIMFSMMAP 1";
+
+static const char image[] = "The linear file image is mapped in place";
+
+static unsigned char buffer[ 1000 ];
+
+static void test_linfile( void )
+{
+  char *p;
+  int fd;
+  int rv;
+
+  rv = IMFS_make_linearfile(
+    "/lin",
+    S_IRUSR | S_IWUSR,
+    image,
+    sizeof( image )
+  );
+  rtems_test_assert( rv == 0 );
+
+  fd = open( "/lin", O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  /* The whole file is mapped without a copy */
+  p = mmap(
+    NULL,
+    sizeof( image ),
+    PROT_READ | PROT_WRITE,
+    MAP_SHARED,
+    fd,
+    0
+  );
+  rtems_test_assert( p == image );
+
+  /* The copy on write would detach the file from the mapped image */
+  errno = 0;
+  rv = open( "/lin", O_RDWR );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EBUSY );
+
+  rv = munmap( p, sizeof( image ) );
+  rtems_test_assert( rv == 0 );
+
+  p = mmap( NULL, 4, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 4 );
+  rtems_test_assert( p == &image[ 4 ] );
+
+  rv = munmap( p, 4 );
+  rtems_test_assert( rv == 0 );
+
+  /* Private mappings are still copies */
+  p = mmap(
+    NULL,
+    sizeof( image ),
+    PROT_READ | PROT_WRITE,
+    MAP_PRIVATE,
+    fd,
+    0
+  );
+  rtems_test_assert( p != MAP_FAILED );
+  rtems_test_assert( p != image );
+  rtems_test_assert( memcmp( p, image, sizeof( image ) ) == 0 );
+
+  rv = munmap( p, sizeof( image ) );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  /* Without shared mappings the copy on write is done */
+  fd = open( "/lin", O_RDWR );
+  rtems_test_assert( fd >= 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_memfile( void )
+{
+  unsigned char *p;
+  ssize_t n;
+  size_t i;
+  int fd;
+  int rv;
+
+  for ( i = 0; i < sizeof( buffer ); ++i ) {
+    buffer[ i ] = (unsigned char) i;
+  }
+
+  fd = open( "/mem", O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  n = write( fd, buffer, sizeof( buffer ) );
+  rtems_test_assert( n == (ssize_t) sizeof( buffer ) );
+
+  /* The blocks of a memfile are not contiguous, it cannot be mapped shared */
+  errno = 0;
+  p = mmap( NULL, 8, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == ENOTSUP );
+
+  p = mmap(
+    NULL,
+    sizeof( buffer ),
+    PROT_READ | PROT_WRITE,
+    MAP_PRIVATE,
+    fd,
+    0
+  );
+  rtems_test_assert( p != MAP_FAILED );
+  rtems_test_assert( memcmp( p, buffer, sizeof( buffer ) ) == 0 );
+
+  rv = munmap( p, sizeof( buffer ) );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( "/mem" );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test_linfile();
+  test_memfile();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_IMFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
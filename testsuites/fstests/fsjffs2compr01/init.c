@@ -0,0 +1,352 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <sys/ioctl.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <tmacros.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define FLASH_SIZE (16UL * BLOCK_SIZE)
+
+#define DATA_SIZE (64UL * 1024UL)
+
+#define CHUNK_SIZE 4096
+
+const char rtems_test_name[] = "FSJFFS2COMPR 1";
+
+#define BASE_FOR_TEST "/mnt"
+
+static char file[] = BASE_FOR_TEST "/log";
+
+static unsigned char data[DATA_SIZE];
+
+static unsigned char cdata[CHUNK_SIZE];
+
+static unsigned char buf[CHUNK_SIZE];
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static unsigned char *get_flash_chunk(rtems_jffs2_flash_control *super,
+                                      uint32_t offset)
+{
+  return &((flash_control *) super)->area[offset];
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  unsigned char *chunk = get_flash_chunk(super, offset);
+
+  memcpy(buffer, chunk, size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  unsigned char *chunk = get_flash_chunk(super, offset);
+
+  for (size_t i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  unsigned char *chunk = get_flash_chunk(super, offset);
+
+  memset(chunk, 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static rtems_jffs2_compressor_control rtime_instance = {
+  .compress = rtems_jffs2_compressor_rtime_compress,
+  .decompress = rtems_jffs2_compressor_rtime_decompress
+};
+
+static rtems_jffs2_compressor_zlib_control zlib_instance = {
+  .super = {
+    .compress = rtems_jffs2_compressor_zlib_compress,
+    .decompress = rtems_jffs2_compressor_zlib_decompress
+  }
+};
+
+static rtems_jffs2_compressor_fastlz_control fastlz_instance = {
+  .super = {
+    .compress = rtems_jffs2_compressor_fastlz_compress,
+    .decompress = rtems_jffs2_compressor_fastlz_decompress
+  }
+};
+
+typedef struct {
+  const char *name;
+  rtems_jffs2_compressor_control *control;
+} compressor;
+
+static const compressor compressors[] = {
+  { "none", NULL },
+  { "rtime", &rtime_instance },
+  { "zlib", &zlib_instance.super },
+  { "fastlz", &fastlz_instance.super }
+};
+
+static void init_data(void)
+{
+  size_t i = 0;
+  uint32_t v = 123;
+  unsigned int line = 0;
+
+  while (i < sizeof(data)) {
+    char text[64];
+    int n;
+
+    v = v * 1664525 + 1013904223;
+    n = snprintf(
+      text,
+      sizeof(text),
+      "[%06u] sensor %u: value=%u status=%s\n",
+      line,
+      (v >> 28) & 0x7,
+      (v >> 16) & 0x3ff,
+      (v & 0x100) != 0 ? "OK" : "WARN"
+    );
+    rtems_test_assert(n > 0 && (size_t) n < sizeof(text));
+
+    if ((size_t) n > sizeof(data) - i) {
+      n = (int) (sizeof(data) - i);
+    }
+
+    memcpy(&data[i], text, (size_t) n);
+    i += (size_t) n;
+    ++line;
+  }
+}
+
+static uint64_t to_kib_per_second(size_t size, uint64_t ns)
+{
+  if (ns == 0) {
+    return 0;
+  }
+
+  return (UINT64_C(1000000000) * size) / (1024 * ns);
+}
+
+static void measure_throughput(const compressor *cmp)
+{
+  rtems_jffs2_compressor_control *cc = cmp->control;
+  uint64_t compress_ns = 0;
+  uint64_t decompress_ns = 0;
+  size_t compressed_in = 0;
+  size_t compressed_out = 0;
+  size_t uncompressed = 0;
+
+  if (cc == NULL) {
+    return;
+  }
+
+  for (size_t offset = 0; offset < sizeof(data); offset += CHUNK_SIZE) {
+    uint32_t datalen = CHUNK_SIZE;
+    uint32_t cdatalen = CHUNK_SIZE;
+    rtems_counter_ticks t0;
+    uint16_t comprtype;
+    int rv;
+
+    t0 = rtems_counter_read();
+    comprtype = (*cc->compress)(cc, &data[offset], cdata, &datalen, &cdatalen);
+    compress_ns += rtems_counter_ticks_to_nanoseconds(
+      rtems_counter_difference(rtems_counter_read(), t0)
+    );
+
+    if (comprtype == 0) {
+      uncompressed += CHUNK_SIZE;
+      continue;
+    }
+
+    /* The compressor may have compressed only a part of the chunk */
+    rtems_test_assert(datalen > 0 && datalen <= CHUNK_SIZE);
+    compressed_in += datalen;
+    compressed_out += cdatalen;
+    uncompressed += CHUNK_SIZE - datalen;
+
+    t0 = rtems_counter_read();
+    rv = (*cc->decompress)(cc, comprtype, cdata, buf, cdatalen, datalen);
+    decompress_ns += rtems_counter_ticks_to_nanoseconds(
+      rtems_counter_difference(rtems_counter_read(), t0)
+    );
+    rtems_test_assert(rv == 0);
+    rtems_test_assert(memcmp(buf, &data[offset], datalen) == 0);
+  }
+
+  printf(
+    "%s: compress %" PRIu64 " KiB/s, decompress %" PRIu64 " KiB/s, "
+    "ratio %zu%%\n",
+    cmp->name,
+    to_kib_per_second(sizeof(data), compress_ns),
+    to_kib_per_second(compressed_in, decompress_ns),
+    (100 * (compressed_out + uncompressed)) / sizeof(data)
+  );
+}
+
+static uint32_t measure_flash_usage(const compressor *cmp)
+{
+  rtems_jffs2_mount_data mount_data = {
+    .flash_control = &flash_instance.super,
+    .compressor_control = cmp->control
+  };
+  rtems_jffs2_info info;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+
+  rv = mount(
+    NULL,
+    BASE_FOR_TEST,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  fd = open(file, O_WRONLY | O_TRUNC | O_CREAT, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(fd >= 0);
+
+  n = write(fd, data, sizeof(data));
+  rtems_test_assert(n == (ssize_t) sizeof(data));
+
+  rv = ioctl(fd, RTEMS_JFFS2_GET_INFO, &info);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  fd = open(file, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  for (size_t offset = 0; offset < sizeof(data); offset += CHUNK_SIZE) {
+    n = read(fd, buf, CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+    rtems_test_assert(memcmp(buf, &data[offset], CHUNK_SIZE) == 0);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unmount(BASE_FOR_TEST);
+  rtems_test_assert(rv == 0);
+
+  printf("%s: flash used %" PRIu32 " bytes\n", cmp->name, info.used_size);
+
+  return info.used_size;
+}
+
+static rtems_task Init(rtems_task_argument ignored)
+{
+  uint32_t used[RTEMS_ARRAY_SIZE(compressors)];
+  int rv;
+
+  TEST_BEGIN();
+
+  init_data();
+
+  rv = mkdir(BASE_FOR_TEST, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  for (size_t i = 0; i < RTEMS_ARRAY_SIZE(compressors); ++i) {
+    measure_throughput(&compressors[i]);
+    used[i] = measure_flash_usage(&compressors[i]);
+  }
+
+  for (size_t i = 1; i < RTEMS_ARRAY_SIZE(compressors); ++i) {
+    rtems_test_assert(used[i] < used[0]);
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 40
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
@@ -0,0 +1,295 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <sys/ioctl.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <tmacros.h>
+
+#include <rtems.h>
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define FLASH_SIZE (8UL * BLOCK_SIZE)
+
+#define FILE_COUNT 100
+
+#define LIVE_FILES 4
+
+#define KEGS_PER_FILE 8
+
+#define GC_TASK_PRIORITY 2
+
+const char rtems_test_name[] = "FSJFFS2GCTASK 1";
+
+#define BASE_FOR_TEST "/mnt"
+
+static char keg[523];
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static unsigned char *get_flash_chunk(rtems_jffs2_flash_control *super,
+                                      uint32_t offset)
+{
+  return &((flash_control *) super)->area[offset];
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  unsigned char *chunk = get_flash_chunk(super, offset);
+
+  memcpy(buffer, chunk, size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  unsigned char *chunk = get_flash_chunk(super, offset);
+
+  for (size_t i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  unsigned char *chunk = get_flash_chunk(super, offset);
+
+  memset(chunk, 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static rtems_jffs2_compressor_control compressor_instance = {
+  .compress = rtems_jffs2_compressor_rtime_compress,
+  .decompress = rtems_jffs2_compressor_rtime_decompress
+};
+
+static const rtems_jffs2_mount_data mount_data_without_gc_task = {
+  .flash_control = &flash_instance.super,
+  .compressor_control = &compressor_instance
+};
+
+static const rtems_jffs2_mount_data mount_data_with_gc_task = {
+  .flash_control = &flash_instance.super,
+  .compressor_control = &compressor_instance,
+  .gc_task_priority = GC_TASK_PRIORITY,
+  .gc_free_blocks_high_watermark = 6
+};
+
+static void init_keg(void)
+{
+  uint32_t v = 123;
+
+  for (size_t i = 0; i < sizeof(keg); ++i) {
+    v = v * 1664525 + 1013904223;
+    keg[i] = (uint8_t) (v >> 23);
+  }
+}
+
+static void file_name(char *name, size_t size, int i)
+{
+  int n = snprintf(name, size, BASE_FOR_TEST "/f%03i", i);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void create_file(int i)
+{
+  char name[16];
+  int fd;
+  int rv;
+
+  file_name(name, sizeof(name), i);
+  fd = open(name, O_WRONLY | O_TRUNC | O_CREAT, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(fd >= 0);
+
+  for (int j = 0; j < KEGS_PER_FILE; ++j) {
+    ssize_t n = write(fd, &keg[0], sizeof(keg));
+    rtems_test_assert(n == (ssize_t) sizeof(keg));
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void remove_file(int i)
+{
+  char name[16];
+  int rv;
+
+  file_name(name, sizeof(name), i);
+  rv = unlink(name);
+  rtems_test_assert(rv == 0);
+}
+
+static void get_gc_stats(rtems_jffs2_gc_stats *stats)
+{
+  int fd;
+  int rv;
+
+  fd = open(BASE_FOR_TEST, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_JFFS2_GET_GC_STATS, stats);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void run_workload(
+  const rtems_jffs2_mount_data *mount_data,
+  const char *name,
+  rtems_jffs2_gc_stats *stats
+)
+{
+  int rv;
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+
+  rv = mount(
+    NULL,
+    BASE_FOR_TEST,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    mount_data
+  );
+  rtems_test_assert(rv == 0);
+
+  for (int i = 0; i < FILE_COUNT; ++i) {
+    create_file(i);
+
+    if (i >= LIVE_FILES) {
+      remove_file(i - LIVE_FILES);
+    }
+
+    /* Give the garbage collection task some idle time */
+    rtems_task_wake_after(1);
+  }
+
+  get_gc_stats(stats);
+
+  printf(
+    "%s garbage collection task:\n"
+    "  background passes: %" PRIu32 "\n"
+    "  background time: %" PRIu64 "ns\n"
+    "  write stalls: %" PRIu32 "\n"
+    "  write stall time: %" PRIu64 "ns\n"
+    "  write stall time max: %" PRIu64 "ns\n",
+    name,
+    stats->background_passes,
+    stats->background_time,
+    stats->write_stalls,
+    stats->write_stall_time,
+    stats->write_stall_time_max
+  );
+
+  rv = unmount(BASE_FOR_TEST);
+  rtems_test_assert(rv == 0);
+}
+
+static rtems_task Init(rtems_task_argument ignored)
+{
+  rtems_jffs2_gc_stats without_gc_task;
+  rtems_jffs2_gc_stats with_gc_task;
+  int rv;
+
+  TEST_BEGIN();
+
+  init_keg();
+
+  rv = mkdir(BASE_FOR_TEST, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  run_workload(&mount_data_without_gc_task, "without", &without_gc_task);
+  rtems_test_assert(without_gc_task.background_passes == 0);
+  rtems_test_assert(without_gc_task.write_stalls > 0);
+
+  run_workload(&mount_data_with_gc_task, "with", &with_gc_task);
+  rtems_test_assert(with_gc_task.background_passes > 0);
+  rtems_test_assert(with_gc_task.write_stalls < without_gc_task.write_stalls);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 40
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
@@ -0,0 +1,304 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <tmacros.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define FLASH_SIZE (32UL * BLOCK_SIZE)
+
+#define FILE_COUNT 96
+
+#define KEGS_PER_FILE 6
+
+const char rtems_test_name[] = "FSJFFS2SUMMARY 1";
+
+#define BASE_FOR_TEST "/mnt"
+
+static char keg[523];
+
+static char buf[sizeof(keg)];
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  size_t bytes_read;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static unsigned char *get_flash_chunk(rtems_jffs2_flash_control *super,
+                                      uint32_t offset)
+{
+  return &((flash_control *) super)->area[offset];
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  unsigned char *chunk = get_flash_chunk(super, offset);
+
+  ((flash_control *) super)->bytes_read += size_of_buffer;
+  memcpy(buffer, chunk, size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  unsigned char *chunk = get_flash_chunk(super, offset);
+
+  for (size_t i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  unsigned char *chunk = get_flash_chunk(super, offset);
+
+  memset(chunk, 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static rtems_jffs2_compressor_control compressor_instance = {
+  .compress = rtems_jffs2_compressor_rtime_compress,
+  .decompress = rtems_jffs2_compressor_rtime_decompress
+};
+
+static const rtems_jffs2_mount_data mount_data_without_summary = {
+  .flash_control = &flash_instance.super,
+  .compressor_control = &compressor_instance
+};
+
+static const rtems_jffs2_mount_data mount_data_with_summary = {
+  .flash_control = &flash_instance.super,
+  .compressor_control = &compressor_instance,
+  .enable_summary = true
+};
+
+static void init_keg(void)
+{
+  uint32_t v = 123;
+
+  for (size_t i = 0; i < sizeof(keg); ++i) {
+    v = v * 1664525 + 1013904223;
+    keg[i] = (uint8_t) (v >> 23);
+  }
+}
+
+static void file_name(char *name, size_t size, int i)
+{
+  int n = snprintf(name, size, BASE_FOR_TEST "/f%02i", i);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void create_files(void)
+{
+  for (int i = 0; i < FILE_COUNT; ++i) {
+    char name[16];
+    int fd;
+    int rv;
+
+    file_name(name, sizeof(name), i);
+    fd = open(name, O_WRONLY | O_TRUNC | O_CREAT, S_IRWXU | S_IRWXG | S_IRWXO);
+    rtems_test_assert(fd >= 0);
+
+    for (int j = 0; j < KEGS_PER_FILE; ++j) {
+      ssize_t n = write(fd, &keg[0], sizeof(keg));
+      rtems_test_assert(n == (ssize_t) sizeof(keg));
+    }
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void check_files(void)
+{
+  for (int i = 0; i < FILE_COUNT; ++i) {
+    char name[16];
+    int fd;
+    int rv;
+    ssize_t n;
+
+    file_name(name, sizeof(name), i);
+    fd = open(name, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    for (int j = 0; j < KEGS_PER_FILE; ++j) {
+      n = read(fd, &buf[0], sizeof(buf));
+      rtems_test_assert(n == (ssize_t) sizeof(buf));
+      rtems_test_assert(memcmp(&buf[0], &keg[0], sizeof(keg)) == 0);
+    }
+
+    n = read(fd, &buf[0], sizeof(buf));
+    rtems_test_assert(n == 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void do_mount(const rtems_jffs2_mount_data *mount_data)
+{
+  int rv = mount(
+    NULL,
+    BASE_FOR_TEST,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    mount_data
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void do_unmount(void)
+{
+  int rv = unmount(BASE_FOR_TEST);
+  rtems_test_assert(rv == 0);
+}
+
+static size_t measure_mount(
+  const rtems_jffs2_mount_data *mount_data,
+  const char *name
+)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks d;
+  size_t bytes_read;
+
+  flash_instance.bytes_read = 0;
+  t0 = rtems_counter_read();
+  do_mount(mount_data);
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+  bytes_read = flash_instance.bytes_read;
+
+  printf(
+    "mount %s summary: %zu bytes read, %" PRIu64 "ns\n",
+    name,
+    bytes_read,
+    rtems_counter_ticks_to_nanoseconds(d)
+  );
+
+  check_files();
+  do_unmount();
+
+  return bytes_read;
+}
+
+static rtems_task Init(rtems_task_argument ignored)
+{
+  size_t without_summary;
+  size_t with_summary;
+  int rv;
+
+  TEST_BEGIN();
+
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+  init_keg();
+
+  rv = mkdir(BASE_FOR_TEST, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  do_mount(&mount_data_with_summary);
+  create_files();
+  check_files();
+  do_unmount();
+
+  without_summary = measure_mount(&mount_data_without_summary, "without");
+  with_summary = measure_mount(&mount_data_with_summary, "with");
+  rtems_test_assert(with_summary < without_summary);
+
+  /* A file system written without summary nodes must remain mountable */
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+  do_mount(&mount_data_without_summary);
+  create_files();
+  do_unmount();
+
+  do_mount(&mount_data_with_summary);
+  check_files();
+  do_unmount();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 40
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
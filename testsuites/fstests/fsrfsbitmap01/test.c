@@ -466,6 +466,33 @@ rtems_rfs_bitmap_ut_test_bitmap (size_t size)
   rtems_test_assert( rc == 0 );
   rtems_test_assert( control.free == control.size - 1);
 
+  /* Allocate runs of bits following a seed */
+  printf (" 36. Allocate runs of bits and check accounting.\n");
+  rc = rtems_rfs_bitmap_map_alloc_extent(&control, 0, 100, &bit, &clear);
+  rtems_test_assert( rc == 0 );
+  rtems_test_assert( bit == 1 );
+  rtems_test_assert( clear == 100 );
+  rc = rtems_rfs_bitmap_map_set(&control, 200);
+  rtems_test_assert( rc == 0 );
+  /* The run at the seed is preferred even if it is short */
+  rc = rtems_rfs_bitmap_map_alloc_extent(&control, 150, 100, &bit, &clear);
+  rtems_test_assert( rc == 0 );
+  rtems_test_assert( bit == 150 );
+  rtems_test_assert( clear == 50 );
+  /* A long enough run is preferred to the first short run */
+  rc = rtems_rfs_bitmap_map_alloc_extent(&control, 100, 60, &bit, &clear);
+  rtems_test_assert( rc == 0 );
+  rtems_test_assert( bit == 201 );
+  rtems_test_assert( clear == 60 );
+  rc = rtems_rfs_bitmap_map_alloc_extent(&control, size - 5, 10, &bit, &clear);
+  rtems_test_assert( rc == 0 );
+  rtems_test_assert( bit == size - 5 );
+  rtems_test_assert( clear == 5 );
+  rtems_test_assert( control.free == control.size - 1 - 100 - 1 - 50 - 60 - 5);
+  rc = rtems_rfs_bitmap_create_search (&control);
+  rtems_test_assert( rc == 0 );
+  rtems_test_assert( control.free == control.size - 1 - 100 - 1 - 50 - 60 - 5);
+
   rtems_rfs_bitmap_close (&control);
   free (buffer.buffer);
 }
@@ -491,6 +518,7 @@ static void nullpointer_test(void){
   rtems_rfs_bitmap_control control;
   rtems_rfs_bitmap_bit  bit = 0;
   rtems_rfs_bitmap_bit  seed_bit = 0;
+  size_t count;
   int rc;
   bool result;
 
@@ -515,6 +543,8 @@ static void nullpointer_test(void){
   rc = rtems_rfs_bitmap_map_alloc(&control, seed_bit, &result, &bit);
   rtems_test_assert(rc == 0);
   rtems_test_assert(!result);
+  rc = rtems_rfs_bitmap_map_alloc_extent(&control, seed_bit, 1, &bit, &count);
+  rtems_test_assert(rc == ENXIO);
   rc = rtems_rfs_bitmap_map_set(&control, bit);
   rtems_test_assert(rc == ENXIO);
 }
@@ -0,0 +1,374 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+
+const char rtems_test_name[] = "FSRFSBORROW 1";
+
+#define RDA "/dev/rda"
+
+#define MNT "/mnt"
+
+#define FILE_NAME MNT "/file"
+
+#define BLOCK_SIZE 512
+
+#define FILE_SIZE (64 * BLOCK_SIZE + 123)
+
+#define READ_ROUNDS 8
+
+static uint8_t file_data[FILE_SIZE];
+
+static uint8_t buf[FILE_SIZE];
+
+static void init_file_data(void)
+{
+  uint32_t v = 123;
+  size_t i;
+
+  for (i = 0; i < sizeof(file_data); ++i) {
+    v = v * 1664525 + 1013904223;
+    file_data[i] = (uint8_t) (v >> 23);
+  }
+}
+
+static void mount_disk(void)
+{
+  int rv;
+
+  rv = mount_and_make_target_path(
+    RDA,
+    MNT,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void unmount_disk(void)
+{
+  int rv;
+
+  rv = unmount(MNT);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_writev_readv(void)
+{
+  struct iovec iov[3];
+  ssize_t n;
+  int fd;
+  int rv;
+
+  puts("check writev and readv");
+
+  fd = open(FILE_NAME, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  iov[0].iov_base = &file_data[0];
+  iov[0].iov_len = 17;
+  iov[1].iov_base = &file_data[17];
+  iov[1].iov_len = 3 * BLOCK_SIZE;
+  iov[2].iov_base = &file_data[17 + 3 * BLOCK_SIZE];
+  iov[2].iov_len = FILE_SIZE - 17 - 3 * BLOCK_SIZE;
+  n = writev(fd, iov, 3);
+  rtems_test_assert(n == FILE_SIZE);
+
+  rv = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(rv == 0);
+
+  /* The last vector reaches past the end of file */
+  memset(buf, 0, sizeof(buf));
+  iov[0].iov_base = &buf[0];
+  iov[0].iov_len = BLOCK_SIZE + 1;
+  iov[1].iov_base = &buf[BLOCK_SIZE + 1];
+  iov[1].iov_len = 7;
+  iov[2].iov_base = &buf[BLOCK_SIZE + 8];
+  iov[2].iov_len = sizeof(buf);
+  n = readv(fd, iov, 3);
+  rtems_test_assert(n == FILE_SIZE);
+  rtems_test_assert(memcmp(buf, file_data, FILE_SIZE) == 0);
+
+  n = readv(fd, iov, 3);
+  rtems_test_assert(n == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static size_t borrow_file(int fd, bool check)
+{
+  size_t offset = 0;
+
+  while (true) {
+    rtems_filio_borrow borrow;
+    int rv;
+
+    borrow.size = 0;
+    rv = ioctl(fd, RTEMS_FILIO_BORROW, &borrow);
+    rtems_test_assert(rv == 0);
+
+    if (borrow.size == 0) {
+      rtems_test_assert(borrow.handle == NULL);
+      break;
+    }
+
+    rtems_test_assert(borrow.size <= BLOCK_SIZE);
+    rtems_test_assert(offset + borrow.size <= FILE_SIZE);
+
+    if (check) {
+      rtems_test_assert(
+        memcmp(borrow.data, &file_data[offset], borrow.size) == 0
+      );
+    } else {
+      memcpy(&buf[offset], borrow.data, borrow.size);
+    }
+
+    offset += borrow.size;
+
+    rv = ioctl(fd, RTEMS_FILIO_RELEASE, &borrow);
+    rtems_test_assert(rv == 0);
+    rtems_test_assert(borrow.handle == NULL);
+  }
+
+  return offset;
+}
+
+static void test_borrow(void)
+{
+  rtems_filio_borrow borrow;
+  rtems_filio_borrow other;
+  off_t off;
+  size_t size;
+  int fd;
+  int rv;
+
+  puts("check borrow");
+
+  fd = open(FILE_NAME, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  size = borrow_file(fd, true);
+  rtems_test_assert(size == FILE_SIZE);
+
+  /* The borrow is limited by the requested size */
+  off = lseek(fd, 3, SEEK_SET);
+  rtems_test_assert(off == 3);
+  borrow.size = 5;
+  rv = ioctl(fd, RTEMS_FILIO_BORROW, &borrow);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(borrow.size == 5);
+  rtems_test_assert(memcmp(borrow.data, &file_data[3], 5) == 0);
+  off = lseek(fd, 0, SEEK_CUR);
+  rtems_test_assert(off == 8);
+
+  /* The borrowed data stays valid while more data is read */
+  rv = read(fd, buf, sizeof(buf));
+  rtems_test_assert(rv == FILE_SIZE - 8);
+  rtems_test_assert(memcmp(borrow.data, &file_data[3], 5) == 0);
+
+  other = borrow;
+  other.handle = &other;
+  rv = ioctl(fd, RTEMS_FILIO_RELEASE, &other);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  rv = ioctl(fd, RTEMS_FILIO_RELEASE, &borrow);
+  rtems_test_assert(rv == 0);
+
+  rv = ioctl(fd, RTEMS_FILIO_RELEASE, &other);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  /* Outstanding borrows are released by the close */
+  off = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(off == 0);
+  borrow.size = 0;
+  rv = ioctl(fd, RTEMS_FILIO_BORROW, &borrow);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(borrow.size == BLOCK_SIZE);
+  other.size = 0;
+  rv = ioctl(fd, RTEMS_FILIO_BORROW, &other);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(other.size == BLOCK_SIZE);
+  rtems_test_assert(
+    memcmp(other.data, &file_data[BLOCK_SIZE], BLOCK_SIZE) == 0
+  );
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  /* Borrowing needs a file descriptor open for reading */
+  fd = open(FILE_NAME, O_WRONLY);
+  rtems_test_assert(fd >= 0);
+
+  borrow.size = 0;
+  errno = 0;
+  rv = ioctl(fd, RTEMS_FILIO_BORROW, &borrow);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EBADF);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void measure_read(void)
+{
+  uint64_t t0;
+  uint64_t t1;
+  uint64_t t2;
+  int fd;
+  int rv;
+  int i;
+
+  fd = open(FILE_NAME, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < READ_ROUNDS; ++i) {
+    ssize_t n;
+    off_t off;
+
+    off = lseek(fd, 0, SEEK_SET);
+    rtems_test_assert(off == 0);
+
+    do {
+      n = read(fd, buf, BLOCK_SIZE);
+      rtems_test_assert(n >= 0);
+    } while (n > 0);
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < READ_ROUNDS; ++i) {
+    size_t size;
+    off_t off;
+
+    off = lseek(fd, 0, SEEK_SET);
+    rtems_test_assert(off == 0);
+
+    size = borrow_file(fd, false);
+    rtems_test_assert(size == FILE_SIZE);
+  }
+
+  t2 = rtems_clock_get_uptime_nanoseconds();
+
+  rtems_test_assert(memcmp(buf, file_data, FILE_SIZE) == 0);
+
+  printf(
+    "read %i bytes with read: %" PRIu64 "ns, with borrow: %" PRIu64 "ns\n",
+    READ_ROUNDS * FILE_SIZE,
+    t1 - t0,
+    t2 - t1
+  );
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(void)
+{
+  static const rtems_rfs_format_config config = {
+    .block_size = BLOCK_SIZE
+  };
+
+  int rv;
+
+  init_file_data();
+
+  rv = rtems_rfs_format(RDA, &config);
+  rtems_test_assert(rv == 0);
+
+  mount_disk();
+  test_writev_readv();
+  test_borrow();
+  measure_read();
+  unmount_disk();
+
+  puts("check file after unmount");
+  mount_disk();
+  test_borrow();
+  unmount_disk();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = BLOCK_SIZE, .block_num = 1024 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,533 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/libio_.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/rfs/rtems-rfs-buffer.h>
+#include <rtems/rfs/rtems-rfs-file-system.h>
+
+const char rtems_test_name[] = "FSRFSBUFINDEX 1";
+
+#define RDA "/dev/rda"
+
+#define MNT "/mnt"
+
+#define MAX_HELD_BUFFERS 2
+
+#define ANY_SLOT UINT32_MAX
+
+/*
+ * The first blocks are the blocks held in the index of 16 entries. The slots
+ * are the home slots of the blocks. The chain of slot 14 wraps around the end
+ * of the index and the chain of slot 15 is interleaved with it:
+ *
+ * slot:  14 15  0  1  2  3  4  5
+ * block: A0 B0 A1 A2 B1 A3 C0 C1
+ *
+ * The G blocks grow the index.
+ */
+typedef enum {
+  BLOCK_A0,
+  BLOCK_B0,
+  BLOCK_A1,
+  BLOCK_A2,
+  BLOCK_B1,
+  BLOCK_A3,
+  BLOCK_C0,
+  BLOCK_C1,
+  BLOCK_G0,
+  BLOCK_G1,
+  BLOCK_G2,
+  BLOCK_G3,
+  BLOCK_G4,
+  BLOCK_G5,
+  BLOCK_COUNT
+} test_block_id;
+
+typedef struct {
+  rtems_rfs_buffer_block block;
+  rtems_rfs_buffer_handle handle;
+  rtems_rfs_buffer *buffer;
+  bool indexed;
+} test_block;
+
+static test_block test_blocks[BLOCK_COUNT];
+
+static rtems_rfs_buffer_block next_block;
+
+/*
+ * The released blocks in the local cache of the file system with the least
+ * recently used first.
+ */
+static test_block_id cached[BLOCK_COUNT];
+
+static size_t cached_count;
+
+static uint32_t index_hash(
+  const rtems_rfs_file_system *fs,
+  rtems_rfs_buffer_block block
+)
+{
+  uint32_t hash = ((uint32_t) block) * UINT32_C(0x9e3779b1);
+  return (hash ^ (hash >> 16)) & (fs->buffer_index_size - 1);
+}
+
+static const rtems_rfs_buffer_index_entry *find_entry(
+  const rtems_rfs_file_system *fs,
+  rtems_rfs_buffer_block block
+)
+{
+  uint32_t slot;
+
+  slot = index_hash(fs, block);
+
+  while (fs->buffer_index[slot].buffer != NULL) {
+    if (fs->buffer_index[slot].block == block) {
+      return &fs->buffer_index[slot];
+    }
+
+    slot = (slot + 1) & (fs->buffer_index_size - 1);
+  }
+
+  return NULL;
+}
+
+static uint32_t entry_slot(
+  const rtems_rfs_file_system *fs,
+  test_block_id id
+)
+{
+  const rtems_rfs_buffer_index_entry *entry;
+
+  entry = find_entry(fs, test_blocks[id].block);
+  rtems_test_assert(entry != NULL);
+
+  return (uint32_t) (entry - fs->buffer_index);
+}
+
+static void check_index(const rtems_rfs_file_system *fs)
+{
+  uint32_t mask = fs->buffer_index_size - 1;
+  uint32_t count = 0;
+  uint32_t slot;
+  size_t i;
+
+  rtems_test_assert(fs->buffer_index_size >= RTEMS_RFS_BUFFER_INDEX_MIN_SIZE);
+  rtems_test_assert((fs->buffer_index_size & mask) == 0);
+
+  for (slot = 0; slot < fs->buffer_index_size; ++slot) {
+    const rtems_rfs_buffer_index_entry *entry = &fs->buffer_index[slot];
+    uint32_t probe;
+
+    if (entry->buffer == NULL) {
+      continue;
+    }
+
+    ++count;
+
+    /* There are no holes between the home slot and the entry */
+    for (probe = index_hash(fs, entry->block); probe != slot;
+         probe = (probe + 1) & mask) {
+      rtems_test_assert(fs->buffer_index[probe].buffer != NULL);
+    }
+
+    /* The look up finds this entry and there is no other entry of the block */
+    rtems_test_assert(find_entry(fs, entry->block) == entry);
+    rtems_test_assert(
+      (rtems_rfs_buffer_block) ((intptr_t) entry->buffer->user) == entry->block
+    );
+  }
+
+  rtems_test_assert(count == fs->buffer_index_count);
+  rtems_test_assert(count * 2 <= fs->buffer_index_size);
+
+  for (i = 0; i < BLOCK_COUNT; ++i) {
+    const test_block *tb = &test_blocks[i];
+    const rtems_rfs_buffer_index_entry *entry;
+
+    if (tb->block == 0) {
+      continue;
+    }
+
+    entry = find_entry(fs, tb->block);
+
+    if (tb->indexed) {
+      rtems_test_assert(entry != NULL);
+      rtems_test_assert(entry->buffer == tb->buffer);
+    } else {
+      rtems_test_assert(entry == NULL);
+    }
+  }
+
+  rtems_test_assert(
+    fs->release_count + fs->release_modified_count == cached_count
+  );
+}
+
+static void pick_block(
+  const rtems_rfs_file_system *fs,
+  test_block_id id,
+  uint32_t home
+)
+{
+  while (home != ANY_SLOT && index_hash(fs, next_block) != home) {
+    ++next_block;
+  }
+
+  rtems_test_assert(next_block < rtems_rfs_fs_blocks(fs));
+  test_blocks[id].block = next_block;
+  ++next_block;
+}
+
+static bool remove_cached(test_block_id id)
+{
+  size_t i;
+
+  for (i = 0; i < cached_count; ++i) {
+    if (cached[i] == id) {
+      --cached_count;
+      memmove(
+        &cached[i],
+        &cached[i + 1],
+        (cached_count - i) * sizeof(cached[0])
+      );
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static void request_block(rtems_rfs_file_system *fs, test_block_id id)
+{
+  test_block *tb = &test_blocks[id];
+  bool was_cached;
+  int rc;
+
+  was_cached = remove_cached(id);
+  rtems_test_assert(was_cached == tb->indexed);
+
+  rc = rtems_rfs_buffer_handle_open(fs, &tb->handle);
+  rtems_test_assert(rc == 0);
+
+  rc = rtems_rfs_buffer_handle_request(fs, &tb->handle, tb->block, true);
+  rtems_test_assert(rc == 0);
+  rtems_test_assert(rtems_rfs_buffer_refs(&tb->handle) == 1);
+
+  if (was_cached) {
+    rtems_test_assert(tb->handle.buffer == tb->buffer);
+  }
+
+  tb->buffer = tb->handle.buffer;
+  tb->indexed = true;
+
+  check_index(fs);
+}
+
+static void release_block(rtems_rfs_file_system *fs, test_block_id id)
+{
+  int rc;
+
+  if (cached_count >= MAX_HELD_BUFFERS) {
+    test_blocks[cached[0]].indexed = false;
+    remove_cached(cached[0]);
+  }
+
+  rc = rtems_rfs_buffer_handle_close(fs, &test_blocks[id].handle);
+  rtems_test_assert(rc == 0);
+
+  cached[cached_count] = id;
+  ++cached_count;
+
+  check_index(fs);
+}
+
+static rtems_rfs_file_system *mount_disk(void)
+{
+  rtems_rfs_file_system *fs;
+  int fd;
+  int rv;
+
+  rv = mount_and_make_target_path(
+    RDA,
+    MNT,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    "max-held-bufs=2"
+  );
+  rtems_test_assert(rv == 0);
+
+  fd = open(MNT, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  fs = rtems_libio_iop(fd)->pathinfo.mt_entry->fs_info;
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(fs->max_held_buffers == MAX_HELD_BUFFERS);
+
+  return fs;
+}
+
+static void fill_index(rtems_rfs_file_system *fs)
+{
+  puts("fill the index beyond the maximum of held buffers");
+
+  pick_block(fs, BLOCK_A0, 14);
+  pick_block(fs, BLOCK_A1, 14);
+  pick_block(fs, BLOCK_A2, 14);
+  pick_block(fs, BLOCK_A3, 14);
+  pick_block(fs, BLOCK_B0, 15);
+  pick_block(fs, BLOCK_B1, 15);
+  pick_block(fs, BLOCK_C0, 3);
+  pick_block(fs, BLOCK_C1, 3);
+
+  request_block(fs, BLOCK_A0);
+  request_block(fs, BLOCK_B0);
+  request_block(fs, BLOCK_A1);
+  request_block(fs, BLOCK_A2);
+  request_block(fs, BLOCK_B1);
+  request_block(fs, BLOCK_A3);
+  request_block(fs, BLOCK_C0);
+  request_block(fs, BLOCK_C1);
+
+  rtems_test_assert(fs->buffer_index_size == RTEMS_RFS_BUFFER_INDEX_MIN_SIZE);
+  rtems_test_assert(fs->buffer_index_count == 8);
+  rtems_test_assert(fs->buffers_count == 8);
+  rtems_test_assert(fs->buffers_count > fs->max_held_buffers);
+
+  rtems_test_assert(entry_slot(fs, BLOCK_A0) == 14);
+  rtems_test_assert(entry_slot(fs, BLOCK_B0) == 15);
+  rtems_test_assert(entry_slot(fs, BLOCK_A1) == 0);
+  rtems_test_assert(entry_slot(fs, BLOCK_A2) == 1);
+  rtems_test_assert(entry_slot(fs, BLOCK_B1) == 2);
+  rtems_test_assert(entry_slot(fs, BLOCK_A3) == 3);
+  rtems_test_assert(entry_slot(fs, BLOCK_C0) == 4);
+  rtems_test_assert(entry_slot(fs, BLOCK_C1) == 5);
+}
+
+static void share_block(rtems_rfs_file_system *fs)
+{
+  rtems_rfs_buffer_handle handle;
+  int rc;
+
+  puts("share a buffer in the middle of a probe chain");
+
+  rc = rtems_rfs_buffer_handle_open(fs, &handle);
+  rtems_test_assert(rc == 0);
+
+  rc = rtems_rfs_buffer_handle_request(fs, &handle, test_blocks[BLOCK_A2].block,
+                                       true);
+  rtems_test_assert(rc == 0);
+  rtems_test_assert(handle.buffer == test_blocks[BLOCK_A2].buffer);
+  rtems_test_assert(rtems_rfs_buffer_refs(&handle) == 2);
+  rtems_test_assert(fs->buffer_index_count == 8);
+  rtems_test_assert(fs->buffers_count == 8);
+
+  rc = rtems_rfs_buffer_handle_close(fs, &handle);
+  rtems_test_assert(rc == 0);
+  rtems_test_assert(rtems_rfs_buffer_refs(&test_blocks[BLOCK_A2].handle) == 1);
+
+  check_index(fs);
+}
+
+static void delete_in_chains(rtems_rfs_file_system *fs)
+{
+  puts("delete in the middle of the probe chains");
+
+  rtems_rfs_buffer_mark_dirty(&test_blocks[BLOCK_B0].handle);
+
+  release_block(fs, BLOCK_A1);
+  release_block(fs, BLOCK_B0);
+  rtems_test_assert(fs->release_count == 1);
+  rtems_test_assert(fs->release_modified_count == 1);
+  rtems_test_assert(fs->buffer_index_count == 8);
+
+  /* The local cache is full, the least recently used A1 leaves the index */
+  release_block(fs, BLOCK_A3);
+  rtems_test_assert(!test_blocks[BLOCK_A1].indexed);
+  rtems_test_assert(fs->buffer_index_count == 7);
+
+  /* The entries behind the hole moved back */
+  rtems_test_assert(entry_slot(fs, BLOCK_A0) == 14);
+  rtems_test_assert(entry_slot(fs, BLOCK_B0) == 15);
+  rtems_test_assert(entry_slot(fs, BLOCK_A2) == 0);
+  rtems_test_assert(entry_slot(fs, BLOCK_B1) == 1);
+  rtems_test_assert(entry_slot(fs, BLOCK_A3) == 2);
+  rtems_test_assert(entry_slot(fs, BLOCK_C0) == 3);
+  rtems_test_assert(entry_slot(fs, BLOCK_C1) == 4);
+  rtems_test_assert(fs->buffer_index[5].buffer == NULL);
+
+  /* The modified B0 is the least recently used buffer */
+  release_block(fs, BLOCK_C0);
+  rtems_test_assert(!test_blocks[BLOCK_B0].indexed);
+  rtems_test_assert(fs->release_modified_count == 0);
+  rtems_test_assert(fs->release_count == 2);
+  rtems_test_assert(fs->buffer_index_count == 6);
+  rtems_test_assert(entry_slot(fs, BLOCK_A0) == 14);
+  rtems_test_assert(entry_slot(fs, BLOCK_A2) == 15);
+  rtems_test_assert(entry_slot(fs, BLOCK_B1) == 0);
+
+  /* A block in the local cache is found again */
+  request_block(fs, BLOCK_A3);
+  rtems_test_assert(fs->release_count == 1);
+  rtems_test_assert(fs->buffer_index_count == 6);
+}
+
+static void grow_index(rtems_rfs_file_system *fs)
+{
+  test_block_id id;
+
+  puts("grow the index");
+
+  for (id = BLOCK_G0; id < BLOCK_COUNT; ++id) {
+    pick_block(fs, id, ANY_SLOT);
+    request_block(fs, id);
+  }
+
+  rtems_test_assert(
+    fs->buffer_index_size == 2 * RTEMS_RFS_BUFFER_INDEX_MIN_SIZE
+  );
+  rtems_test_assert(fs->buffer_index_count == 12);
+
+  /* A deleted block is not found after the index grew */
+  request_block(fs, BLOCK_A1);
+  rtems_test_assert(fs->buffer_index_count == 13);
+}
+
+static void release_all(rtems_rfs_file_system *fs)
+{
+  test_block_id id;
+  int rc;
+
+  puts("release all buffers");
+
+  for (id = 0; id < BLOCK_COUNT; ++id) {
+    if (id != BLOCK_B0 && id != BLOCK_C0) {
+      release_block(fs, id);
+    }
+  }
+
+  rtems_test_assert(fs->buffers_count == 0);
+  rtems_test_assert(fs->buffer_index_count == MAX_HELD_BUFFERS);
+
+  rc = rtems_rfs_buffers_release(fs);
+  rtems_test_assert(rc == 0);
+
+  for (id = 0; id < BLOCK_COUNT; ++id) {
+    test_blocks[id].indexed = false;
+  }
+
+  cached_count = 0;
+
+  rtems_test_assert(fs->buffer_index_count == 0);
+  check_index(fs);
+}
+
+static void test(void)
+{
+  static const rtems_rfs_format_config config = {
+    .block_size = 512
+  };
+
+  rtems_rfs_file_system *fs;
+  int rc;
+  int rv;
+
+  rv = rtems_rfs_format(RDA, &config);
+  rtems_test_assert(rv == 0);
+
+  fs = mount_disk();
+
+  rc = rtems_rfs_buffers_release(fs);
+  rtems_test_assert(rc == 0);
+  rtems_test_assert(fs->buffers_count == 0);
+  rtems_test_assert(fs->buffer_index_count == 0);
+  rtems_test_assert(fs->buffer_index_size == RTEMS_RFS_BUFFER_INDEX_MIN_SIZE);
+
+  next_block = 1;
+
+  fill_index(fs);
+  share_block(fs);
+  delete_in_chains(fs);
+  grow_index(fs);
+  release_all(fs);
+
+  rv = unmount(MNT);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = 512, .block_num = 1024 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
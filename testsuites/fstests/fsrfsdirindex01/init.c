@@ -0,0 +1,324 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/libio_.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/rfs/rtems-rfs-dir.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
+
+const char rtems_test_name[] = "FSRFSDIRINDEX 1";
+
+#define RDA "/dev/rda"
+
+#define MNT "/mnt"
+
+#define DIR MNT "/dir"
+
+#define FILE_COUNT 300
+
+static void mount_disk(const char *options)
+{
+  int rv;
+
+  rv = mount_and_make_target_path(
+    RDA,
+    MNT,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    options
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void unmount_disk(void)
+{
+  int rv;
+
+  rv = unmount(MNT);
+  rtems_test_assert(rv == 0);
+}
+
+static void file_name(char *path, size_t size, const char *prefix, int i)
+{
+  int n;
+
+  n = snprintf(path, size, DIR "/%s-%03d", prefix, i);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void create_file(const char *prefix, int i)
+{
+  char path[64];
+  int fd;
+  int rv;
+
+  file_name(path, sizeof(path), prefix, i);
+  fd = open(path, O_RDWR | O_CREAT | O_EXCL, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(fd >= 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void remove_file(const char *prefix, int i)
+{
+  char path[64];
+  int rv;
+
+  file_name(path, sizeof(path), prefix, i);
+  rv = unlink(path);
+  rtems_test_assert(rv == 0);
+}
+
+static bool file_exists(const char *prefix, int i)
+{
+  char path[64];
+  struct stat st;
+  int rv;
+
+  file_name(path, sizeof(path), prefix, i);
+  rv = stat(path, &st);
+
+  if (rv != 0) {
+    rtems_test_assert(errno == ENOENT);
+    return false;
+  }
+
+  rtems_test_assert(S_ISREG(st.st_mode));
+  return true;
+}
+
+static void check_files(void)
+{
+  int i;
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    rtems_test_assert(file_exists("file", i) == ((i % 3) != 0));
+    rtems_test_assert(file_exists("new", i) == ((i % 3) == 0));
+  }
+}
+
+static void lookup_files(const char *options)
+{
+  uint64_t t0;
+  uint64_t t1;
+  int i;
+
+  mount_disk(options);
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    rtems_test_assert(file_exists("file", i));
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+
+  printf(
+    "lookup of %i files %s index: %" PRIu64 "ns\n",
+    FILE_COUNT,
+    options != NULL ? "with" : "without",
+    t1 - t0
+  );
+
+  rtems_test_assert(!file_exists("none", 0));
+
+  unmount_disk();
+}
+
+static rtems_rfs_dir_index *get_dir_index(int fd, rtems_rfs_file_system **fs)
+{
+  struct stat st;
+  int rv;
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+
+  *fs = rtems_libio_iop(fd)->pathinfo.mt_entry->fs_info;
+  return rtems_rfs_dir_index_find(*fs, st.st_ino);
+}
+
+static void fill_new_blocks(void)
+{
+  rtems_rfs_file_system *fs;
+  rtems_rfs_dir_index *index;
+  uint32_t block_count;
+  uint32_t bno;
+  int fd;
+  int rv;
+  int i;
+
+  puts("fill new directory blocks with index");
+  mount_disk("dir-index");
+
+  /* The look up builds the index */
+  rtems_test_assert(file_exists("file", 1));
+
+  fd = open(DIR, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  index = get_dir_index(fd, &fs);
+  rtems_test_assert(index != NULL);
+  block_count = index->block_count;
+
+  /* Grow the directory until the first new block is full */
+  i = 0;
+
+  while (index->block_count < block_count + 2) {
+    create_file("grow", i);
+    ++i;
+
+    index = get_dir_index(fd, &fs);
+    rtems_test_assert(index != NULL);
+  }
+
+  for (bno = 0; bno < index->block_count; ++bno) {
+    rtems_test_assert(index->block_free[bno] <= rtems_rfs_fs_block_size(fs));
+  }
+
+  rtems_test_assert(
+    index->block_free[block_count] <= RTEMS_RFS_DIR_ENTRY_SIZE + 8
+  );
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  unmount_disk();
+
+  mount_disk(NULL);
+
+  while (i > 0) {
+    --i;
+    rtems_test_assert(file_exists("grow", i));
+  }
+
+  unmount_disk();
+}
+
+static void test(void)
+{
+  static const rtems_rfs_format_config config = {
+    .block_size = 512,
+    .inode_overhead = 30
+  };
+
+  int rv;
+  int i;
+
+  rv = rtems_rfs_format(RDA, &config);
+  rtems_test_assert(rv == 0);
+
+  puts("create files");
+  mount_disk(NULL);
+
+  rv = mkdir(DIR, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    create_file("file", i);
+  }
+
+  unmount_disk();
+
+  lookup_files(NULL);
+  lookup_files("dir-index");
+
+  puts("remove and create files with index");
+  mount_disk("dir-index");
+
+  for (i = 0; i < FILE_COUNT; i += 3) {
+    remove_file("file", i);
+  }
+
+  for (i = 0; i < FILE_COUNT; i += 3) {
+    create_file("new", i);
+  }
+
+  check_files();
+  unmount_disk();
+
+  puts("check files without index");
+  mount_disk(NULL);
+  check_files();
+  unmount_disk();
+
+  fill_new_blocks();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = 512, .block_num = 1024 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,361 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/libio_.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/rfs/rtems-rfs-block.h>
+#include <rtems/rfs/rtems-rfs-inode.h>
+
+const char rtems_test_name[] = "FSRFSEXTENT 1";
+
+#define RDA "/dev/rda"
+
+#define MNT "/mnt"
+
+#define FILE_NAME MNT "/file"
+
+#define OTHER_FILE_NAME MNT "/other"
+
+#define BLOCK_SIZE 512
+
+#define FILE_BLOCKS 200
+
+#define FILE_SIZE (FILE_BLOCKS * BLOCK_SIZE - 77)
+
+#define TRUNCATE_SIZE (100 * BLOCK_SIZE + 17)
+
+static uint8_t file_data[FILE_SIZE];
+
+static uint8_t buf[FILE_SIZE];
+
+static void init_file_data(void)
+{
+  uint32_t v = 123;
+  size_t i;
+
+  for (i = 0; i < sizeof(file_data); ++i) {
+    v = v * 1664525 + 1013904223;
+    file_data[i] = (uint8_t) (v >> 23);
+  }
+}
+
+static void mount_disk(void)
+{
+  int rv;
+
+  rv = mount_and_make_target_path(
+    RDA,
+    MNT,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void unmount_disk(void)
+{
+  int rv;
+
+  rv = unmount(MNT);
+  rtems_test_assert(rv == 0);
+}
+
+static fsblkcnt_t get_free_blocks(void)
+{
+  struct statvfs sfs;
+  int rv;
+
+  rv = statvfs(MNT, &sfs);
+  rtems_test_assert(rv == 0);
+
+  return sfs.f_bfree;
+}
+
+/*
+ * Returns the number of runs of consecutive blocks the data blocks of the file
+ * are in.
+ */
+static size_t count_runs(const char *path, off_t size)
+{
+  rtems_rfs_file_system *fs;
+  rtems_rfs_inode_handle inode;
+  rtems_rfs_block_map map;
+  rtems_rfs_buffer_block last;
+  rtems_rfs_block_no blocks;
+  rtems_rfs_block_no bno;
+  struct stat st;
+  size_t runs;
+  int fd;
+  int rc;
+  int rv;
+
+  fd = open(path, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == size);
+
+  fs = rtems_libio_iop(fd)->pathinfo.mt_entry->fs_info;
+
+  rc = rtems_rfs_inode_open(fs, st.st_ino, &inode, true);
+  rtems_test_assert(rc == 0);
+
+  rc = rtems_rfs_block_map_open(fs, &inode, &map);
+  rtems_test_assert(rc == 0);
+
+  blocks = (rtems_rfs_block_no) ((size + BLOCK_SIZE - 1) / BLOCK_SIZE);
+  rtems_test_assert(rtems_rfs_block_map_count(&map) == blocks);
+
+  runs = 0;
+  last = 0;
+
+  for (bno = 0; bno < blocks; ++bno) {
+    rtems_rfs_block_pos bpos;
+    rtems_rfs_buffer_block block;
+
+    bpos.bno = bno;
+    bpos.boff = 0;
+    bpos.block = 0;
+    rc = rtems_rfs_block_map_find(fs, &map, &bpos, &block);
+    rtems_test_assert(rc == 0);
+
+    if (bno == 0 || block != last + 1) {
+      ++runs;
+    }
+
+    last = block;
+  }
+
+  rc = rtems_rfs_block_map_close(fs, &map);
+  rtems_test_assert(rc == 0);
+
+  rc = rtems_rfs_inode_close(fs, &inode);
+  rtems_test_assert(rc == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return runs;
+}
+
+static void check_file(const char *path, const void *data, size_t size)
+{
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(path, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  memset(buf, 0xff, sizeof(buf));
+  n = read(fd, buf, sizeof(buf));
+  rtems_test_assert(n == (ssize_t) size);
+
+  if (data != NULL) {
+    rtems_test_assert(memcmp(buf, data, size) == 0);
+  } else {
+    size_t i;
+
+    for (i = 0; i < size; ++i) {
+      rtems_test_assert(buf[i] == 0);
+    }
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_sequential_write(void)
+{
+  ssize_t n;
+  int fd;
+  int rv;
+
+  puts("check sequential write");
+
+  fd = open(FILE_NAME, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  /* The first write ends within a block, the second write fills it first */
+  n = write(fd, &file_data[0], 3);
+  rtems_test_assert(n == 3);
+  n = write(fd, &file_data[3], FILE_SIZE - 3);
+  rtems_test_assert(n == FILE_SIZE - 3);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(count_runs(FILE_NAME, FILE_SIZE) == 1);
+  check_file(FILE_NAME, file_data, FILE_SIZE);
+}
+
+static void test_truncate(void)
+{
+  int rv;
+
+  puts("check grow by truncate");
+
+  rv = open(OTHER_FILE_NAME, O_RDWR | O_CREAT, S_IRWXU);
+  rtems_test_assert(rv >= 0);
+  rv = close(rv);
+  rtems_test_assert(rv == 0);
+
+  rv = truncate(OTHER_FILE_NAME, TRUNCATE_SIZE);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(count_runs(OTHER_FILE_NAME, TRUNCATE_SIZE) == 1);
+  check_file(OTHER_FILE_NAME, NULL, TRUNCATE_SIZE);
+
+  rv = unlink(OTHER_FILE_NAME);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_no_space(void)
+{
+  fsblkcnt_t free_blocks;
+  struct stat st;
+  off_t size;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  puts("check write until the file system is full");
+
+  free_blocks = get_free_blocks();
+
+  fd = open(OTHER_FILE_NAME, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  size = 0;
+
+  do {
+    n = write(fd, file_data, FILE_SIZE);
+    rtems_test_assert(n >= 0 || errno == ENOSPC);
+
+    if (n > 0) {
+      size += n;
+    }
+  } while (n == FILE_SIZE);
+
+  rtems_test_assert(size > FILE_SIZE);
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == size);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(get_free_blocks() < free_blocks);
+
+  rv = unlink(OTHER_FILE_NAME);
+  rtems_test_assert(rv == 0);
+
+  /* The blocks allocated in advance of the write are not lost */
+  rtems_test_assert(get_free_blocks() == free_blocks);
+}
+
+static void test(void)
+{
+  static const rtems_rfs_format_config config = {
+    .block_size = BLOCK_SIZE
+  };
+
+  int rv;
+
+  init_file_data();
+
+  rv = rtems_rfs_format(RDA, &config);
+  rtems_test_assert(rv == 0);
+
+  mount_disk();
+  test_sequential_write();
+  test_truncate();
+  test_no_space();
+  unmount_disk();
+
+  puts("check file after unmount");
+  mount_disk();
+  rtems_test_assert(count_runs(FILE_NAME, FILE_SIZE) == 1);
+  check_file(FILE_NAME, file_data, FILE_SIZE);
+  unmount_disk();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = BLOCK_SIZE, .block_num = 1024 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
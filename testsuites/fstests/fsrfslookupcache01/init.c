@@ -0,0 +1,414 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/libio_.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+
+const char rtems_test_name[] = "FSRFSLOOKUPCACHE 1";
+
+#define RDA "/dev/rda"
+
+#define MNT "/mnt"
+
+#define DIR MNT "/a/b/c/d"
+
+#define FILE_COUNT 100
+
+#define LOOKUP_ROUNDS 4
+
+static void mount_disk(const char *options)
+{
+  int rv;
+
+  rv = mount_and_make_target_path(
+    RDA,
+    MNT,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    options
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void unmount_disk(void)
+{
+  int rv;
+
+  rv = unmount(MNT);
+  rtems_test_assert(rv == 0);
+}
+
+static bool find_mnt(
+  const rtems_filesystem_mount_table_entry_t *mt_entry,
+  void *arg
+)
+{
+  const rtems_filesystem_mount_table_entry_t **found = arg;
+
+  if (strcmp(mt_entry->target, MNT) == 0) {
+    *found = mt_entry;
+    return true;
+  }
+
+  return false;
+}
+
+static int get_stats(rtems_filesystem_lookup_cache_stats *stats)
+{
+  const rtems_filesystem_mount_table_entry_t *mt_entry = NULL;
+
+  rtems_filesystem_mount_iterate(find_mnt, &mt_entry);
+  rtems_test_assert(mt_entry != NULL);
+
+  return rtems_filesystem_lookup_cache_get_stats(mt_entry, stats);
+}
+
+static void file_name(char *path, size_t size, const char *prefix, int i)
+{
+  int n;
+
+  n = snprintf(path, size, DIR "/%s-%03d", prefix, i);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void create_file(const char *path)
+{
+  int fd;
+  int rv;
+
+  fd = open(path, O_RDWR | O_CREAT | O_EXCL, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(fd >= 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static bool path_exists(const char *path)
+{
+  struct stat st;
+  int rv;
+
+  rv = stat(path, &st);
+
+  if (rv != 0) {
+    rtems_test_assert(errno == ENOENT);
+    return false;
+  }
+
+  return true;
+}
+
+static void lookup_files(const char *options)
+{
+  uint64_t t0;
+  uint64_t t1;
+  int round;
+  int i;
+
+  mount_disk(options);
+
+  t0 = rtems_clock_get_uptime_nanoseconds();
+
+  for (round = 0; round < LOOKUP_ROUNDS; ++round) {
+    for (i = 0; i < FILE_COUNT; ++i) {
+      char path[64];
+
+      file_name(path, sizeof(path), "file", i);
+      rtems_test_assert(path_exists(path));
+      file_name(path, sizeof(path), "none", i);
+      rtems_test_assert(!path_exists(path));
+    }
+  }
+
+  t1 = rtems_clock_get_uptime_nanoseconds();
+
+  printf(
+    "lookup of %i paths %s cache: %" PRIu64 "ns\n",
+    2 * FILE_COUNT * LOOKUP_ROUNDS,
+    options != NULL ? "with" : "without",
+    t1 - t0
+  );
+
+  if (options != NULL) {
+    rtems_filesystem_lookup_cache_stats stats;
+    int rv;
+
+    rv = get_stats(&stats);
+    rtems_test_assert(rv == 0);
+    printf(
+      "hits %" PRIu32 ", negative hits %" PRIu32 ", misses %" PRIu32 "\n",
+      stats.hits,
+      stats.negative_hits,
+      stats.misses
+    );
+    rtems_test_assert(stats.hits > 0);
+    rtems_test_assert(stats.negative_hits > 0);
+  } else {
+    rtems_filesystem_lookup_cache_stats stats;
+    int rv;
+
+    rv = get_stats(&stats);
+    rtems_test_assert(rv == -1);
+    rtems_test_assert(errno == ENOTSUP);
+  }
+
+  unmount_disk();
+}
+
+static void test_invalidation(void)
+{
+  char target[PATH_MAX];
+  ssize_t n;
+  int rv;
+
+  puts("check invalidation");
+  mount_disk("lookup-cache=8");
+
+  /* Negative entries must be dropped by the creation of the name */
+  rtems_test_assert(!path_exists(MNT "/x"));
+  create_file(MNT "/x");
+  rtems_test_assert(path_exists(MNT "/x"));
+
+  rtems_test_assert(!path_exists(MNT "/y"));
+  rv = mkdir(MNT "/y", S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(path_exists(MNT "/y"));
+
+  rtems_test_assert(!path_exists(MNT "/y/z"));
+  rv = link(MNT "/x", MNT "/y/z");
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(path_exists(MNT "/y/z"));
+
+  rtems_test_assert(!path_exists(MNT "/s"));
+  rv = symlink("x", MNT "/s");
+  rtems_test_assert(rv == 0);
+  n = readlink(MNT "/s", target, sizeof(target));
+  rtems_test_assert(n == 1 && target[0] == 'x');
+
+  /* Positive entries must be dropped by the removal of the node */
+  rv = unlink(MNT "/x");
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(!path_exists(MNT "/x"));
+  rtems_test_assert(path_exists(MNT "/y/z"));
+
+  rtems_test_assert(!path_exists(MNT "/w"));
+  rv = rename(MNT "/y/z", MNT "/w");
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(!path_exists(MNT "/y/z"));
+  rtems_test_assert(path_exists(MNT "/w"));
+
+  rv = rmdir(MNT "/y");
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(!path_exists(MNT "/y"));
+  rtems_test_assert(!path_exists(MNT "/y/z"));
+
+  rv = mkdir(MNT "/y", S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(!path_exists(MNT "/y/z"));
+
+  /* The replacement of entries in a small cache must not lose updates */
+  for (int i = 0; i < FILE_COUNT; ++i) {
+    char path[64];
+
+    file_name(path, sizeof(path), "file", i);
+    rtems_test_assert(path_exists(path));
+  }
+
+  rv = unlink(MNT "/w");
+  rtems_test_assert(rv == 0);
+  rv = unlink(MNT "/s");
+  rtems_test_assert(rv == 0);
+  rv = rmdir(MNT "/y");
+  rtems_test_assert(rv == 0);
+
+  unmount_disk();
+
+  puts("check files without cache");
+  mount_disk(NULL);
+  rtems_test_assert(!path_exists(MNT "/x"));
+  rtems_test_assert(!path_exists(MNT "/y"));
+  rtems_test_assert(!path_exists(MNT "/w"));
+  rtems_test_assert(!path_exists(MNT "/s"));
+  unmount_disk();
+}
+
+static void test_hard_links(void)
+{
+  int rv;
+
+  puts("check hard links in one directory");
+  mount_disk("lookup-cache=32");
+
+  rv = mkdir(MNT "/h", S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+  create_file(MNT "/h/a");
+  rv = link(MNT "/h/a", MNT "/h/b");
+  rtems_test_assert(rv == 0);
+  rv = link(MNT "/h/a", MNT "/h/c");
+  rtems_test_assert(rv == 0);
+  create_file(MNT "/h/e");
+
+  /* Enter the names into the cache */
+  rtems_test_assert(path_exists(MNT "/h/a"));
+  rtems_test_assert(path_exists(MNT "/h/b"));
+  rtems_test_assert(path_exists(MNT "/h/c"));
+  rtems_test_assert(path_exists(MNT "/h/e"));
+
+  /* The removal must remove the name and not another link to the node */
+  rv = unlink(MNT "/h/b");
+  rtems_test_assert(rv == 0);
+
+  /* The removal moved the entry of the cached name */
+  rv = unlink(MNT "/h/e");
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(path_exists(MNT "/h/a"));
+  rtems_test_assert(!path_exists(MNT "/h/b"));
+  rtems_test_assert(path_exists(MNT "/h/c"));
+  rtems_test_assert(!path_exists(MNT "/h/e"));
+
+  /* The rename must remove the old name and not another link to the node */
+  rv = rename(MNT "/h/c", MNT "/h/d");
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(path_exists(MNT "/h/a"));
+  rtems_test_assert(!path_exists(MNT "/h/c"));
+  rtems_test_assert(path_exists(MNT "/h/d"));
+
+  unmount_disk();
+
+  puts("check hard links without cache");
+  mount_disk(NULL);
+  rtems_test_assert(path_exists(MNT "/h/a"));
+  rtems_test_assert(!path_exists(MNT "/h/b"));
+  rtems_test_assert(!path_exists(MNT "/h/c"));
+  rtems_test_assert(path_exists(MNT "/h/d"));
+  rtems_test_assert(!path_exists(MNT "/h/e"));
+
+  rv = unlink(MNT "/h/a");
+  rtems_test_assert(rv == 0);
+  rv = unlink(MNT "/h/d");
+  rtems_test_assert(rv == 0);
+  rv = rmdir(MNT "/h");
+  rtems_test_assert(rv == 0);
+  unmount_disk();
+}
+
+static void test(void)
+{
+  static const rtems_rfs_format_config config = {
+    .block_size = 512,
+    .inode_overhead = 30
+  };
+
+  int rv;
+  int i;
+
+  rv = rtems_rfs_format(RDA, &config);
+  rtems_test_assert(rv == 0);
+
+  puts("create files");
+  mount_disk(NULL);
+
+  rv = mkdir(MNT "/a", S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+  rv = mkdir(MNT "/a/b", S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+  rv = mkdir(MNT "/a/b/c", S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+  rv = mkdir(DIR, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    char path[64];
+
+    file_name(path, sizeof(path), "file", i);
+    create_file(path);
+  }
+
+  unmount_disk();
+
+  lookup_files(NULL);
+  lookup_files("lookup-cache=512");
+  test_invalidation();
+  test_hard_links();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = 512, .block_num = 1024 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
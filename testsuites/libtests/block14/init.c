@@ -94,41 +94,43 @@ static const test_action actions [ACTION_COUNT] = {
   { 7, rtems_bdbuf_read, NULL, RTEMS_SUCCESSFUL, rtems_bdbuf_release },
 };
 
-#define STATS(a, b, c, d, e, f, g, h, i) \
+#define STATS(a, b, c, d, e, f, g, h, i, j, k) \
   { \
     .read_hits = a, \
     .read_misses = b, \
     .read_ahead_transfers = c, \
     .read_ahead_peeks = d, \
-    .read_blocks = e, \
-    .read_errors = f, \
-    .write_transfers = g, \
-    .write_blocks = h, \
-    .write_errors = i \
+    .read_ahead_hits = e, \
+    .read_ahead_misses = f, \
+    .read_blocks = g, \
+    .read_errors = h, \
+    .write_transfers = i, \
+    .write_blocks = j, \
+    .write_errors = k \
   }
 
 static const rtems_blkdev_stats expected_stats [ACTION_COUNT] = {
-  STATS(0, 1, 0, 0, 1, 0, 0, 0, 0),
-  STATS(0, 2, 1, 0, 3, 0, 0, 0, 0),
-  STATS(1, 2, 2, 0, 4, 0, 0, 0, 0),
+  STATS(0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0),
+  STATS(0, 2, 1, 0, 0, 0, 3, 0, 0, 0, 0),
+  STATS(1, 2, 2, 0, 1, 0, 4, 0, 0, 0, 0),
 
-  STATS(2, 2, 2, 0, 4, 0, 0, 0, 0),
+  STATS(2, 2, 2, 0, 1, 0, 4, 0, 0, 0, 0),
 
-  STATS(2, 2, 2, 0, 4, 0, 1, 1, 0),
-  STATS(2, 3, 2, 0, 5, 1, 1, 1, 0),
-  STATS(2, 3, 2, 0, 5, 1, 2, 2, 1),
+  STATS(2, 2, 2, 0, 1, 0, 4, 0, 1, 1, 0),
+  STATS(2, 3, 2, 0, 1, 0, 5, 1, 1, 1, 0),
+  STATS(2, 3, 2, 0, 1, 0, 5, 1, 2, 2, 1),
 
-  STATS(2, 4, 2, 0, 6, 1, 2, 2, 1),
-  STATS(2, 4, 3, 1, 7, 1, 2, 2, 1),
-  STATS(2, 5, 3, 1, 8, 1, 2, 2, 1),
-  STATS(2, 6, 4, 1, 10, 1, 2, 2, 1),
-  STATS(3, 6, 4, 1, 10, 1, 2, 2, 1),
+  STATS(2, 4, 2, 0, 1, 0, 6, 1, 2, 2, 1),
+  STATS(2, 4, 3, 1, 1, 0, 7, 1, 2, 2, 1),
+  STATS(2, 5, 3, 1, 1, 0, 8, 1, 2, 2, 1),
+  STATS(2, 6, 4, 1, 1, 0, 10, 1, 2, 2, 1),
+  STATS(3, 6, 4, 1, 2, 0, 10, 1, 2, 2, 1),
 
-  STATS(3, 6, 5, 2, 11, 1, 2, 2, 1),
-  STATS(4, 6, 5, 2, 11, 1, 2, 2, 1),
+  STATS(3, 6, 5, 2, 2, 0, 11, 1, 2, 2, 1),
+  STATS(4, 6, 5, 2, 3, 0, 11, 1, 2, 2, 1),
 
-  STATS(4, 6, 6, 3, 12, 1, 2, 2, 1),
-  STATS(4, 7, 6, 3, 13, 1, 2, 2, 1),
+  STATS(4, 6, 6, 3, 3, 0, 12, 1, 2, 2, 1),
+  STATS(4, 7, 6, 3, 3, 0, 13, 1, 2, 2, 1),
 };
 
 static const int expected_block_access_counts [ACTION_COUNT] [BLOCK_COUNT] = {
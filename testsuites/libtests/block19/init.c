@@ -0,0 +1,302 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 19";
+
+#define BLOCK_COUNT 16
+
+#define REQUEST_COUNT 4
+
+#define DISK_PATH "/disk"
+
+static uint8_t disk_data [BLOCK_COUNT];
+
+static uint32_t request_buffer_counts [REQUEST_COUNT];
+
+static uint32_t request_lengths [REQUEST_COUNT];
+
+static size_t request_count;
+
+static rtems_blkdev_bnum modify_block = BLOCK_COUNT;
+
+static void modify_block_in_cache(rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(dd, modify_block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  bd->buffer [0] = 0xfe;
+  sc = rtems_bdbuf_release_modified(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  modify_block = BLOCK_COUNT;
+}
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    rtems_blkdev_sg_buffer *sg = breq->bufs;
+    uint32_t length = 0;
+    uint32_t i;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_READ);
+    rtems_test_assert(request_count < REQUEST_COUNT);
+
+    /* Modify a block of the range while the transfer is in progress */
+    if (modify_block < BLOCK_COUNT) {
+      modify_block_in_cache(dd);
+    }
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_test_assert(sg [i].block + sg [i].length <= BLOCK_COUNT);
+
+      memcpy(sg [i].buffer, &disk_data [sg [i].block], sg [i].length);
+      length += sg [i].length;
+    }
+
+    request_buffer_counts [request_count] = breq->bufnum;
+    request_lengths [request_count] = length;
+    ++request_count;
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static void check_data(
+  const uint8_t *buf,
+  rtems_blkdev_bnum block,
+  uint32_t block_count
+)
+{
+  uint32_t i;
+
+  for (i = 0; i < block_count; ++i) {
+    rtems_test_assert(buf [i] == disk_data [block + i]);
+  }
+}
+
+static void test_block_buffers(rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  uint8_t buf [BLOCK_COUNT];
+
+  puts("block buffers");
+
+  request_count = 0;
+  dd->capabilities = 0;
+
+  sc = rtems_bdbuf_read_blocks(dd, 2, 8, buf);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  check_data(buf, 2, 8);
+
+  rtems_test_assert(request_count == 1);
+  rtems_test_assert(request_buffer_counts [0] == 8);
+  rtems_test_assert(request_lengths [0] == 8);
+}
+
+static void test_multi_block_buffer(rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  uint8_t buf [BLOCK_COUNT];
+
+  puts("multi-block buffer");
+
+  request_count = 0;
+  dd->capabilities = RTEMS_BLKDEV_CAP_MULTIBLOCK_BUFFER;
+
+  sc = rtems_bdbuf_read_blocks(dd, 0, BLOCK_COUNT, buf);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  check_data(buf, 0, BLOCK_COUNT);
+
+  rtems_test_assert(request_count == 1);
+  rtems_test_assert(request_buffer_counts [0] == 1);
+  rtems_test_assert(request_lengths [0] == BLOCK_COUNT);
+}
+
+static void test_cached_block(rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+  uint8_t buf [BLOCK_COUNT];
+
+  puts("cached block");
+
+  request_count = 0;
+  dd->capabilities = RTEMS_BLKDEV_CAP_MULTIBLOCK_BUFFER;
+
+  /* The cache content differs from the disk content to detect the copy */
+  sc = rtems_bdbuf_read(dd, 5, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  bd->buffer [0] = 0xff;
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_read_blocks(dd, 0, 12, buf);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  check_data(&buf [0], 0, 5);
+  rtems_test_assert(buf [5] == 0xff);
+  check_data(&buf [6], 6, 6);
+
+  rtems_test_assert(request_count == 3);
+  rtems_test_assert(request_buffer_counts [0] == 1);
+  rtems_test_assert(request_lengths [0] == 1);
+  rtems_test_assert(request_buffer_counts [1] == 1);
+  rtems_test_assert(request_lengths [1] == 5);
+  rtems_test_assert(request_buffer_counts [2] == 1);
+  rtems_test_assert(request_lengths [2] == 6);
+}
+
+static void test_modified_during_transfer(rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  uint8_t buf [BLOCK_COUNT];
+
+  puts("block modified during transfer");
+
+  request_count = 0;
+  dd->capabilities = RTEMS_BLKDEV_CAP_MULTIBLOCK_BUFFER;
+  modify_block = 9;
+
+  sc = rtems_bdbuf_read_blocks(dd, 8, 4, buf);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  check_data(&buf [0], 8, 1);
+  rtems_test_assert(buf [1] == 0xfe);
+  check_data(&buf [2], 10, 2);
+
+  rtems_test_assert(request_count == 1);
+  rtems_test_assert(request_buffer_counts [0] == 1);
+  rtems_test_assert(request_lengths [0] == 4);
+
+  /* Discard the modified block, the disk does not support writes */
+  rtems_bdbuf_purge_dev(dd);
+}
+
+static void test_invalid_range(rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  uint8_t buf [BLOCK_COUNT];
+
+  puts("invalid range");
+
+  sc = rtems_bdbuf_read_blocks(dd, BLOCK_COUNT - 1, 2, buf);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_bdbuf_read_blocks(dd, BLOCK_COUNT, 0, buf);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  size_t i;
+  int fd;
+  int rv;
+
+  for (i = 0; i < BLOCK_COUNT; ++i) {
+    disk_data [i] = (uint8_t) i;
+  }
+
+  sc = rtems_blkdev_create(
+    DISK_PATH,
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(DISK_PATH, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  test_block_buffers(dd);
+  test_multi_block_buffer(dd);
+  test_cached_block(dd);
+  test_modified_during_transfer(dd);
+  test_invalid_range(dd);
+
+  rv = unlink(DISK_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BLOCK_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,335 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/bdbuf.h>
+#include <rtems/thread.h>
+
+const char rtems_test_name[] = "BLOCK 20";
+
+#define BLOCK_SIZE 512
+
+#define BLOCK_COUNT 16
+
+#define EVENT_WRITE_A RTEMS_EVENT_0
+
+#define EVENT_WRITE_B RTEMS_EVENT_1
+
+#define EVENT_SYNC_A_DONE RTEMS_EVENT_2
+
+#define WRITE_BACK_TIMEOUT 100
+
+typedef struct {
+  const char *path;
+  rtems_disk_device *dd;
+  rtems_id task;
+  rtems_event_set write_event;
+  bool block_writes;
+  rtems_binary_semaphore release;
+  uint32_t write_count;
+} test_disk;
+
+typedef struct {
+  rtems_id master;
+  test_disk a;
+  test_disk b;
+} test_context;
+
+static test_context test_instance;
+
+/*
+ * Each write request signals the master task.  The write requests of a disk
+ * with block_writes set are blocked until released by the master task, so
+ * that the swap out worker task stays in the transfer of this disk.
+ */
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    test_disk *disk = rtems_disk_get_driver_data(dd);
+    rtems_blkdev_request *breq = arg;
+    rtems_status_code sc;
+
+    if (breq->req == RTEMS_BLKDEV_REQ_WRITE) {
+      sc = rtems_event_send(disk->task, disk->write_event);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      if (disk->block_writes) {
+        rtems_binary_semaphore_wait(&disk->release);
+      }
+
+      ++disk->write_count;
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static void create_disk(
+  test_context *ctx,
+  test_disk *disk,
+  const char *path,
+  rtems_event_set write_event
+)
+{
+  rtems_status_code sc;
+  int fd;
+  int rv;
+
+  disk->path = path;
+  disk->task = ctx->master;
+  disk->write_event = write_event;
+  rtems_binary_semaphore_init(&disk->release, "Release");
+
+  sc = rtems_blkdev_create(
+    path,
+    BLOCK_SIZE,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    disk
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(path, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &disk->dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void delete_disk(test_disk *disk)
+{
+  int rv;
+
+  rv = unlink(disk->path);
+  rtems_test_assert(rv == 0);
+
+  rtems_binary_semaphore_destroy(&disk->release);
+}
+
+static void modify_block(test_disk *disk, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(disk->dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  memset(bd->buffer, (int) block, BLOCK_SIZE);
+
+  sc = rtems_bdbuf_release_modified(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void wait_for_events(rtems_event_set events, rtems_interval timeout)
+{
+  rtems_status_code sc;
+  rtems_event_set out;
+
+  sc = rtems_event_receive(
+    events,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    timeout,
+    &out
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(out == events);
+}
+
+static void assert_no_events(rtems_event_set events)
+{
+  rtems_status_code sc;
+  rtems_event_set out;
+
+  sc = rtems_event_receive(
+    events,
+    RTEMS_EVENT_ANY | RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &out
+  );
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+}
+
+static void sync_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  ctx = (test_context *) arg;
+
+  sc = rtems_bdbuf_syncdev(ctx->a.dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_send(ctx->master, EVENT_SYNC_A_DONE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_task_exit();
+}
+
+/*
+ * Start a sync of disk A and keep its write transfer in progress.
+ */
+static void start_sync_of_disk_a(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  ctx->a.block_writes = true;
+  modify_block(&ctx->a, 0);
+
+  sc = rtems_task_create(
+    rtems_build_name('S', 'Y', 'N', 'C'),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, sync_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  wait_for_events(EVENT_WRITE_A, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(ctx->a.write_count == 0);
+}
+
+static void finish_sync_of_disk_a(test_context *ctx)
+{
+  assert_no_events(EVENT_SYNC_A_DONE);
+  rtems_test_assert(ctx->a.write_count == 0);
+
+  ctx->a.block_writes = false;
+  rtems_binary_semaphore_post(&ctx->a.release);
+
+  wait_for_events(EVENT_SYNC_A_DONE, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(ctx->a.write_count == 1);
+}
+
+static void test_concurrent_sync(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  puts("concurrent sync of two disks");
+
+  modify_block(&ctx->b, 0);
+
+  sc = rtems_bdbuf_syncdev(ctx->b.dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->b.write_count == 1);
+  wait_for_events(EVENT_WRITE_B, RTEMS_NO_WAIT);
+}
+
+static void test_write_back_during_sync(test_context *ctx)
+{
+  puts("write-back while another disk syncs");
+
+  modify_block(&ctx->b, 1);
+
+  /* The swap out task writes the block once its hold time expired */
+  wait_for_events(EVENT_WRITE_B, WRITE_BACK_TIMEOUT);
+
+  while (ctx->b.write_count < 2) {
+    rtems_status_code sc;
+
+    sc = rtems_task_wake_after(1);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test(void)
+{
+  test_context *ctx;
+
+  ctx = &test_instance;
+  ctx->master = rtems_task_self();
+
+  create_disk(ctx, &ctx->a, "/dev/a", EVENT_WRITE_A);
+  create_disk(ctx, &ctx->b, "/dev/b", EVENT_WRITE_B);
+
+  start_sync_of_disk_a(ctx);
+  test_concurrent_sync(ctx);
+  test_write_back_during_sync(ctx);
+  finish_sync_of_disk_a(ctx);
+
+  delete_disk(&ctx->a);
+  delete_disk(&ctx->b);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (BLOCK_COUNT * BLOCK_SIZE)
+
+#define CONFIGURE_SWAPOUT_SWAP_PERIOD 10
+#define CONFIGURE_SWAPOUT_BLOCK_HOLD 10
+#define CONFIGURE_SWAPOUT_WORKER_TASKS 2
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,303 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/ioctl.h>
+#include <errno.h>
+#include <limits.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <tmacros.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/pipe.h>
+
+const char rtems_test_name[] = "PSXPIPE 2";
+
+#define TRANSFER_SIZE (1024UL * 1024UL)
+
+#define EVENT_DONE RTEMS_EVENT_0
+
+typedef struct {
+  int fd[2];
+  size_t chunk_size;
+  rtems_id init_task;
+  rtems_id writer_task;
+} test_context;
+
+static test_context test_instance;
+
+static unsigned char write_buf[16384 + 251];
+
+static unsigned char read_buf[16384];
+
+static void init_pattern(void)
+{
+  size_t i;
+
+  /* The size is not a multiple of the pattern length */
+  for (i = 0; i < sizeof(write_buf); ++i) {
+    write_buf[i] = (unsigned char) (i % 251);
+  }
+}
+
+static void writer_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_event_set events;
+    size_t offset = 0;
+    rtems_status_code sc;
+
+    sc = rtems_event_receive(
+      EVENT_DONE,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    while (offset < TRANSFER_SIZE) {
+      size_t todo = ctx->chunk_size;
+      ssize_t n;
+
+      n = write(ctx->fd[1], &write_buf[offset % 251], todo);
+      rtems_test_assert(n == (ssize_t) todo);
+      offset += todo;
+    }
+
+    sc = rtems_event_send(ctx->init_task, EVENT_DONE);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void check_data(size_t offset, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i) {
+    rtems_test_assert(read_buf[i] == (unsigned char) ((offset + i) % 251));
+  }
+}
+
+static void transfer(
+  test_context *ctx,
+  const char *name,
+  unsigned int buffer_size,
+  bool spsc,
+  size_t chunk_size
+)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks d;
+  rtems_event_set events;
+  rtems_status_code sc;
+  size_t offset;
+  uint64_t ns;
+  int rv;
+
+  rv = pipe(ctx->fd);
+  rtems_test_assert(rv == 0);
+
+  rv = ioctl(ctx->fd[0], PIPE_SET_BUFFER_SIZE, &buffer_size);
+  rtems_test_assert(rv == 0);
+
+  if (spsc) {
+    rv = ioctl(ctx->fd[0], PIPE_ENABLE_SPSC);
+    rtems_test_assert(rv == 0);
+  }
+
+  ctx->chunk_size = chunk_size;
+  offset = 0;
+  t0 = rtems_counter_read();
+
+  sc = rtems_event_send(ctx->writer_task, EVENT_DONE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  while (offset < TRANSFER_SIZE) {
+    ssize_t n;
+
+    n = read(ctx->fd[0], &read_buf[0], chunk_size);
+    rtems_test_assert(n > 0);
+    check_data(offset, (size_t) n);
+    offset += (size_t) n;
+  }
+
+  sc = rtems_event_receive(
+    EVENT_DONE,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+  ns = rtems_counter_ticks_to_nanoseconds(d);
+
+  printf(
+    "%s, buffer %u, chunk %zu: %" PRIu64 "ns, %" PRIu64 "KiB/s\n",
+    name,
+    buffer_size,
+    chunk_size,
+    ns,
+    ns > 0 ? ((uint64_t) TRANSFER_SIZE * 1000000000 / 1024) / ns : 0
+  );
+
+  rv = close(ctx->fd[0]);
+  rtems_test_assert(rv == 0);
+
+  rv = close(ctx->fd[1]);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_ioctl(void)
+{
+  unsigned int size;
+  unsigned char c;
+  ssize_t n;
+  int fd[2];
+  int rv;
+
+  rv = pipe(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = ioctl(fd[0], PIPE_GET_BUFFER_SIZE, &size);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(size == PIPE_BUF);
+
+  size = PIPE_BUFFER_SIZE_MAX + 1;
+  rv = ioctl(fd[0], PIPE_SET_BUFFER_SIZE, &size);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  size = 3000;
+  rv = ioctl(fd[0], PIPE_SET_BUFFER_SIZE, &size);
+  rtems_test_assert(rv == 0);
+
+  rv = ioctl(fd[0], PIPE_GET_BUFFER_SIZE, &size);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(size == 4096);
+
+  c = 'x';
+  n = write(fd[1], &c, 1);
+  rtems_test_assert(n == 1);
+
+  /* The pipe must be empty to change the buffer size */
+  size = 8192;
+  rv = ioctl(fd[0], PIPE_SET_BUFFER_SIZE, &size);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EBUSY);
+
+  /* Pending data is retained by the mode change */
+  rv = ioctl(fd[0], PIPE_ENABLE_SPSC);
+  rtems_test_assert(rv == 0);
+
+  rv = ioctl(fd[0], FIONREAD, &size);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(size == 1);
+
+  c = 0;
+  n = read(fd[0], &c, 1);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(c == 'x');
+
+  size = 8192;
+  rv = ioctl(fd[0], PIPE_SET_BUFFER_SIZE, &size);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EBUSY);
+
+  rv = close(fd[1]);
+  rtems_test_assert(rv == 0);
+
+  n = read(fd[0], &c, 1);
+  rtems_test_assert(n == 0);
+
+  rv = close(fd[0]);
+  rtems_test_assert(rv == 0);
+}
+
+static rtems_task Init(rtems_task_argument ignored)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+
+  TEST_BEGIN();
+
+  init_pattern();
+  test_ioctl();
+
+  ctx->init_task = rtems_task_self();
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'R', 'T', 'R'),
+    RTEMS_MAXIMUM_PRIORITY - 1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->writer_task
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->writer_task, writer_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  transfer(ctx, "mutex", PIPE_BUF, false, 256);
+  transfer(ctx, "spsc", PIPE_BUF, true, 256);
+  transfer(ctx, "mutex", 65536, false, 256);
+  transfer(ctx, "spsc", 65536, true, 256);
+  transfer(ctx, "mutex", 65536, false, 16384);
+  transfer(ctx, "spsc", 65536, true, 16384);
+
+  sc = rtems_task_delete(ctx->writer_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_IMFS_ENABLE_MKFIFO
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
@@ -0,0 +1,258 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/clockdrv.h>
+#include <rtems/score/percpu.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPCLOCKDYNTICK 1";
+
+#define CPU_COUNT 2
+
+#define SCHEDULER_A rtems_build_name(' ', ' ', ' ', 'A')
+
+#define SCHEDULER_B rtems_build_name(' ', ' ', ' ', 'B')
+
+#define IDLE_TICKS 100
+
+#define TIMER_TICKS 10
+
+typedef struct {
+  rtems_id init_task;
+  rtems_id timer;
+  rtems_interval fire_ticks;
+} test_context;
+
+static test_context test_instance;
+
+static void timer_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  ctx = (test_context *) arg;
+  rtems_test_assert(rtems_scheduler_get_processor() == 1);
+
+  /* The timer uses the watchdogs of processor 1 */
+  sc = rtems_timer_create(SCHEDULER_B, &ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_send(ctx->init_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Processor 1 is idle and has no scheduled watchdogs */
+  (void) rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(0);
+}
+
+static void timer_routine(rtems_id timer, void *arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  (void) timer;
+  ctx = arg;
+  ctx->fire_ticks = rtems_clock_get_ticks_since_boot();
+
+  sc = rtems_event_transient_send(ctx->init_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_skipped_ticks(void)
+{
+  const Per_CPU_Control *cpu_0;
+  const Per_CPU_Control *cpu_1;
+  rtems_status_code sc;
+  rtems_interval t0;
+  rtems_interval t1;
+  uint64_t ticks_0;
+  uint64_t ticks_1;
+  uint32_t isrs0;
+  uint32_t isrs1;
+
+  cpu_0 = _Per_CPU_Get_by_index(0);
+  cpu_1 = _Per_CPU_Get_by_index(1);
+
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  isrs0 = Clock_driver_ticks;
+  t0 = rtems_clock_get_ticks_since_boot();
+  ticks_0 = cpu_0->Watchdog.ticks;
+  ticks_1 = cpu_1->Watchdog.ticks;
+
+  sc = rtems_task_wake_after(IDLE_TICKS);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  isrs1 = Clock_driver_ticks;
+  t1 = rtems_clock_get_ticks_since_boot();
+  ticks_0 = cpu_0->Watchdog.ticks - ticks_0;
+  ticks_1 = cpu_1->Watchdog.ticks - ticks_1;
+
+  printf(
+    "idle %" PRIu32 " ticks: %" PRIu32 " clock interrupts\n",
+    t1 - t0,
+    isrs1 - isrs0
+  );
+
+  /* Only the boot processor received the clock tick interrupts */
+  rtems_test_assert(t1 - t0 >= IDLE_TICKS);
+  rtems_test_assert(isrs1 - isrs0 < (t1 - t0) + IDLE_TICKS / 2);
+
+  /* The boot processor advanced the ticks of the skipping processor */
+  rtems_test_assert(ticks_1 + 1 >= ticks_0);
+  rtems_test_assert(ticks_1 <= ticks_0 + 1);
+}
+
+static void test_remote_insert(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_interval t0;
+
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  t0 = rtems_clock_get_ticks_since_boot();
+
+  /*
+   * Processor 1 skips its clock ticks up to the maximum count.  The insert of
+   * the timer watchdog wakes it up.
+   */
+  sc = rtems_timer_fire_after(ctx->timer, TIMER_TICKS, timer_routine, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, 10 * TIMER_TICKS);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf(
+    "remote timer %" PRIu32 " ticks: %" PRIu32 " ticks elapsed\n",
+    (rtems_interval) TIMER_TICKS,
+    ctx->fire_ticks - t0
+  );
+
+  rtems_test_assert(ctx->fire_ticks - t0 + 1 >= TIMER_TICKS);
+  rtems_test_assert(ctx->fire_ticks - t0 <= TIMER_TICKS + 2);
+}
+
+static void test(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_id scheduler_b_id;
+  rtems_id task_id;
+
+  ctx->init_task = rtems_task_self();
+
+  sc = rtems_scheduler_ident(SCHEDULER_B, &scheduler_b_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_create(
+    SCHEDULER_B,
+    255,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &task_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_set_scheduler(task_id, scheduler_b_id, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(task_id, timer_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_skipped_ticks();
+  test_remote_insert(ctx);
+
+  sc = rtems_timer_delete(ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_delete(task_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  if (rtems_scheduler_get_processor_maximum() == CPU_COUNT) {
+    test(&test_instance);
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_CLOCK_DRIVER_DYNAMIC_TICK
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_SCHEDULER_SIMPLE_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_SIMPLE_SMP(a);
+RTEMS_SCHEDULER_SIMPLE_SMP(b);
+
+#define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+  RTEMS_SCHEDULER_TABLE_SIMPLE_SMP(a, SCHEDULER_A), \
+  RTEMS_SCHEDULER_TABLE_SIMPLE_SMP(b, SCHEDULER_B)
+
+#define CONFIGURE_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
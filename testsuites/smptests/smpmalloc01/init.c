@@ -0,0 +1,285 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/malloc.h>
+#include <rtems/test-info.h>
+#include <rtems.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPMALLOC 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 2
+
+#define WORKING_SET_COUNT 16
+
+typedef struct {
+  rtems_test_parallel_context base;
+  const char *test_sep;
+  const char *counter_sep;
+  unsigned long local_counter[CPU_COUNT][TEST_COUNT][CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static void test_fini(
+  test_context *ctx,
+  const char *size_type,
+  size_t test,
+  size_t active_workers
+)
+{
+  unsigned long sum = 0;
+  const char *value_sep;
+  size_t i;
+
+  if (active_workers == 1) {
+    printf(
+      "%s{\n"
+      "    \"size-type\": \"%s\",\n"
+      "    \"results\": [",
+      ctx->test_sep,
+      size_type
+    );
+    ctx->test_sep = ", ";
+    ctx->counter_sep = "\n      ";
+  }
+
+  printf(
+    "%s{\n"
+    "        \"counter\": [", ctx->counter_sep);
+  ctx->counter_sep = "\n      }, ";
+  value_sep = "";
+
+  for (i = 0; i < active_workers; ++i) {
+    unsigned long local_counter =
+      ctx->local_counter[active_workers - 1][test][i];
+
+    sum += local_counter;
+
+    printf(
+      "%s%lu",
+      value_sep,
+      local_counter
+    );
+    value_sep = ", ";
+  }
+
+  printf(
+    "],\n"
+    "        \"sum-of-local-counter\": %lu",
+    sum
+  );
+
+  if (active_workers == rtems_scheduler_get_processor_maximum()) {
+    printf("\n      }\n    ]\n  }");
+  }
+}
+
+/*
+ * Each worker cycles through a working set of blocks.  The content of each
+ * block is checked before it is freed to detect blocks handed out twice.
+ */
+static void test_body(
+  test_context *ctx,
+  size_t test,
+  size_t min_size,
+  size_t size_range,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  unsigned char *working_set[WORKING_SET_COUNT];
+  size_t sizes[WORKING_SET_COUNT];
+  unsigned long counter = 0;
+  unsigned char pattern = (unsigned char) worker_index;
+  size_t i;
+
+  memset(working_set, 0, sizeof(working_set));
+  memset(sizes, 0, sizeof(sizes));
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    size_t slot = counter % WORKING_SET_COUNT;
+    unsigned char *p = working_set[slot];
+    size_t size;
+
+    if (p != NULL) {
+      for (i = 0; i < sizes[slot]; ++i) {
+        rtems_test_assert(p[i] == pattern);
+      }
+
+      free(p);
+    }
+
+    size = min_size + (counter * 7) % size_range;
+    p = malloc(size);
+    rtems_test_assert(p != NULL);
+    memset(p, pattern, size);
+    working_set[slot] = p;
+    sizes[slot] = size;
+    ++counter;
+  }
+
+  for (i = 0; i < WORKING_SET_COUNT; ++i) {
+    free(working_set[i]);
+  }
+
+  ctx->local_counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_0_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_body(
+    (test_context *) base,
+    0,
+    1,
+    MALLOC_PER_CPU_CACHE_CLASS_COUNT * MALLOC_PER_CPU_CACHE_CLASS_SIZE,
+    active_workers,
+    worker_index
+  );
+}
+
+static void test_0_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_fini((test_context *) base, "cached", 0, active_workers);
+}
+
+static void test_1_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_body(
+    (test_context *) base,
+    1,
+    2 * MALLOC_PER_CPU_CACHE_CLASS_COUNT * MALLOC_PER_CPU_CACHE_CLASS_SIZE,
+    MALLOC_PER_CPU_CACHE_CLASS_COUNT * MALLOC_PER_CPU_CACHE_CLASS_SIZE,
+    active_workers,
+    worker_index
+  );
+}
+
+static void test_1_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_fini((test_context *) base, "uncached", 1, active_workers);
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_0_body,
+    .fini = test_0_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = test_1_body,
+    .fini = test_1_fini,
+    .cascade = true
+  }
+};
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+
+  printf("*** BEGIN OF JSON DATA ***\n[\n  ");
+  ctx->test_sep = "";
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("\n]\n*** END OF JSON DATA ***\n");
+
+  rtems_test_assert(malloc_walk(0, false));
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_MALLOC_PER_CPU_CACHE 32
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
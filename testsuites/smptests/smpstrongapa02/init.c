@@ -0,0 +1,257 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "SMPSTRONGAPA 2";
+
+#define CPU_MAX 32
+
+#define READY_COUNT_MAX 192
+
+#define SAMPLE_COUNT 1000
+
+#define PRIO_PING 1
+
+#define PRIO_MASTER 2
+
+
+typedef struct {
+  rtems_id ping_id;
+  rtems_id ready_ids[READY_COUNT_MAX];
+  uint32_t ping_count;
+} test_context;
+
+static test_context test_instance;
+
+static const size_t ready_counts[] = { 0, 8, 64, READY_COUNT_MAX };
+
+static void set_affinity(rtems_id id, uint32_t cpu_index)
+{
+  rtems_status_code sc;
+  cpu_set_t cpu_set;
+
+  CPU_ZERO(&cpu_set);
+  CPU_SET((int) cpu_index, &cpu_set);
+
+  sc = rtems_task_set_affinity(id, sizeof(cpu_set), &cpu_set);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void ping_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ++ctx->ping_count;
+  }
+}
+
+static void ready_task(rtems_task_argument arg)
+{
+  (void) arg;
+
+  while (true) {
+    /* Do nothing */
+  }
+}
+
+/*
+ * The ready tasks have the priority of the master task and are distributed
+ * over the other processors, so that they compete with the master task for
+ * the Ready chain of its priority.  Only one ready task can execute on each
+ * of the other processors, the rest stays ready.  On a uniprocessor system,
+ * they are restricted to the processor of the master task with a lower
+ * priority, so that they do not starve the master task.
+ */
+static void create_ready_tasks(test_context *ctx, size_t n, uint32_t cpu_count)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i) {
+    rtems_status_code sc;
+    rtems_task_priority prio;
+    uint32_t cpu_index;
+
+    if (cpu_count > 1) {
+      prio = PRIO_MASTER;
+      cpu_index = 1 + (uint32_t) (i % (cpu_count - 1));
+    } else {
+      prio = PRIO_MASTER + 1;
+      cpu_index = 0;
+    }
+
+    sc = rtems_task_create(
+      rtems_build_name('R', 'E', 'D', 'Y'),
+      prio,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->ready_ids[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    /* Restrict the affinity of each task to a single processor */
+    set_affinity(ctx->ready_ids[i], cpu_index);
+
+    sc = rtems_task_start(ctx->ready_ids[i], ready_task, 0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void delete_ready_tasks(test_context *ctx, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i) {
+    rtems_status_code sc;
+
+    sc = rtems_task_delete(ctx->ready_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+/*
+ * Each event send unblocks the ping task which preempts the master task on
+ * the same processor.  The ping task blocks immediately afterwards, so that
+ * the highest ready node must be searched while the ready tasks are present.
+ * The preempted master task is appended to the Ready chain of its priority
+ * behind the ready tasks.
+ */
+static void measure(test_context *ctx, size_t n, uint32_t cpu_count)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks d;
+  size_t i;
+
+  create_ready_tasks(ctx, n, cpu_count);
+  ctx->ping_count = 0;
+
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_send(ctx->ping_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+
+  rtems_test_assert(ctx->ping_count == SAMPLE_COUNT);
+
+  printf(
+    "ready tasks %zu: %" PRIu64 "ns per unblock and block\n",
+    n,
+    rtems_counter_ticks_to_nanoseconds(d) / SAMPLE_COUNT
+  );
+
+  delete_ready_tasks(ctx, n);
+}
+
+static void test(void)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  rtems_task_priority prio;
+  uint32_t cpu_count;
+  size_t i;
+
+  ctx = &test_instance;
+  cpu_count = rtems_scheduler_get_processor_maximum();
+
+  sc = rtems_task_set_priority(RTEMS_SELF, PRIO_MASTER, &prio);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  set_affinity(RTEMS_SELF, 0);
+
+  sc = rtems_task_create(
+    rtems_build_name('P', 'I', 'N', 'G'),
+    PRIO_PING,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->ping_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  set_affinity(ctx->ping_id, 0);
+
+  sc = rtems_task_start(ctx->ping_id, ping_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(ready_counts); ++i) {
+    measure(ctx, ready_counts[i], cpu_count);
+  }
+
+  sc = rtems_task_delete(ctx->ping_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (2 + READY_COUNT_MAX)
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_MAX
+
+#define CONFIGURE_SCHEDULER_STRONG_APA
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,390 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "SMPWORKSTEALING 1";
+
+#define CPU_MAX 4
+
+#define WORKERS_PER_CPU 4
+
+#define WORKER_MAX (WORKERS_PER_CPU * (CPU_MAX - 1))
+
+#define TOKENS_PER_CPU 2
+
+#define WORK_NS 2000
+
+#define SAMPLE_COUNT 1000
+
+#define PRIO_INIT 1
+
+#define PRIO_PING 2
+
+#define PRIO_WORKER 10
+
+#define SCHED_INIT rtems_build_name('I', 'N', 'I', 'T')
+
+#define SCHED_PRIO rtems_build_name('P', 'R', 'I', 'O')
+
+#define SCHED_WS rtems_build_name('W', 'S', ' ', ' ')
+
+typedef struct {
+  rtems_id id;
+  rtems_id sema_id;
+  rtems_id next_sema_id;
+  uint32_t jobs;
+} worker_context;
+
+typedef struct {
+  rtems_id init_id;
+  rtems_id ping_id;
+  rtems_counter_ticks ping_start;
+  rtems_counter_ticks latency_sum;
+  rtems_counter_ticks latency_max;
+  size_t worker_count;
+  worker_context workers[WORKER_MAX];
+} test_context;
+
+static test_context test_instance;
+
+static void ping_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+    rtems_counter_ticks d;
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    d = rtems_counter_difference(rtems_counter_read(), ctx->ping_start);
+    ctx->latency_sum += d;
+
+    if (d > ctx->latency_max) {
+      ctx->latency_max = d;
+    }
+
+    sc = rtems_event_transient_send(ctx->init_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+/*
+ * The workers pass tokens around a ring.  Each token received represents a
+ * short job.  The semaphores count the tokens, so that no token is lost if a
+ * worker receives a token while it is busy.
+ */
+static void worker_task(rtems_task_argument arg)
+{
+  worker_context *worker;
+
+  worker = (worker_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_semaphore_obtain(
+      worker->sema_id,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    rtems_counter_delay_nanoseconds(WORK_NS);
+    ++worker->jobs;
+
+    sc = rtems_semaphore_release(worker->next_sema_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void create_task(
+  rtems_id *id,
+  rtems_task_priority prio,
+  rtems_id scheduler_id
+)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_create(
+    rtems_build_name('T', 'A', 'S', 'K'),
+    prio,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_set_scheduler(*id, scheduler_id, prio);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void create_tasks(test_context *ctx, rtems_id scheduler_id)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  create_task(&ctx->ping_id, PRIO_PING, scheduler_id);
+
+  sc = rtems_task_start(ctx->ping_id, ping_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < ctx->worker_count; ++i) {
+    worker_context *worker;
+
+    worker = &ctx->workers[i];
+    worker->jobs = 0;
+
+    sc = rtems_semaphore_create(
+      rtems_build_name('S', 'E', 'M', 'A'),
+      0,
+      RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY,
+      0,
+      &worker->sema_id
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    create_task(&worker->id, PRIO_WORKER, scheduler_id);
+  }
+
+  for (i = 0; i < ctx->worker_count; ++i) {
+    worker_context *worker;
+
+    worker = &ctx->workers[i];
+    worker->next_sema_id =
+      ctx->workers[(i + 1) % ctx->worker_count].sema_id;
+
+    sc = rtems_task_start(worker->id, worker_task, (rtems_task_argument) worker);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void delete_tasks(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  sc = rtems_task_delete(ctx->ping_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < ctx->worker_count; ++i) {
+    worker_context *worker;
+
+    worker = &ctx->workers[i];
+
+    sc = rtems_task_delete(worker->id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_semaphore_delete(worker->sema_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void start_tokens(test_context *ctx, size_t token_count)
+{
+  size_t i;
+
+  for (i = 0; i < token_count; ++i) {
+    rtems_status_code sc;
+    size_t w;
+
+    w = (i * ctx->worker_count) / token_count;
+    sc = rtems_semaphore_release(ctx->workers[w].sema_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+/*
+ * The throughput is the count of jobs carried out by the workers.  The
+ * latency is the time from an event send by the task on processor zero to the
+ * start of the high priority ping task which executes in the same scheduler
+ * instance as the workers.
+ */
+static void measure(
+  test_context *ctx,
+  const char *name,
+  rtems_name scheduler_name,
+  uint32_t cpu_count
+)
+{
+  rtems_id scheduler_id;
+  rtems_status_code sc;
+  rtems_counter_ticks t0;
+  rtems_counter_ticks d;
+  uint64_t jobs;
+  uint64_t ns;
+  size_t i;
+
+  sc = rtems_scheduler_ident(scheduler_name, &scheduler_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->worker_count = WORKERS_PER_CPU * (cpu_count - 1);
+  ctx->latency_sum = 0;
+  ctx->latency_max = 0;
+  create_tasks(ctx, scheduler_id);
+  start_tokens(ctx, TOKENS_PER_CPU * (cpu_count - 1));
+
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    ctx->ping_start = rtems_counter_read();
+
+    sc = rtems_event_transient_send(ctx->ping_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+  jobs = 0;
+
+  for (i = 0; i < ctx->worker_count; ++i) {
+    jobs += ctx->workers[i].jobs;
+  }
+
+  delete_tasks(ctx);
+
+  ns = rtems_counter_ticks_to_nanoseconds(d);
+  rtems_test_assert(ns > 0);
+
+  printf(
+    "%s: %" PRIu64 " jobs per second, latency average %" PRIu64
+      "ns maximum %" PRIu64 "ns\n",
+    name,
+    (jobs * 1000000000) / ns,
+    rtems_counter_ticks_to_nanoseconds(ctx->latency_sum) / SAMPLE_COUNT,
+    rtems_counter_ticks_to_nanoseconds(ctx->latency_max)
+  );
+}
+
+static void move_processors(uint32_t cpu_count)
+{
+  rtems_status_code sc;
+  rtems_id prio_id;
+  rtems_id ws_id;
+  uint32_t cpu_index;
+
+  sc = rtems_scheduler_ident(SCHED_PRIO, &prio_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_scheduler_ident(SCHED_WS, &ws_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (cpu_index = 1; cpu_index < cpu_count; ++cpu_index) {
+    sc = rtems_scheduler_remove_processor(prio_id, cpu_index);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_scheduler_add_processor(ws_id, cpu_index);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test(void)
+{
+  test_context *ctx;
+  uint32_t cpu_count;
+
+  ctx = &test_instance;
+  ctx->init_id = rtems_task_self();
+  cpu_count = rtems_scheduler_get_processor_maximum();
+
+  if (cpu_count < 2) {
+    return;
+  }
+
+  measure(ctx, "priority SMP", SCHED_PRIO, cpu_count);
+  move_processors(cpu_count);
+  measure(ctx, "work stealing SMP", SCHED_WS, cpu_count);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (2 + WORKER_MAX)
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES WORKER_MAX
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_MAX
+
+#define CONFIGURE_SCHEDULER_PRIORITY_SMP
+
+#define CONFIGURE_SCHEDULER_WORK_STEALING_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_PRIORITY_SMP(init, 256);
+
+RTEMS_SCHEDULER_PRIORITY_SMP(prio, 256);
+
+RTEMS_SCHEDULER_WORK_STEALING_SMP(ws, 2, 8);
+
+#define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+  RTEMS_SCHEDULER_TABLE_PRIORITY_SMP(init, SCHED_INIT), \
+  RTEMS_SCHEDULER_TABLE_PRIORITY_SMP(prio, SCHED_PRIO), \
+  RTEMS_SCHEDULER_TABLE_WORK_STEALING_SMP(ws, SCHED_WS)
+
+#define CONFIGURE_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_INIT_TASK_PRIORITY PRIO_INIT
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
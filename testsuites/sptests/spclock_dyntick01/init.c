@@ -0,0 +1,224 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/clockdrv.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPCLOCK DYNAMIC TICK 1";
+
+#define NS_PER_TICK (1000 * CONFIGURE_MICROSECONDS_PER_TICK)
+
+#define TIMER_TICKS 33
+
+static rtems_id init_task;
+
+static int64_t timespec_to_ns(const struct timespec *ts)
+{
+  return (int64_t) ts->tv_sec * 1000000000 + ts->tv_nsec;
+}
+
+static int64_t uptime_ns(void)
+{
+  struct timespec ts;
+  rtems_status_code sc;
+
+  sc = rtems_clock_get_uptime(&ts);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return timespec_to_ns(&ts);
+}
+
+static void check_elapsed_ticks(
+  const char *what,
+  rtems_interval ticks,
+  rtems_interval t0,
+  int64_t u0,
+  uint32_t isrs0
+)
+{
+  rtems_interval t1;
+  int64_t u1;
+  uint32_t isrs1;
+
+  isrs1 = Clock_driver_ticks;
+  t1 = rtems_clock_get_ticks_since_boot();
+  u1 = uptime_ns();
+
+  printf(
+    "%s %" PRIu32 " ticks: %" PRIu32 " ticks elapsed, "
+      "%" PRIu32 " clock interrupts\n",
+    what,
+    ticks,
+    t1 - t0,
+    isrs1 - isrs0
+  );
+
+  /* The clock tick count is reconstructed from the timecounter */
+  rtems_test_assert(t1 - t0 >= ticks);
+  rtems_test_assert(u1 - u0 >= (int64_t) (ticks - 1) * NS_PER_TICK);
+  rtems_test_assert(t1 - t0 <= (u1 - u0) / NS_PER_TICK + 1);
+
+  /* The clock tick interrupts are skipped while the processor is idle */
+  rtems_test_assert(isrs1 - isrs0 < ticks);
+}
+
+static void test_wake_after(rtems_interval ticks)
+{
+  rtems_status_code sc;
+  rtems_interval t0;
+  int64_t u0;
+  uint32_t isrs0;
+
+  /* Synchronize with the clock tick */
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  u0 = uptime_ns();
+  isrs0 = Clock_driver_ticks;
+  t0 = rtems_clock_get_ticks_since_boot();
+
+  sc = rtems_task_wake_after(ticks);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  check_elapsed_ticks("wake after", ticks, t0, u0, isrs0);
+}
+
+static void timer_routine(rtems_id timer, void *arg)
+{
+  rtems_status_code sc;
+
+  (void) timer;
+  (void) arg;
+
+  sc = rtems_event_transient_send(init_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_timer(void)
+{
+  rtems_status_code sc;
+  rtems_id timer;
+  rtems_interval t0;
+  int64_t u0;
+  uint32_t isrs0;
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'R'), &timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  u0 = uptime_ns();
+  isrs0 = Clock_driver_ticks;
+  t0 = rtems_clock_get_ticks_since_boot();
+
+  sc = rtems_timer_fire_after(timer, TIMER_TICKS, timer_routine, NULL);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  check_elapsed_ticks("timer", TIMER_TICKS, t0, u0, isrs0);
+
+  sc = rtems_timer_delete(timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_clock_nanosleep(clockid_t clock_id, long ns)
+{
+  struct timespec deadline;
+  struct timespec now;
+  int eno;
+  int rv;
+
+  rv = clock_gettime(clock_id, &deadline);
+  rtems_test_assert(rv == 0);
+
+  deadline.tv_nsec += ns;
+
+  while (deadline.tv_nsec >= 1000000000) {
+    deadline.tv_nsec -= 1000000000;
+    ++deadline.tv_sec;
+  }
+
+  eno = clock_nanosleep(clock_id, TIMER_ABSTIME, &deadline, NULL);
+  rtems_test_assert(eno == 0);
+
+  rv = clock_gettime(clock_id, &now);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(timespec_to_ns(&now) >= timespec_to_ns(&deadline));
+}
+
+static void Init(rtems_task_argument arg)
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  init_task = rtems_task_self();
+
+  test_wake_after(10);
+  test_wake_after(100);
+  test_wake_after(1000);
+  test_timer();
+  test_clock_nanosleep(CLOCK_MONOTONIC, 55000000);
+  test_clock_nanosleep(CLOCK_REALTIME, 77000000);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_CLOCK_DRIVER_DYNAMIC_TICK
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_MAXIMUM_PROCESSORS 1
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,408 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <rtems.h>
+#include <rtems/score/heapimpl.h>
+
+const char rtems_test_name[] = "SPHEAPINDEX 1";
+
+#define AREA_SIZE (16 * 1024)
+
+#define EXTEND_SIZE (8 * 1024)
+
+#define MAX_BLOCKS 64
+
+typedef struct {
+  Heap_Control heap;
+  Heap_Free_index index;
+  Heap_Free_index other_index;
+  void *blocks[MAX_BLOCKS];
+  uint32_t random;
+  char area[AREA_SIZE] RTEMS_ALIGNED(CPU_HEAP_ALIGNMENT);
+  char extend_area[EXTEND_SIZE] RTEMS_ALIGNED(CPU_HEAP_ALIGNMENT);
+} test_context;
+
+static test_context test_instance;
+
+static uint32_t next_random(test_context *ctx)
+{
+  ctx->random = ctx->random * UINT32_C(1664525) + UINT32_C(1013904223);
+  return ctx->random >> 16;
+}
+
+static uintptr_t random_size(test_context *ctx)
+{
+  return 1 + next_random(ctx) % 600;
+}
+
+/*
+ * For a heap using an index, _Heap_Walk() checks the order of the free list
+ * and the index.  In addition, check the order of the free list independently
+ * with the block sizes.
+ */
+static void check_heap(test_context *ctx)
+{
+  Heap_Control *heap = &ctx->heap;
+  Heap_Block *tail = _Heap_Free_list_tail(heap);
+  Heap_Block *block = _Heap_Free_list_first(heap);
+  uint32_t prev_fl = 0;
+  uint32_t prev_sl = 0;
+  uint32_t free_blocks = 0;
+
+  rtems_test_assert(_Heap_Walk(heap, 0, false));
+  rtems_test_assert(heap->free_index == &ctx->index);
+
+  while (block != tail) {
+    uint32_t fl;
+    uint32_t sl;
+
+    _Heap_Free_index_mapping(_Heap_Block_size(block), &fl, &sl);
+    rtems_test_assert(fl > prev_fl || (fl == prev_fl && sl >= prev_sl));
+
+    prev_fl = fl;
+    prev_sl = sl;
+    ++free_blocks;
+    block = block->next;
+  }
+
+  rtems_test_assert(free_blocks == heap->stats.free_blocks);
+}
+
+static void allocate_block(test_context *ctx, size_t i, uintptr_t size)
+{
+  rtems_test_assert(ctx->blocks[i] == NULL);
+
+  ctx->blocks[i] = _Heap_Allocate(&ctx->heap, size);
+}
+
+static void free_block(test_context *ctx, size_t i)
+{
+  bool ok;
+
+  ok = _Heap_Free(&ctx->heap, ctx->blocks[i]);
+  rtems_test_assert(ok);
+  _Heap_Protection_free_all_delayed_blocks(&ctx->heap);
+  ctx->blocks[i] = NULL;
+}
+
+static void free_all_blocks(test_context *ctx)
+{
+  size_t i;
+
+  for (i = 0; i < MAX_BLOCKS; ++i) {
+    if (ctx->blocks[i] != NULL) {
+      free_block(ctx, i);
+      check_heap(ctx);
+    }
+  }
+}
+
+static void init_heap(test_context *ctx)
+{
+  uintptr_t size;
+
+  size = _Heap_Initialize(&ctx->heap, ctx->area, sizeof(ctx->area), 0);
+  rtems_test_assert(size > 0);
+  rtems_test_assert(ctx->heap.free_index == NULL);
+}
+
+static void test_enable(test_context *ctx)
+{
+  size_t i;
+
+  puts("enable the index of a fragmented heap");
+
+  init_heap(ctx);
+
+  for (i = 0; i < MAX_BLOCKS; ++i) {
+    allocate_block(ctx, i, 1 + next_random(ctx) % 200);
+    rtems_test_assert(ctx->blocks[i] != NULL);
+  }
+
+  /* The free list is in address order before the index is enabled */
+  for (i = 0; i < MAX_BLOCKS; i += 2) {
+    free_block(ctx, i);
+  }
+
+  rtems_test_assert(_Heap_Walk(&ctx->heap, 0, false));
+  rtems_test_assert(ctx->heap.stats.free_blocks > 2);
+
+  _Heap_Free_index_enable(&ctx->heap, &ctx->index);
+  check_heap(ctx);
+
+  /* A second enable does nothing */
+  _Heap_Free_index_enable(&ctx->heap, &ctx->other_index);
+  check_heap(ctx);
+}
+
+static void test_walk_detects_index_corruption(test_context *ctx)
+{
+  Heap_Block *block;
+  uint32_t fl;
+  uint32_t sl;
+
+  puts("detect a corrupt index");
+
+  block = _Heap_Free_list_first(&ctx->heap);
+  _Heap_Free_index_mapping(_Heap_Block_size(block), &fl, &sl);
+  rtems_test_assert(ctx->index.first[fl][sl] == block);
+
+  ctx->index.first[fl][sl] = block->next;
+  rtems_test_assert(!_Heap_Walk(&ctx->heap, 0, false));
+
+  ctx->index.first[fl][sl] = block;
+  check_heap(ctx);
+}
+
+static void test_allocate_free(test_context *ctx)
+{
+  size_t n;
+
+  puts("allocate and free blocks");
+
+  for (n = 0; n < 8 * MAX_BLOCKS; ++n) {
+    size_t i = next_random(ctx) % MAX_BLOCKS;
+
+    if (ctx->blocks[i] == NULL) {
+      allocate_block(ctx, i, random_size(ctx));
+    } else {
+      free_block(ctx, i);
+    }
+
+    check_heap(ctx);
+  }
+
+  free_all_blocks(ctx);
+  rtems_test_assert(ctx->heap.stats.free_blocks == 1);
+}
+
+static void test_allocate_aligned(test_context *ctx)
+{
+  size_t i;
+
+  puts("allocate blocks with alignment and boundary constraints");
+
+  for (i = 0; i < MAX_BLOCKS; i += 2) {
+    allocate_block(ctx, i, random_size(ctx));
+  }
+
+  for (i = 0; i < MAX_BLOCKS; i += 4) {
+    free_block(ctx, i);
+  }
+
+  check_heap(ctx);
+
+  for (i = 1; i < MAX_BLOCKS; i += 2) {
+    uintptr_t alignment = (uintptr_t) 8 << (i % 6);
+    uintptr_t size = 1 + next_random(ctx) % 200;
+    uintptr_t p;
+
+    p = (uintptr_t) _Heap_Allocate_aligned_with_boundary(
+      &ctx->heap,
+      size,
+      alignment,
+      512
+    );
+    rtems_test_assert(p != 0);
+    rtems_test_assert(p % alignment == 0);
+    rtems_test_assert(p / 512 == (p + size - 1) / 512);
+    ctx->blocks[i] = (void *) p;
+
+    check_heap(ctx);
+  }
+
+  free_all_blocks(ctx);
+  rtems_test_assert(ctx->heap.stats.free_blocks == 1);
+}
+
+static void test_extend(test_context *ctx)
+{
+  uintptr_t size;
+  uintptr_t p;
+  size_t i;
+
+  puts("extend the heap");
+
+  /* Fill the area with blocks and free every second block */
+  for (i = 0; i < MAX_BLOCKS; ++i) {
+    allocate_block(ctx, i, 256);
+  }
+
+  rtems_test_assert(ctx->blocks[MAX_BLOCKS - 1] == NULL);
+
+  for (i = 1; i < MAX_BLOCKS; i += 2) {
+    if (ctx->blocks[i] != NULL) {
+      free_block(ctx, i);
+    }
+  }
+
+  check_heap(ctx);
+
+  size = _Heap_Extend(
+    &ctx->heap,
+    ctx->extend_area,
+    sizeof(ctx->extend_area),
+    0
+  );
+  rtems_test_assert(size > 0);
+  check_heap(ctx);
+
+  /* The free blocks of the area are too small, so use the extension */
+  p = (uintptr_t) _Heap_Allocate(&ctx->heap, EXTEND_SIZE / 2);
+  rtems_test_assert(p != 0);
+  rtems_test_assert(p + EXTEND_SIZE / 2 > (uintptr_t) &ctx->extend_area[0]);
+  rtems_test_assert(
+    p + EXTEND_SIZE / 2 <= (uintptr_t) &ctx->extend_area[EXTEND_SIZE]
+  );
+  check_heap(ctx);
+
+  free_block(ctx, 0);
+  ctx->blocks[0] = (void *) p;
+  check_heap(ctx);
+
+  free_all_blocks(ctx);
+}
+
+static void resize_block(
+  test_context *ctx,
+  size_t i,
+  uintptr_t size,
+  Heap_Resize_status expected_status
+)
+{
+  Heap_Resize_status status;
+  uintptr_t old_size;
+  uintptr_t new_size;
+
+  status = _Heap_Resize_block(
+    &ctx->heap,
+    ctx->blocks[i],
+    size,
+    &old_size,
+    &new_size
+  );
+  rtems_test_assert(status == expected_status);
+
+  if (status == HEAP_RESIZE_SUCCESSFUL) {
+    rtems_test_assert(new_size >= size);
+  }
+
+  check_heap(ctx);
+}
+
+static void test_resize(test_context *ctx)
+{
+  uintptr_t size;
+  size_t i;
+
+  puts("resize blocks");
+
+  /* Start with one free block, so that the blocks are adjacent */
+  init_heap(ctx);
+  _Heap_Free_index_enable(&ctx->heap, &ctx->index);
+  check_heap(ctx);
+
+  for (i = 0; i < 4; ++i) {
+    allocate_block(ctx, i, 256);
+    rtems_test_assert(ctx->blocks[i] != NULL);
+  }
+
+  rtems_test_assert(ctx->blocks[0] < ctx->blocks[1]);
+  rtems_test_assert(ctx->blocks[1] < ctx->blocks[2]);
+  rtems_test_assert(ctx->blocks[2] < ctx->blocks[3]);
+
+  /* Grow the first block into a part of the free second block */
+  free_block(ctx, 1);
+  check_heap(ctx);
+  rtems_test_assert(ctx->heap.stats.free_blocks == 2);
+
+  resize_block(ctx, 0, 384, HEAP_RESIZE_SUCCESSFUL);
+  rtems_test_assert(ctx->heap.stats.free_blocks == 2);
+
+  /* Shrink the first block, the free tail joins the next free block */
+  resize_block(ctx, 0, 32, HEAP_RESIZE_SUCCESSFUL);
+  rtems_test_assert(ctx->heap.stats.free_blocks == 2);
+
+  /* Grow the first block over the complete free second block */
+  size = (uintptr_t) ctx->blocks[2] - (uintptr_t) ctx->blocks[0]
+    - HEAP_BLOCK_HEADER_SIZE + HEAP_ALLOC_BONUS;
+  resize_block(ctx, 0, size, HEAP_RESIZE_SUCCESSFUL);
+  rtems_test_assert(ctx->heap.stats.free_blocks == 1);
+
+  /* The third block cannot grow since the fourth block is used */
+  resize_block(ctx, 2, 1024, HEAP_RESIZE_UNSATISFIED);
+
+  /* Grow the last block into the free block at the end of the area */
+  resize_block(ctx, 3, 1024, HEAP_RESIZE_SUCCESSFUL);
+  rtems_test_assert(ctx->heap.stats.free_blocks == 1);
+
+  free_all_blocks(ctx);
+  rtems_test_assert(ctx->heap.stats.free_blocks == 1);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+
+  ctx->random = 1;
+
+  test_enable(ctx);
+  test_walk_detects_index_corruption(ctx);
+  test_allocate_free(ctx);
+  test_allocate_aligned(ctx);
+  test_extend(ctx);
+  test_resize(ctx);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
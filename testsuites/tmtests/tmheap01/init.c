@@ -0,0 +1,234 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/score/heapimpl.h>
+
+const char rtems_test_name[] = "TMHEAP 1";
+
+#define AREA_SIZE (64 * 1024)
+
+#define SMALL_SIZE 24
+
+#define LARGE_SIZE 512
+
+#define MAX_BLOCKS (AREA_SIZE / 32)
+
+typedef struct {
+  const char *name;
+  bool use_index;
+  Heap_Control heap;
+  Heap_Free_index index;
+  void *blocks[MAX_BLOCKS];
+  size_t block_count;
+  char area[AREA_SIZE] RTEMS_ALIGNED(CPU_HEAP_ALIGNMENT);
+} test_heap;
+
+static test_heap first_fit = {
+  .name = "first-fit",
+  .use_index = false
+};
+
+static test_heap segregated_fit = {
+  .name = "segregated-fit",
+  .use_index = true
+};
+
+static void init_heap(test_heap *th)
+{
+  uintptr_t size;
+
+  size = _Heap_Initialize(&th->heap, th->area, sizeof(th->area), 0);
+  rtems_test_assert(size > 0);
+
+  if (th->use_index) {
+    _Heap_Free_index_enable(&th->heap, &th->index);
+  }
+
+  th->block_count = 0;
+}
+
+/*
+ * Fill the heap with small blocks and free every second block.  This results
+ * in a free list with many small free blocks which is the worst case for the
+ * first fit search of a large block.
+ */
+static void fragment_heap(test_heap *th, size_t free_block_count)
+{
+  size_t i;
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(th->blocks); ++i) {
+    th->blocks[i] = _Heap_Allocate(&th->heap, SMALL_SIZE);
+
+    if (th->blocks[i] == NULL) {
+      break;
+    }
+  }
+
+  th->block_count = i;
+  rtems_test_assert(th->block_count >= 2 * free_block_count + 1);
+
+  /* Keep a large free block at the end of the heap */
+  for (i = th->block_count / 2; i < th->block_count; ++i) {
+    _Heap_Free(&th->heap, th->blocks[i]);
+    th->blocks[i] = NULL;
+  }
+
+  for (i = 0; i < free_block_count; ++i) {
+    _Heap_Free(&th->heap, th->blocks[2 * i]);
+    th->blocks[2 * i] = NULL;
+  }
+
+  rtems_test_assert(_Heap_Walk(&th->heap, 0, false));
+}
+
+static void release_heap(test_heap *th)
+{
+  size_t i;
+
+  for (i = 0; i < th->block_count; ++i) {
+    _Heap_Free(&th->heap, th->blocks[i]);
+  }
+
+  rtems_test_assert(_Heap_Walk(&th->heap, 0, false));
+  rtems_test_assert(th->heap.stats.free_blocks == 1);
+}
+
+static rtems_counter_ticks measure(test_heap *th, uintptr_t size)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_interrupt_level level;
+  void *p;
+
+  rtems_interrupt_local_disable(level);
+  a = rtems_counter_read();
+  p = _Heap_Allocate(&th->heap, size);
+  b = rtems_counter_read();
+  rtems_interrupt_local_enable(level);
+
+  rtems_test_assert(p != NULL);
+  _Heap_Free(&th->heap, p);
+
+  return rtems_counter_difference(b, a);
+}
+
+static void test_case(test_heap *th, size_t free_block_count)
+{
+  rtems_counter_ticks small;
+  rtems_counter_ticks large;
+  uint32_t max_search;
+
+  init_heap(th);
+  fragment_heap(th, free_block_count);
+
+  th->heap.stats.max_search = 0;
+  small = measure(th, SMALL_SIZE);
+  large = measure(th, LARGE_SIZE);
+  max_search = th->heap.stats.max_search;
+
+  release_heap(th);
+
+  printf(
+    ",\n      \"%s\": {\n"
+    "        \"small\": %" PRIu64 ",\n"
+    "        \"large\": %" PRIu64 ",\n"
+    "        \"max-search\": %" PRIu32 "\n"
+    "      }",
+    th->name,
+    rtems_counter_ticks_to_nanoseconds(small),
+    rtems_counter_ticks_to_nanoseconds(large),
+    max_search
+  );
+}
+
+static void test(void)
+{
+  const char *sep = "\n    ";
+  size_t free_block_count;
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"samples\": ["
+  );
+
+  free_block_count = 0;
+
+  while (free_block_count < MAX_BLOCKS / 8) {
+    printf(
+      "%s{\n"
+      "      \"free-blocks\": %zu",
+      sep,
+      free_block_count
+    );
+    sep = "\n    }, ";
+
+    test_case(&first_fit, free_block_count);
+    test_case(&segregated_fit, free_block_count);
+
+    free_block_count = (123 * (free_block_count + 1) + 99) / 100;
+  }
+
+  printf("\n    }\n  ]\n}\n*** END OF JSON DATA ***\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MALLOC_FREE_INDEX
+#define CONFIGURE_WORKSPACE_FREE_INDEX
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
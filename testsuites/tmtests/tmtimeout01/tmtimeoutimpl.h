@@ -0,0 +1,279 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#ifdef TEST_TIMER_WHEEL
+const char rtems_test_name[] = "TMTIMEOUT 2";
+#else
+const char rtems_test_name[] = "TMTIMEOUT 1";
+#endif
+
+#define MAXIMUM_TIMERS 4096
+
+#define ROUND_COUNT 1000
+
+#define CHURN_PER_ROUND 4
+
+#define TIMEOUT 100000
+
+typedef struct {
+  rtems_id peer;
+  rtems_id init_sema;
+  rtems_id peer_sema;
+  rtems_id timers[MAXIMUM_TIMERS];
+  size_t timer_count;
+  size_t active_timers;
+  uint32_t random;
+} test_context;
+
+static test_context test_instance;
+
+static void never(rtems_id id, void *arg)
+{
+  rtems_test_assert(0);
+}
+
+static uint32_t next_random(test_context *ctx)
+{
+  ctx->random = ctx->random * 1664525 + 1013904223;
+
+  return ctx->random >> 8;
+}
+
+static rtems_interval interval(test_context *ctx)
+{
+  /* Use intervals which cover all levels of the timer wheel */
+  return TIMEOUT + next_random(ctx) % 20000000;
+}
+
+static void fire_after(test_context *ctx, size_t i)
+{
+  rtems_status_code sc;
+
+  sc = rtems_timer_fire_after(ctx->timers[i], interval(ctx), never, NULL);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void churn(test_context *ctx)
+{
+  size_t i;
+
+  if (ctx->active_timers == 0) {
+    return;
+  }
+
+  for (i = 0; i < CHURN_PER_ROUND; ++i) {
+    fire_after(ctx, next_random(ctx) % ctx->active_timers);
+  }
+}
+
+static void peer_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_semaphore_obtain(ctx->peer_sema, RTEMS_WAIT, TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    churn(ctx);
+
+    sc = rtems_semaphore_release(ctx->init_sema);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_case(test_context *ctx, size_t active_timers)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  size_t i;
+
+  for (i = ctx->active_timers; i < active_timers; ++i) {
+    fire_after(ctx, i);
+  }
+
+  ctx->active_timers = active_timers;
+
+  a = rtems_counter_read();
+
+  for (i = 0; i < ROUND_COUNT; ++i) {
+    rtems_status_code sc;
+
+    churn(ctx);
+
+    sc = rtems_semaphore_release(ctx->peer_sema);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_semaphore_obtain(ctx->init_sema, RTEMS_WAIT, TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  b = rtems_counter_read();
+
+  printf(
+    "%s{\n"
+    "      \"active-timers\": %zu,\n"
+    "      \"round-trip\": %" PRIu64 "\n"
+    "    }",
+    active_timers == 0 ? "\n    " : ", ",
+    active_timers,
+    rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(b, a)) /
+      ROUND_COUNT
+  );
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  size_t active_timers;
+
+  ctx->random = 123;
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('I', 'N', 'I', 'T'),
+    0,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_FIFO,
+    0,
+    &ctx->init_sema
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('P', 'E', 'E', 'R'),
+    0,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_FIFO,
+    0,
+    &ctx->peer_sema
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  while (ctx->timer_count < MAXIMUM_TIMERS) {
+    sc = rtems_timer_create(
+      rtems_build_name('T', 'I', 'M', 'R'),
+      &ctx->timers[ctx->timer_count]
+    );
+    if (sc != RTEMS_SUCCESSFUL) {
+      break;
+    }
+
+    ++ctx->timer_count;
+  }
+
+  sc = rtems_task_create(
+    rtems_build_name('P', 'E', 'E', 'R'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->peer
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->peer, peer_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+#ifdef TEST_TIMER_WHEEL
+    "  \"timer-wheel\": true,\n"
+#else
+    "  \"timer-wheel\": false,\n"
+#endif
+    "  \"timer-count\": %zu,\n"
+    "  \"samples\": [",
+    ctx->timer_count
+  );
+
+  active_timers = 0;
+
+  while (true) {
+    test_case(ctx, active_timers);
+
+    if (active_timers == ctx->timer_count) {
+      break;
+    }
+
+    active_timers = active_timers * 4 + 16;
+
+    if (active_timers > ctx->timer_count) {
+      active_timers = ctx->timer_count;
+    }
+  }
+
+  printf("\n  ]\n}\n*** END OF JSON DATA ***\n");
+
+  for (active_timers = 0; active_timers < ctx->timer_count; ++active_timers) {
+    sc = rtems_timer_cancel(ctx->timers[active_timers]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_SEMAPHORES 2
+#define CONFIGURE_MAXIMUM_TIMERS rtems_resource_unlimited(32)
+
+#ifdef TEST_TIMER_WHEEL
+#define CONFIGURE_WATCHDOG_TIMER_WHEEL
+#endif
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -83,6 +83,17 @@ typedef struct {
    */
   long message;
 
+  /**
+   * @brief This member provides the messages to send at once.
+   */
+  uint64_t messages[ 16 ];
+
+  /**
+   * @brief This member provides the count of messages sent or received at
+   *   once.
+   */
+  uint32_t count;
+
   /**
    * @brief This member provides a worker identifier.
    */
@@ -117,7 +128,7 @@ typedef struct {
 static RtemsMessageValPerf_Context
   RtemsMessageValPerf_Instance;
 
-#define MAXIMUM_PENDING_MESSAGES 1
+#define MAXIMUM_PENDING_MESSAGES 16
 
 #define MAXIMUM_MESSAGE_SIZE 8
 
@@ -131,6 +142,10 @@ static RtemsMessageValPerf_Context
 
 #define EVENT_RECEIVE_END RTEMS_EVENT_4
 
+#define EVENT_RECEIVE_MULTIPLE RTEMS_EVENT_5
+
+#define MULTIPLE_COUNT RTEMS_ARRAY_SIZE( RtemsMessageValPerf_Instance.messages )
+
 typedef RtemsMessageValPerf_Context Context;
 
 static RTEMS_MESSAGE_QUEUE_BUFFER( MAXIMUM_MESSAGE_SIZE )
@@ -205,6 +220,24 @@ static void Worker( rtems_task_argument arg )
         ctx->end = ticks;
       }
     }
+
+    if ( ( events & EVENT_RECEIVE_MULTIPLE ) != 0 ) {
+      uint64_t messages[ MULTIPLE_COUNT ];
+      size_t   sizes[ MULTIPLE_COUNT ];
+      uint32_t count;
+
+      sc = rtems_message_queue_receive_multiple(
+        ctx->queue_id,
+        messages,
+        sizes,
+        MULTIPLE_COUNT,
+        &count,
+        RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+      T_quiet_rsc_success( sc );
+      T_quiet_eq_u32( count, MULTIPLE_COUNT );
+    }
   }
 }
 
@@ -887,6 +920,287 @@ static bool RtemsMessageReqPerfSendPreempt_Teardown_Wrap(
 
 /** @} */
 
+/**
+ * @defgroup RtemsMessageReqPerfSendMultiple \
+ *   spec:/rtems/message/req/perf-send-multiple
+ *
+ * @{
+ */
+
+/**
+ * @brief Send multiple messages at once.
+ */
+static void RtemsMessageReqPerfSendMultiple_Body(
+  RtemsMessageValPerf_Context *ctx
+)
+{
+  ctx->status = rtems_message_queue_send_multiple(
+    ctx->queue_id,
+    ctx->messages,
+    sizeof( ctx->messages[ 0 ] ),
+    MULTIPLE_COUNT,
+    &ctx->count
+  );
+}
+
+static void RtemsMessageReqPerfSendMultiple_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfSendMultiple_Body( ctx );
+}
+
+/**
+ * @brief Flush the message queue.  Discard samples interrupted by a clock
+ *   tick.
+ */
+static bool RtemsMessageReqPerfSendMultiple_Teardown(
+  RtemsMessageValPerf_Context *ctx,
+  T_ticks                     *delta,
+  uint32_t                     tic,
+  uint32_t                     toc,
+  unsigned int                 retry
+)
+{
+  rtems_status_code sc;
+  uint32_t          count;
+
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_u32( ctx->count, MULTIPLE_COUNT );
+
+  sc = rtems_message_queue_flush( ctx->queue_id, &count );
+  T_quiet_rsc_success( sc );
+  T_quiet_eq_u32( count, MULTIPLE_COUNT );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfSendMultiple_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfSendMultiple_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/** @} */
+
+/**
+ * @defgroup RtemsMessageReqPerfSendMultipleOther \
+ *   spec:/rtems/message/req/perf-send-multiple-other
+ *
+ * @{
+ */
+
+/**
+ * @brief Let the worker wait on the message queue for multiple messages.
+ */
+static void RtemsMessageReqPerfSendMultipleOther_Setup(
+  RtemsMessageValPerf_Context *ctx
+)
+{
+  Send( ctx, EVENT_RECEIVE_MULTIPLE );
+  SetPriority( ctx->worker_id, PRIO_LOW );
+}
+
+static void RtemsMessageReqPerfSendMultipleOther_Setup_Wrap( void *arg )
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfSendMultipleOther_Setup( ctx );
+}
+
+/**
+ * @brief Send multiple messages at once.
+ */
+static void RtemsMessageReqPerfSendMultipleOther_Body(
+  RtemsMessageValPerf_Context *ctx
+)
+{
+  ctx->status = rtems_message_queue_send_multiple(
+    ctx->queue_id,
+    ctx->messages,
+    sizeof( ctx->messages[ 0 ] ),
+    MULTIPLE_COUNT,
+    &ctx->count
+  );
+}
+
+static void RtemsMessageReqPerfSendMultipleOther_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfSendMultipleOther_Body( ctx );
+}
+
+/**
+ * @brief Restore the worker priority.  Make sure the worker received all
+ *   messages at once.  Discard samples interrupted by a clock tick.
+ */
+static bool RtemsMessageReqPerfSendMultipleOther_Teardown(
+  RtemsMessageValPerf_Context *ctx,
+  T_ticks                     *delta,
+  uint32_t                     tic,
+  uint32_t                     toc,
+  unsigned int                 retry
+)
+{
+  rtems_status_code sc;
+  uint32_t          count;
+
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_u32( ctx->count, MULTIPLE_COUNT );
+
+  SetPriority( ctx->worker_id, PRIO_HIGH );
+
+  sc = rtems_message_queue_get_number_pending( ctx->queue_id, &count );
+  T_quiet_rsc_success( sc );
+  T_quiet_eq_u32( count, 0 );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfSendMultipleOther_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfSendMultipleOther_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/** @} */
+
+/**
+ * @defgroup RtemsMessageReqPerfReceiveMultiple \
+ *   spec:/rtems/message/req/perf-receive-multiple
+ *
+ * @{
+ */
+
+/**
+ * @brief Fill the message queue.
+ */
+static void RtemsMessageReqPerfReceiveMultiple_Setup(
+  RtemsMessageValPerf_Context *ctx
+)
+{
+  rtems_status_code sc;
+  uint32_t          count;
+
+  sc = rtems_message_queue_send_multiple(
+    ctx->queue_id,
+    ctx->messages,
+    sizeof( ctx->messages[ 0 ] ),
+    MULTIPLE_COUNT,
+    &count
+  );
+  T_quiet_rsc_success( sc );
+  T_quiet_eq_u32( count, MULTIPLE_COUNT );
+}
+
+static void RtemsMessageReqPerfReceiveMultiple_Setup_Wrap( void *arg )
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfReceiveMultiple_Setup( ctx );
+}
+
+/**
+ * @brief Receive multiple messages at once.
+ */
+static void RtemsMessageReqPerfReceiveMultiple_Body(
+  RtemsMessageValPerf_Context *ctx
+)
+{
+  uint64_t messages[ MULTIPLE_COUNT ];
+  size_t   sizes[ MULTIPLE_COUNT ];
+
+  ctx->status = rtems_message_queue_receive_multiple(
+    ctx->queue_id,
+    messages,
+    sizes,
+    MULTIPLE_COUNT,
+    &ctx->count,
+    RTEMS_NO_WAIT,
+    0
+  );
+}
+
+static void RtemsMessageReqPerfReceiveMultiple_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfReceiveMultiple_Body( ctx );
+}
+
+/**
+ * @brief Discard samples interrupted by a clock tick.
+ */
+static bool RtemsMessageReqPerfReceiveMultiple_Teardown(
+  RtemsMessageValPerf_Context *ctx,
+  T_ticks                     *delta,
+  uint32_t                     tic,
+  uint32_t                     toc,
+  unsigned int                 retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_u32( ctx->count, MULTIPLE_COUNT );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfReceiveMultiple_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfReceiveMultiple_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/** @} */
+
 /**
  * @fn void T_case_body_RtemsMessageValPerf( void )
  */
@@ -941,6 +1255,24 @@ T_TEST_CASE_FIXTURE( RtemsMessageValPerf, &RtemsMessageValPerf_Fixture )
   ctx->request.body = RtemsMessageReqPerfSendPreempt_Body_Wrap;
   ctx->request.teardown = RtemsMessageReqPerfSendPreempt_Teardown_Wrap;
   T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfSendMultiple";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsMessageReqPerfSendMultiple_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfSendMultiple_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfSendMultipleOther";
+  ctx->request.setup = RtemsMessageReqPerfSendMultipleOther_Setup_Wrap;
+  ctx->request.body = RtemsMessageReqPerfSendMultipleOther_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfSendMultipleOther_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfReceiveMultiple";
+  ctx->request.setup = RtemsMessageReqPerfReceiveMultiple_Setup_Wrap;
+  ctx->request.body = RtemsMessageReqPerfReceiveMultiple_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfReceiveMultiple_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
 }
 
 /** @} */
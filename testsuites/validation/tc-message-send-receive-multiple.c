@@ -0,0 +1,512 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RtemsMessageValSendReceiveMultiple
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include "tx-support.h"
+
+#include <rtems/test.h>
+
+/**
+ * @defgroup RtemsMessageValSendReceiveMultiple \
+ *   spec:/rtems/message/val/send-receive-multiple
+ *
+ * @ingroup TestsuitesValidationNoClock0
+ *
+ * @brief Tests rtems_message_queue_send_multiple() and
+ *   rtems_message_queue_receive_multiple().
+ *
+ * This test case performs the following actions:
+ *
+ * - Send more messages than the queue can hold while no task waits.
+ *
+ *   - Check that the directive call returns RTEMS_TOO_MANY and that the
+ *     messages which fit into the queue were sent.  Check that they are
+ *     received in order.
+ *
+ * - Send messages which exceed the maximum message size.
+ *
+ *   - Check that the directive call returns RTEMS_INVALID_SIZE and that no
+ *     message was sent.
+ *
+ * - Send more messages than a waiting task has slots and the queue can hold.
+ *
+ *   - Check that the waiting task received as many messages as it had slots,
+ *     that the queue is full, and that the directive call returns
+ *     RTEMS_TOO_MANY.
+ *
+ * - Send a single message to a task waiting for multiple messages.
+ *
+ *   - Check that the task received exactly one message.
+ *
+ * - Delete the queue after the messages unblocked a waiting task but before
+ *   the task continued its execution.
+ *
+ *   - Check that the task received all messages.
+ *
+ * @{
+ */
+
+#define MAXIMUM_PENDING_MESSAGES 3
+
+#define MAXIMUM_MESSAGE_SIZE sizeof( uint32_t )
+
+#define MESSAGE_COUNT 6
+
+#define EVENT_DONE RTEMS_EVENT_0
+
+/**
+ * @brief Test context for spec:/rtems/message/val/send-receive-multiple test
+ *   case.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the runner task identifier.
+   */
+  rtems_id runner_id;
+
+  /**
+   * @brief This member contains the message queue identifier.
+   */
+  rtems_id id;
+
+  /**
+   * @brief This member contains the message queue storage area.
+   */
+  RTEMS_MESSAGE_QUEUE_BUFFER( MAXIMUM_MESSAGE_SIZE )
+    storage_area[ MAXIMUM_PENDING_MESSAGES ];
+
+  /**
+   * @brief This member contains the messages to send.
+   */
+  uint32_t messages[ MESSAGE_COUNT ];
+
+  /**
+   * @brief This member specifies the count of messages the worker waits for.
+   */
+  uint32_t slots;
+
+  /**
+   * @brief This member contains the buffer of the worker.
+   */
+  uint32_t buffer[ MESSAGE_COUNT ];
+
+  /**
+   * @brief This member contains the sizes received by the worker.
+   */
+  size_t sizes[ MESSAGE_COUNT ];
+
+  /**
+   * @brief This member contains the count of messages received by the worker.
+   */
+  uint32_t received;
+
+  /**
+   * @brief This member contains the status of the receive of the worker.
+   */
+  rtems_status_code status;
+} RtemsMessageValSendReceiveMultiple_Context;
+
+static RtemsMessageValSendReceiveMultiple_Context
+  RtemsMessageValSendReceiveMultiple_Instance;
+
+static void Worker( rtems_task_argument arg )
+{
+  RtemsMessageValSendReceiveMultiple_Context *ctx;
+
+  ctx = (RtemsMessageValSendReceiveMultiple_Context *) arg;
+
+  ctx->status = rtems_message_queue_receive_multiple(
+    ctx->id,
+    ctx->buffer,
+    ctx->sizes,
+    ctx->slots,
+    &ctx->received,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+
+  SendEvents( ctx->runner_id, EVENT_DONE );
+  SuspendSelf();
+}
+
+static void CreateQueue( RtemsMessageValSendReceiveMultiple_Context *ctx )
+{
+  rtems_status_code          sc;
+  rtems_message_queue_config config = {
+    .name = rtems_build_name( 'M', 'S', 'G', 'Q' ),
+    .maximum_pending_messages = MAXIMUM_PENDING_MESSAGES,
+    .maximum_message_size = MAXIMUM_MESSAGE_SIZE,
+    .storage_area = ctx->storage_area,
+    .storage_size = sizeof( ctx->storage_area ),
+    .storage_free = NULL,
+    .attributes = RTEMS_DEFAULT_ATTRIBUTES
+  };
+
+  sc = rtems_message_queue_construct( &config, &ctx->id );
+  T_rsc_success( sc );
+}
+
+static void DeleteQueue( RtemsMessageValSendReceiveMultiple_Context *ctx )
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_delete( ctx->id );
+  T_rsc_success( sc );
+}
+
+static void ClearWorkerBuffer( RtemsMessageValSendReceiveMultiple_Context *ctx )
+{
+  uint32_t i;
+
+  for ( i = 0; i < MESSAGE_COUNT; ++i ) {
+    ctx->buffer[ i ] = 0;
+    ctx->sizes[ i ] = 0;
+  }
+
+  ctx->received = UINT32_MAX;
+  ctx->status = RTEMS_NOT_IMPLEMENTED;
+}
+
+/*
+ * The worker blocks in rtems_message_queue_receive_multiple() with the
+ * specified count of slots.  Afterwards, it has a lower priority than the
+ * runner, so that it does not continue its execution before the runner waits
+ * for it.
+ */
+static rtems_id StartWorker(
+  RtemsMessageValSendReceiveMultiple_Context *ctx,
+  uint32_t                                    slots
+)
+{
+  rtems_id worker_id;
+
+  ClearWorkerBuffer( ctx );
+  ctx->slots = slots;
+  worker_id = CreateTask( "WORK", PRIO_HIGH );
+  StartTask( worker_id, Worker, ctx );
+  WaitForExecutionStop( worker_id );
+  SetPriority( worker_id, PRIO_LOW );
+
+  return worker_id;
+}
+
+static void WaitForWorker( rtems_id worker_id )
+{
+  ReceiveAllEvents( EVENT_DONE );
+  DeleteTask( worker_id );
+}
+
+static void CheckWorkerMessages(
+  const RtemsMessageValSendReceiveMultiple_Context *ctx,
+  uint32_t                                          count
+)
+{
+  uint32_t i;
+
+  T_rsc_success( ctx->status );
+  T_eq_u32( ctx->received, count );
+
+  for ( i = 0; i < count; ++i ) {
+    T_eq_sz( ctx->sizes[ i ], sizeof( ctx->messages[ i ] ) );
+    T_eq_u32( ctx->buffer[ i ], ctx->messages[ i ] );
+  }
+}
+
+/**
+ * @brief Send more messages than the queue can hold while no task waits.
+ */
+static void RtemsMessageValSendReceiveMultiple_Action_0(
+  RtemsMessageValSendReceiveMultiple_Context *ctx
+)
+{
+  rtems_status_code sc;
+  uint32_t          sent;
+  uint32_t          received;
+  uint32_t          buffer[ MESSAGE_COUNT ];
+  size_t            sizes[ MESSAGE_COUNT ];
+  uint32_t          i;
+
+  CreateQueue( ctx );
+
+  sent = UINT32_MAX;
+  sc = rtems_message_queue_send_multiple(
+    ctx->id,
+    ctx->messages,
+    sizeof( ctx->messages[ 0 ] ),
+    MESSAGE_COUNT,
+    &sent
+  );
+
+  /*
+   * Check that the directive call returns RTEMS_TOO_MANY and that the messages
+   * which fit into the queue were sent.  Check that they are received in
+   * order.
+   */
+  T_rsc( sc, RTEMS_TOO_MANY );
+  T_eq_u32( sent, MAXIMUM_PENDING_MESSAGES );
+
+  received = UINT32_MAX;
+  sc = rtems_message_queue_receive_multiple(
+    ctx->id,
+    buffer,
+    sizes,
+    MESSAGE_COUNT,
+    &received,
+    RTEMS_NO_WAIT,
+    0
+  );
+  T_rsc_success( sc );
+  T_eq_u32( received, MAXIMUM_PENDING_MESSAGES );
+
+  for ( i = 0; i < MAXIMUM_PENDING_MESSAGES; ++i ) {
+    T_eq_sz( sizes[ i ], sizeof( ctx->messages[ i ] ) );
+    T_eq_u32( buffer[ i ], ctx->messages[ i ] );
+  }
+
+  DeleteQueue( ctx );
+}
+
+/**
+ * @brief Send messages which exceed the maximum message size.
+ */
+static void RtemsMessageValSendReceiveMultiple_Action_1(
+  RtemsMessageValSendReceiveMultiple_Context *ctx
+)
+{
+  rtems_status_code sc;
+  uint32_t          sent;
+  uint32_t          received;
+  uint32_t          buffer[ MESSAGE_COUNT ];
+  size_t            sizes[ MESSAGE_COUNT ];
+
+  CreateQueue( ctx );
+
+  sent = UINT32_MAX;
+  sc = rtems_message_queue_send_multiple(
+    ctx->id,
+    ctx->messages,
+    MAXIMUM_MESSAGE_SIZE + 1,
+    2,
+    &sent
+  );
+
+  /*
+   * Check that the directive call returns RTEMS_INVALID_SIZE and that no
+   * message was sent.
+   */
+  T_rsc( sc, RTEMS_INVALID_SIZE );
+  T_eq_u32( sent, 0 );
+
+  received = UINT32_MAX;
+  sc = rtems_message_queue_receive_multiple(
+    ctx->id,
+    buffer,
+    sizes,
+    MESSAGE_COUNT,
+    &received,
+    RTEMS_NO_WAIT,
+    0
+  );
+  T_rsc( sc, RTEMS_UNSATISFIED );
+  T_eq_u32( received, 0 );
+
+  DeleteQueue( ctx );
+}
+
+/**
+ * @brief Send more messages than a waiting task has slots and the queue can
+ *   hold.
+ */
+static void RtemsMessageValSendReceiveMultiple_Action_2(
+  RtemsMessageValSendReceiveMultiple_Context *ctx
+)
+{
+  rtems_status_code sc;
+  rtems_id          worker_id;
+  uint32_t          sent;
+  uint32_t          count;
+  uint32_t          message;
+  size_t            size;
+
+  CreateQueue( ctx );
+  worker_id = StartWorker( ctx, 2 );
+
+  sent = UINT32_MAX;
+  sc = rtems_message_queue_send_multiple(
+    ctx->id,
+    ctx->messages,
+    sizeof( ctx->messages[ 0 ] ),
+    MESSAGE_COUNT,
+    &sent
+  );
+  WaitForWorker( worker_id );
+
+  /*
+   * Check that the waiting task received as many messages as it had slots,
+   * that the queue is full, and that the directive call returns
+   * RTEMS_TOO_MANY.
+   */
+  T_rsc( sc, RTEMS_TOO_MANY );
+  T_eq_u32( sent, 2 + MAXIMUM_PENDING_MESSAGES );
+  CheckWorkerMessages( ctx, 2 );
+
+  count = UINT32_MAX;
+  sc = rtems_message_queue_get_number_pending( ctx->id, &count );
+  T_rsc_success( sc );
+  T_eq_u32( count, MAXIMUM_PENDING_MESSAGES );
+
+  size = SIZE_MAX;
+  sc = rtems_message_queue_receive(
+    ctx->id,
+    &message,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  T_rsc_success( sc );
+  T_eq_sz( size, sizeof( message ) );
+  T_eq_u32( message, ctx->messages[ 2 ] );
+
+  DeleteQueue( ctx );
+}
+
+/**
+ * @brief Send a single message to a task waiting for multiple messages.
+ */
+static void RtemsMessageValSendReceiveMultiple_Action_3(
+  RtemsMessageValSendReceiveMultiple_Context *ctx
+)
+{
+  rtems_status_code sc;
+  rtems_id          worker_id;
+
+  CreateQueue( ctx );
+  worker_id = StartWorker( ctx, MESSAGE_COUNT );
+
+  sc = rtems_message_queue_send(
+    ctx->id,
+    &ctx->messages[ 0 ],
+    sizeof( ctx->messages[ 0 ] )
+  );
+  T_rsc_success( sc );
+  WaitForWorker( worker_id );
+
+  /*
+   * Check that the task received exactly one message.
+   */
+  CheckWorkerMessages( ctx, 1 );
+  T_eq_sz( ctx->sizes[ 1 ], 0 );
+
+  DeleteQueue( ctx );
+}
+
+/**
+ * @brief Delete the queue after the messages unblocked a waiting task but
+ *   before the task continued its execution.
+ */
+static void RtemsMessageValSendReceiveMultiple_Action_4(
+  RtemsMessageValSendReceiveMultiple_Context *ctx
+)
+{
+  rtems_status_code sc;
+  rtems_id          worker_id;
+  uint32_t          sent;
+
+  CreateQueue( ctx );
+  worker_id = StartWorker( ctx, MESSAGE_COUNT );
+
+  sent = UINT32_MAX;
+  sc = rtems_message_queue_send_multiple(
+    ctx->id,
+    ctx->messages,
+    sizeof( ctx->messages[ 0 ] ),
+    MESSAGE_COUNT - 1,
+    &sent
+  );
+  T_rsc_success( sc );
+  T_eq_u32( sent, MESSAGE_COUNT - 1 );
+
+  DeleteQueue( ctx );
+  WaitForWorker( worker_id );
+
+  /*
+   * Check that the task received all messages.
+   */
+  CheckWorkerMessages( ctx, MESSAGE_COUNT - 1 );
+}
+
+static void RtemsMessageValSendReceiveMultiple_Setup(
+  RtemsMessageValSendReceiveMultiple_Context *ctx
+)
+{
+  uint32_t i;
+
+  ctx->runner_id = rtems_task_self();
+  SetSelfPriority( PRIO_NORMAL );
+
+  for ( i = 0; i < MESSAGE_COUNT; ++i ) {
+    ctx->messages[ i ] = 0x12345600 + i;
+  }
+}
+
+static void RtemsMessageValSendReceiveMultiple_Teardown(
+  RtemsMessageValSendReceiveMultiple_Context *ctx
+)
+{
+  RestoreRunnerPriority();
+}
+
+/**
+ * @fn void T_case_body_RtemsMessageValSendReceiveMultiple( void )
+ */
+T_TEST_CASE( RtemsMessageValSendReceiveMultiple )
+{
+  RtemsMessageValSendReceiveMultiple_Context *ctx;
+
+  ctx = &RtemsMessageValSendReceiveMultiple_Instance;
+
+  RtemsMessageValSendReceiveMultiple_Setup( ctx );
+  RtemsMessageValSendReceiveMultiple_Action_0( ctx );
+  RtemsMessageValSendReceiveMultiple_Action_1( ctx );
+  RtemsMessageValSendReceiveMultiple_Action_2( ctx );
+  RtemsMessageValSendReceiveMultiple_Action_3( ctx );
+  RtemsMessageValSendReceiveMultiple_Action_4( ctx );
+  RtemsMessageValSendReceiveMultiple_Teardown( ctx );
+}
+
+/** @} */